@@ -0,0 +1,505 @@
+/*  bench.c
+*
+* Host frame benchmark for PL3D-KC.
+* Renders a fixed set of scenes in every raster mode for N frames and
+* reports frame time, polygon and pixel throughput and per-stage times
+* (from PL_stats) as CSV or JSON.
+*
+*   pl_bench [-n frames] [-f csv|json] [-o file] [-s scene] [-m mode]
+*   pl_bench -a   accuracy and speed of PL_recip against the exact divide,
+*                 with PL_RECIP_PROJECT
+*
+*/
+
+#include "pl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "building_01.h"
+
+#define WARMUP_FRAMES 2
+
+#if defined(PL_COLOR_DEPTH_32)
+static int video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_16)
+static uint16_t video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_8)
+static uint8_t video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_4)
+static uint8_t video_buffer[PL_SIZE_W * PL_SIZE_H / 2];
+#endif
+static ZBUF_TYPE depth_buffer[PL_SIZE_W * PL_SIZE_H];
+
+static struct PL_OBJ *cube_textured;
+
+static struct PL_TEX checktex;
+static PL_TEXEL checker[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
+
+struct bench_mode {
+	const char *name;
+	int rmode;
+};
+
+static const struct bench_mode modes[] = {
+	{ "textured", PL_TEXTURED },
+	{ "flat", PL_FLAT },
+	{ "flat_nolight", PL_FLAT_NOLIGHT },
+	{ "edge_wireframe", PL_EDGE_WIREFRAME },
+	{ "textured_nolight", PL_TEXTURED_NOLIGHT },
+	{ "nodraw", PL_NODRAW },
+	{ "wireframe", PL_WIREFRAME },
+	{ "overdraw", PL_OVERDRAW },
+};
+
+struct bench_scene {
+	const char *name;
+	/* set camera and render frame i of n */
+	void (*draw)(int i, int n);
+};
+
+struct bench_result {
+	const char *scene;
+	const char *mode;
+	int frames;
+	uint64_t total_ns;
+	uint64_t stage_ns[PL_STAGE_COUNT];
+	uint64_t polygons;
+	uint64_t culled;
+	uint64_t pixels;
+	uint64_t dirty; /* pixels a partial display update would send */
+};
+
+static const char *stage_names[PL_STAGE_COUNT] = {
+	"clear", "transform", "calc", "fill"
+};
+
+static void
+maketex(void)
+{
+	int i, j, c;
+
+	for (i = 0; i < PL_REQ_TEX_DIM; i++) {
+		for (j = 0; j < PL_REQ_TEX_DIM; j++) {
+			if (((i & 0x2) ^ (j & 0x2))) {
+				c = 0x30;
+			} else {
+				c = 0xC0;
+			}
+			checker[i + j * PL_REQ_TEX_DIM] = PL_TEXEL_GREY(c);
+		}
+	}
+	checktex.data = checker;
+}
+
+static uint64_t
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/* linear interpolation from a to b over the frames of a path */
+static int
+path(int a, int b, int i, int n)
+{
+	if (n <= 1) {
+		return a;
+	}
+	return a + (b - a) * i / (n - 1);
+}
+
+/* same placement as the demo in src/main.c */
+static void
+draw_building(int rx)
+{
+	PL_mst_push();
+	PL_mst_translate(-10, -100, 2000);
+	PL_mst_rotatex(PL_A256(rx));
+	PL_mst_rotatey(PL_A256(128));
+	PL_mst_rotatez(PL_A256(64));
+	PL_render_object_const(&building_01);
+	PL_mst_pop();
+}
+
+/* camera flies toward the building until it crosses the near plane */
+static void
+scene_building_approach(int i, int n)
+{
+	PL_set_camera(0, 0, path(-800, 1500, i, n), 0, 0, 0);
+	draw_building(0);
+}
+
+/* camera slides sideways past the viewport edges */
+static void
+scene_building_strafe(int i, int n)
+{
+	PL_set_camera(path(-900, 900, i, n), 0, 600, 0, 0, 0);
+	draw_building(0);
+}
+
+/* building tumbles in front of a fixed camera */
+static void
+scene_building_spin(int i, int n)
+{
+	(void)n;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	draw_building(i << 1);
+}
+
+/* look-at camera circling the building */
+static void
+scene_building_orbit(int i, int n)
+{
+	int eye[3], at[3] = { -10, -100, 2000 }, up[3] = { 0, 1, 0 };
+	int a = i * PL_TRIGMAX / n;
+
+	eye[0] = at[0] + (PL_sin(a) * 1200 >> PL_P);
+	eye[1] = at[1] + 300;
+	eye[2] = at[2] - (PL_cos(a) * 1200 >> PL_P);
+	PL_look_at(eye, at, up);
+	draw_building(0);
+}
+
+/* many small objects, stresses per-object setup */
+static void
+scene_cube_grid(int i, int n)
+{
+	int x, y;
+
+	(void)n;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	PL_texture(&checktex);
+	for (y = -3; y < 3; y++) {
+		for (x = -4; x < 4; x++) {
+			PL_mst_push();
+			PL_mst_translate(x * 48 + 24, y * 48 + 24, 500);
+			PL_mst_rotatex(PL_A256(i + x * 8));
+			PL_mst_rotatey(PL_A256(i * 2 + y * 8));
+			PL_render_object(cube_textured);
+			PL_mst_pop();
+		}
+	}
+}
+
+static const struct bench_scene scenes[] = {
+	{ "building_approach", scene_building_approach },
+	{ "building_strafe", scene_building_strafe },
+	{ "building_spin", scene_building_spin },
+	{ "building_orbit", scene_building_orbit },
+	{ "cube_grid", scene_cube_grid },
+};
+
+#define ARRAY_LEN(a) (int)(sizeof(a) / sizeof((a)[0]))
+
+static void
+run(const struct bench_scene *sc, const struct bench_mode *md, int frames,
+	struct bench_result *res)
+{
+	struct PL_STATS st;
+	struct PL_RECT prev, cur;
+	uint64_t t0, t1;
+	int i, s;
+
+	memset(res, 0, sizeof(*res));
+	res->scene = sc->name;
+	res->mode = md->name;
+	res->frames = frames;
+	prev.x0 = PL_vp_min_x;
+	prev.y0 = PL_vp_min_y;
+	prev.x1 = PL_vp_max_x;
+	prev.y1 = PL_vp_max_y;
+
+	for (i = -WARMUP_FRAMES; i < frames; i++) {
+		PL_raster_mode = md->rmode;
+		PL_polygon_count = 0;
+		PL_stats_reset();
+		PL_damage_reset();
+
+		t0 = now_ns();
+		PL_clear_vp(0, 0, 0);
+		sc->draw(i < 0 ? 0 : i, frames);
+		PL_pipe_flush();
+		t1 = now_ns();
+
+		/* what changed since the last frame, see src/damage.c */
+		PL_damage_get(&cur);
+		PL_rect_union(&prev, &cur);
+		if (i >= 0 && !PL_RECT_EMPTY(&prev)) {
+			res->dirty += (uint64_t)(prev.x1 - prev.x0 + 1) *
+						  (prev.y1 - prev.y0 + 1);
+		}
+		prev = cur;
+
+		if (i < 0) {
+			continue;
+		}
+		PL_stats_get(&st);
+		res->total_ns += t1 - t0;
+		for (s = 0; s < PL_STAGE_COUNT; s++) {
+			res->stage_ns[s] += EXT_cycles_to_ns(st.cycles[s]);
+		}
+		res->polygons += st.polys_rasterized;
+		res->culled += st.polys_near_culled + st.polys_backface_culled;
+		res->pixels += st.pixels_written;
+	}
+}
+
+static double
+per_second(uint64_t count, uint64_t ns)
+{
+	return ns ? (double)count * 1e9 / (double)ns : 0.0;
+}
+
+static void
+print_csv_header(FILE *out)
+{
+	int s;
+
+	fprintf(out, "scene,mode,frames,ns_per_frame");
+	for (s = 0; s < PL_STAGE_COUNT; s++) {
+		fprintf(out, ",%s_ns", stage_names[s]);
+	}
+	fprintf(out, ",polygons_per_frame,culled_per_frame,pixels_per_frame,"
+				 "dirty_per_frame,polygons_per_s,pixels_per_s\n");
+}
+
+static void
+print_csv(FILE *out, const struct bench_result *r)
+{
+	uint64_t f = r->frames;
+	int s;
+
+	fprintf(out, "%s,%s,%d,%llu", r->scene, r->mode, r->frames,
+			(unsigned long long)(r->total_ns / f));
+	for (s = 0; s < PL_STAGE_COUNT; s++) {
+		fprintf(out, ",%llu", (unsigned long long)(r->stage_ns[s] / f));
+	}
+	fprintf(out, ",%llu,%llu,%llu,%llu,%.0f,%.0f\n",
+			(unsigned long long)(r->polygons / f),
+			(unsigned long long)(r->culled / f),
+			(unsigned long long)(r->pixels / f),
+			(unsigned long long)(r->dirty / f),
+			per_second(r->polygons, r->total_ns),
+			per_second(r->pixels, r->total_ns));
+}
+
+static void
+print_json(FILE *out, const struct bench_result *r, int first)
+{
+	uint64_t f = r->frames;
+	int s;
+
+	fprintf(out,
+			"%s  {\"scene\": \"%s\", \"mode\": \"%s\", \"frames\": %d, "
+			"\"ns_per_frame\": %llu, \"stages_ns\": {",
+			first ? "" : ",\n", r->scene, r->mode, r->frames,
+			(unsigned long long)(r->total_ns / f));
+	for (s = 0; s < PL_STAGE_COUNT; s++) {
+		fprintf(out, "%s\"%s\": %llu", s ? ", " : "", stage_names[s],
+				(unsigned long long)(r->stage_ns[s] / f));
+	}
+	fprintf(out,
+			"}, \"polygons_per_frame\": %llu, \"culled_per_frame\": %llu, "
+			"\"pixels_per_frame\": %llu, \"dirty_per_frame\": %llu, "
+			"\"polygons_per_s\": %.0f, \"pixels_per_s\": %.0f}",
+			(unsigned long long)(r->polygons / f),
+			(unsigned long long)(r->culled / f),
+			(unsigned long long)(r->pixels / f),
+			(unsigned long long)(r->dirty / f),
+			per_second(r->polygons, r->total_ns),
+			per_second(r->pixels, r->total_ns));
+}
+
+#ifdef PL_RECIP_PROJECT
+
+#define RECIP_MAX_Z   (1 << 20)
+#define RECIP_REL_MIN 4096
+
+static volatile int recip_sink;
+
+/* the projection computes (1 << (PL_fov + 12)) / z for z past the near plane */
+static void
+recip_report(FILE *out)
+{
+	int lg, z, d, q, exact_n;
+	uint64_t abs_sum, n, t0, t_div, t_recip;
+	int max_abs;
+	double rel, max_rel;
+
+	fprintf(out, "PL_recip, %d lut bits, %d newton steps, z in [%d, %d)\n",
+			PL_RECIP_LUT_BITS, PL_RECIP_NEWTON, PL_Z_NEAR_PLANE, RECIP_MAX_Z);
+	fprintf(out, "fov,max_abs_err,mean_abs_err,max_rel_err_ppm(q>=%d),"
+				 "exact_pct,div_ns,recip_ns\n", RECIP_REL_MIN);
+	for (lg = 8 + 12; lg <= 12 + 12; lg++) {
+		max_abs = 0;
+		max_rel = 0;
+		abs_sum = 0;
+		exact_n = 0;
+		n = 0;
+		for (z = PL_Z_NEAR_PLANE; z < RECIP_MAX_Z; z++) {
+			q = (1 << lg) / z;
+			d = q - PL_recip(lg, z);
+			if (d < 0) {
+				d = -d;
+			}
+			if (d > max_abs) {
+				max_abs = d;
+			}
+			/* tiny quotients would dominate the relative error */
+			rel = (q >= RECIP_REL_MIN) ? (double)d / q : 0.0;
+			if (rel > max_rel) {
+				max_rel = rel;
+			}
+			abs_sum += d;
+			exact_n += (d == 0);
+			n++;
+		}
+
+		/* z runs in the outer loop so the quotient is not hoisted */
+		t0 = now_ns();
+		for (z = PL_Z_NEAR_PLANE; z < RECIP_MAX_Z; z++) {
+			recip_sink = (1 << lg) / (z + (recip_sink & 1));
+		}
+		t_div = now_ns() - t0;
+		t0 = now_ns();
+		for (z = PL_Z_NEAR_PLANE; z < RECIP_MAX_Z; z++) {
+			recip_sink = PL_recip(lg, z + (recip_sink & 1));
+		}
+		t_recip = now_ns() - t0;
+
+		fprintf(out, "%d,%d,%.4f,%.2f,%.2f,%.2f,%.2f\n", lg - 12, max_abs,
+				(double)abs_sum / n, max_rel * 1e6, 100.0 * exact_n / n,
+				(double)t_div / n, (double)t_recip / n);
+	}
+}
+
+#define ACCURACY_OPT " [-a]"
+#else
+#define ACCURACY_OPT ""
+#endif
+
+static void
+usage(const char *argv0)
+{
+	int i;
+
+	fprintf(stderr,
+			"usage: %s [-n frames] [-f csv|json] [-o file] [-s scene] "
+			"[-m mode]" ACCURACY_OPT "\n  scenes:",
+			argv0);
+	for (i = 0; i < ARRAY_LEN(scenes); i++) {
+		fprintf(stderr, " %s", scenes[i].name);
+	}
+	fprintf(stderr, "\n  modes:");
+	for (i = 0; i < ARRAY_LEN(modes); i++) {
+		fprintf(stderr, " %s", modes[i].name);
+	}
+	fprintf(stderr, "\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	struct bench_result res;
+	const char *scene_filter = NULL;
+	const char *mode_filter = NULL;
+	const char *out_name = NULL;
+	FILE *out = stdout;
+	int frames = 100;
+	int json = 0;
+	int first = 1;
+#ifdef PL_RECIP_PROJECT
+	int accuracy = 0;
+#endif
+	int opt, s, m;
+
+	while ((opt = getopt(argc, argv, "n:f:o:s:m:ah")) != -1) {
+		switch (opt) {
+#ifdef PL_RECIP_PROJECT
+		case 'a':
+			accuracy = 1;
+			break;
+#endif
+		case 'n':
+			frames = atoi(optarg);
+			break;
+		case 'f':
+			json = !strcmp(optarg, "json");
+			break;
+		case 'o':
+			out_name = optarg;
+			break;
+		case 's':
+			scene_filter = optarg;
+			break;
+		case 'm':
+			mode_filter = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (frames <= 0) {
+		usage(argv[0]);
+		return 1;
+	}
+	if (out_name && !(out = fopen(out_name, "w"))) {
+		perror(out_name);
+		return 1;
+	}
+
+	maketex();
+	PL_init(video_buffer, depth_buffer, PL_SIZE_W, PL_SIZE_H);
+#ifdef PL_RECIP_PROJECT
+	if (accuracy) {
+		recip_report(out);
+		if (out != stdout) {
+			fclose(out);
+		}
+		return 0;
+	}
+#endif
+	PL_texture(&checktex);
+	cube_textured = PL_gen_box(32, 32, 32, PL_ALL, 255, 255, 255);
+	PL_fov = 8;
+	PL_cur_tex = NULL;
+	PL_cull_mode = PL_CULL_BACK;
+
+	if (json) {
+		fprintf(out, "[\n");
+	} else {
+		print_csv_header(out);
+	}
+	for (s = 0; s < ARRAY_LEN(scenes); s++) {
+		if (scene_filter && strcmp(scene_filter, scenes[s].name)) {
+			continue;
+		}
+		for (m = 0; m < ARRAY_LEN(modes); m++) {
+			if (mode_filter && strcmp(mode_filter, modes[m].name)) {
+				continue;
+			}
+			run(&scenes[s], &modes[m], frames, &res);
+			if (json) {
+				print_json(out, &res, first);
+			} else {
+				print_csv(out, &res);
+			}
+			first = 0;
+		}
+	}
+	if (json) {
+		fprintf(out, "\n]\n");
+	}
+
+	if (out != stdout) {
+		fclose(out);
+	}
+	return 0;
+}
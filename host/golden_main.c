@@ -0,0 +1,74 @@
+/*  golden_main.c
+*
+* Host driver for the golden image harness in src/golden.c.
+*
+*   pl_golden [-r refdir] [-o outdir] [-s scene] [-t tol] [-d depth_tol]
+*             [-b max_bad] [-u]
+*
+* -u rewrites the references from the current renders.
+* Exits non-zero if any image does not match its reference.
+*
+*/
+
+#include "pl.h"
+#include "golden.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#if defined(PL_COLOR_DEPTH_32)
+static int video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_16)
+static uint16_t video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_8)
+static uint8_t video_buffer[PL_SIZE_W * PL_SIZE_H];
+#elif defined(PL_COLOR_DEPTH_4)
+static uint8_t video_buffer[PL_SIZE_W * PL_SIZE_H / 2];
+#endif
+static ZBUF_TYPE depth_buffer[PL_SIZE_W * PL_SIZE_H];
+
+int
+main(int argc, char **argv)
+{
+	struct golden_opts o = {
+		.ref_dir = "golden",
+		.out_dir = "golden_out",
+	};
+	int opt;
+
+	while ((opt = getopt(argc, argv, "r:o:s:t:d:b:uh")) != -1) {
+		switch (opt) {
+		case 'r':
+			o.ref_dir = optarg;
+			break;
+		case 'o':
+			o.out_dir = optarg;
+			break;
+		case 's':
+			o.only = optarg;
+			break;
+		case 't':
+			o.tolerance = atoi(optarg);
+			break;
+		case 'd':
+			o.depth_tolerance = atoi(optarg);
+			break;
+		case 'b':
+			o.max_bad = atoi(optarg);
+			break;
+		case 'u':
+			o.update = 1;
+			break;
+		default:
+			fprintf(stderr,
+					"usage: %s [-r refdir] [-o outdir] [-s scene] [-t tol] "
+					"[-d depth_tol] [-b max_bad] [-u]\n",
+					argv[0]);
+			return 1;
+		}
+	}
+
+	PL_init(video_buffer, depth_buffer, PL_SIZE_W, PL_SIZE_H);
+	return golden_run(&o) != 0;
+}
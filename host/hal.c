@@ -0,0 +1,79 @@
+/* Host stand-in for pl/hal.c, used by the host build only. */
+
+#include "pl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+extern void *
+EXT_calloc(unsigned n, unsigned esz)
+{
+    return calloc(n, esz);
+}
+
+extern void
+EXT_free(void *p)
+{
+    free(p);
+}
+
+/* for the golden harness, which checks the importers' rejections */
+const char *host_last_error;
+
+extern void
+EXT_error(int err_id, char *modname, char *msg)
+{
+    host_last_error = msg;
+    fprintf(stderr, "vx error 0x%x in %s: %s\n", err_id, modname, msg);
+}
+
+static uint64_t
+monotonic_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+/* the time stamp counter is much cheaper to read than the clock, which
+ * matters since PL_stats times every polygon */
+extern uint32_t
+EXT_cycles(void)
+{
+    return (uint32_t)__rdtsc();
+}
+
+extern uint64_t
+EXT_cycles_to_ns(uint32_t cycles)
+{
+    static double ns_per_cycle;
+    struct timespec delay = { 0, 20000000 };
+    uint64_t t0, c0;
+
+    if (ns_per_cycle == 0.0) {
+        t0 = monotonic_ns();
+        c0 = __rdtsc();
+        nanosleep(&delay, NULL);
+        ns_per_cycle = (double)(monotonic_ns() - t0) / (double)(__rdtsc() - c0);
+    }
+    return (uint64_t)(cycles * ns_per_cycle);
+}
+#else
+/* one cycle is one nanosecond of the monotonic clock */
+extern uint32_t
+EXT_cycles(void)
+{
+    return (uint32_t)monotonic_ns();
+}
+
+extern uint64_t
+EXT_cycles_to_ns(uint32_t cycles)
+{
+    return cycles;
+}
+#endif
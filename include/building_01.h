@@ -1,5 +1,7 @@
 #pragma once
-static const int building_01_vertices[] = {
+/* grey texels, stored in the video buffer format */
+#define G_(g) PL_TEXEL_GREY(g)
+static const int16_t building_01_vertices[] = {
 -228,-152,400,0,
 -228,152,400,0,
 -228,-152,-400,0,
@@ -937,73 +939,73 @@ static const int building_01_vertices[] = {
 101,-302,-244,0,
 98,-302,-258,0,
 };
-static const int building_01Sign_NoSmokingtexturedata[1024] = {
-194,153,153,156,150,136,139,143,136,132,134,145,145,143,142,155,161,160,165,162,150,140,148,144,136,133,138,150,152,148,145,187,142,109,131,143,148,140,144,150,152,147,147,157,158,158,163,168,165,163,171,175,168,157,163,162,156,149,145,150,144,124,110,137,139,181,209,227,234,230,230,225,228,231,232,230,229,226,221,226,231,228,226,222,209,220,227,226,222,224,226,225,216,199,181,134,137,174,232,228,232,172,91,130,149,158,160,200,154,154,111,169,232,214,152,151,110,156,227,228,146,114,217,219,219,225,174,133,136,175,230,227,227,215,112,217,146,103,116,199,143,148,112,212,227,218,142,148,110,210,224,220,104,84,209,219,218,222,175,131,137,178,229,227,228,221,125,228,147,100,109,200,137,221,107,147,232,211,127,214,116,150,229,202,69,88,180,221,218,221,178,132,137,178,229,227,227,221,124,219,141,147,157,191,122,173,104,143,232,205,124,172,110,144,233,143,107,97,137,224,218,221,178,132,138,179,233,229,229,226,196,228,198,197,204,218,194,194,164,221,225,222,204,199,181,219,227,206,213,215,211,219,224,222,179,133,138,185,183,188,191,197,173,150,219,231,197,135,184,160,222,160,212,166,171,204,193,184,159,177,156,206,181,189,133,173,184,133,138,189,137,96,149,126,128,107,152,233,136,120,174,96,139,98,166,129,130,147,149,132,120,128,76,143,136,111,133,178,184,134,139,188,161,95,139,106,174,159,152,234,178,121,179,120,74,106,132,159,158,105,89,138,135,130,71,110,129,75,167,185,187,134,139,188,161,147,116,119,167,151,153,226,213,119,127,119,163,96,133,145,148,104,105,90,119,126,81,95,112,91,117,143,192,135,138,187,168,164,144,158,149,123,191,230,146,84,170,118,208,103,200,116,127,166,147,147,79,129,103,132,137,165,93,162,189,134,138,182,222,220,220,218,219,216,227,225,220,202,223,201,207,213,215,199,207,217,205,215,196,203,210,213,210,214,209,215,182,134,140,181,227,224,222,223,223,224,223,227,193,81,202,88,75,180,156,77,156,196,97,215,147,162,223,216,216,216,215,219,181,134,138,181,224,222,222,222,222,222,224,231,151,95,189,101,128,152,157,146,202,151,93,204,153,174,220,215,215,214,215,218,181,133,137,181,225,223,222,221,223,222,223,224,145,103,127,95,102,170,147,137,192,148,106,148,168,189,218,215,214,214,214,218,180,132,138,179,226,222,221,221,223,223,224,210,75,118,119,87,135,134,140,115,173,79,118,128,181,190,218,216,214,213,214,218,179,132,137,178,224,222,222,222,223,224,224,217,156,213,149,145,198,168,173,127,176,156,215,151,172,197,218,217,216,215,215,218,178,131,134,178,224,221,211,209,220,214,220,221,216,211,220,224,214,211,215,220,216,220,211,215,212,213,208,201,209,208,199,209,178,130,133,177,226,208,113,91,209,129,144,140,133,129,177,158,134,85,124,151,141,142,100,127,152,184,128,113,111,126,98,141,184,130,132,178,224,204,170,166,164,137,160,144,136,146,197,149,136,129,123,143,158,138,107,138,153,211,139,120,102,115,125,157,183,128,132,179,223,218,219,208,146,183,176,207,170,143,143,170,157,147,160,145,151,212,176,170,183,170,155,166,145,160,212,217,178,129,131,179,223,221,222,206,116,164,127,137,133,100,118,157,162,139,179,142,123,194,155,67,143,163,124,118,93,166,214,215,179,129,133,180,221,221,222,214,145,188,157,151,158,161,156,169,187,180,198,145,149,202,178,143,176,188,160,162,165,185,211,215,180,130,132,181,220,220,221,220,227,231,168,113,105,118,112,106,136,156,117,143,178,153,104,119,133,150,110,167,224,216,211,214,181,130,132,183,222,220,220,218,219,225,175,111,214,126,117,119,111,166,129,150,159,160,175,120,138,131,135,198,213,210,210,214,183,131,134,189,219,220,220,218,219,220,210,214,189,169,150,192,154,174,159,178,200,144,166,158,150,196,212,211,212,211,210,213,188,133,136,189,222,221,220,222,223,221,221,223,209,173,107,136,133,110,82,148,207,111,133,142,105,199,216,212,212,211,211,215,189,134,139,182,208,226,233,236,240,235,234,235,238,229,227,225,228,218,219,222,230,226,217,221,217,224,228,227,224,224,215,198,183,134,142,109,131,143,148,140,142,149,151,146,147,157,159,158,161,169,167,164,170,175,167,157,165,162,155,148,145,150,144,124,110,137,194,153,153,156,150,136,139,143,136,132,134,145,145,143,142,155,161,160,165,162,150,140,148,144,136,133,138,150,152,148,145,187,};
+static const PL_TEXEL building_01Sign_NoSmokingtexturedata[1024] = {
+G_(194),G_(153),G_(153),G_(156),G_(150),G_(136),G_(139),G_(143),G_(136),G_(132),G_(134),G_(145),G_(145),G_(143),G_(142),G_(155),G_(161),G_(160),G_(165),G_(162),G_(150),G_(140),G_(148),G_(144),G_(136),G_(133),G_(138),G_(150),G_(152),G_(148),G_(145),G_(187),G_(142),G_(109),G_(131),G_(143),G_(148),G_(140),G_(144),G_(150),G_(152),G_(147),G_(147),G_(157),G_(158),G_(158),G_(163),G_(168),G_(165),G_(163),G_(171),G_(175),G_(168),G_(157),G_(163),G_(162),G_(156),G_(149),G_(145),G_(150),G_(144),G_(124),G_(110),G_(137),G_(139),G_(181),G_(209),G_(227),G_(234),G_(230),G_(230),G_(225),G_(228),G_(231),G_(232),G_(230),G_(229),G_(226),G_(221),G_(226),G_(231),G_(228),G_(226),G_(222),G_(209),G_(220),G_(227),G_(226),G_(222),G_(224),G_(226),G_(225),G_(216),G_(199),G_(181),G_(134),G_(137),G_(174),G_(232),G_(228),G_(232),G_(172),G_(91),G_(130),G_(149),G_(158),G_(160),G_(200),G_(154),G_(154),G_(111),G_(169),G_(232),G_(214),G_(152),G_(151),G_(110),G_(156),G_(227),G_(228),G_(146),G_(114),G_(217),G_(219),G_(219),G_(225),G_(174),G_(133),G_(136),G_(175),G_(230),G_(227),G_(227),G_(215),G_(112),G_(217),G_(146),G_(103),G_(116),G_(199),G_(143),G_(148),G_(112),G_(212),G_(227),G_(218),G_(142),G_(148),G_(110),G_(210),G_(224),G_(220),G_(104),G_(84),G_(209),G_(219),G_(218),G_(222),G_(175),G_(131),G_(137),G_(178),G_(229),G_(227),G_(228),G_(221),G_(125),G_(228),G_(147),G_(100),G_(109),G_(200),G_(137),G_(221),G_(107),G_(147),G_(232),G_(211),G_(127),G_(214),G_(116),G_(150),G_(229),G_(202),G_(69),G_(88),G_(180),G_(221),G_(218),G_(221),G_(178),G_(132),G_(137),G_(178),G_(229),G_(227),G_(227),G_(221),G_(124),G_(219),G_(141),G_(147),G_(157),G_(191),G_(122),G_(173),G_(104),G_(143),G_(232),G_(205),G_(124),G_(172),G_(110),G_(144),G_(233),G_(143),G_(107),G_(97),G_(137),G_(224),G_(218),G_(221),G_(178),G_(132),G_(138),G_(179),G_(233),G_(229),G_(229),G_(226),G_(196),G_(228),G_(198),G_(197),G_(204),G_(218),G_(194),G_(194),G_(164),G_(221),G_(225),G_(222),G_(204),G_(199),G_(181),G_(219),G_(227),G_(206),G_(213),G_(215),G_(211),G_(219),G_(224),G_(222),G_(179),G_(133),G_(138),G_(185),G_(183),G_(188),G_(191),G_(197),G_(173),G_(150),G_(219),G_(231),G_(197),G_(135),G_(184),G_(160),G_(222),G_(160),G_(212),G_(166),G_(171),G_(204),G_(193),G_(184),G_(159),G_(177),G_(156),G_(206),G_(181),G_(189),G_(133),G_(173),G_(184),G_(133),G_(138),G_(189),G_(137),G_(96),G_(149),G_(126),G_(128),G_(107),G_(152),G_(233),G_(136),G_(120),G_(174),G_(96),G_(139),G_(98),G_(166),G_(129),G_(130),G_(147),G_(149),G_(132),G_(120),G_(128),G_(76),G_(143),G_(136),G_(111),G_(133),G_(178),G_(184),G_(134),G_(139),G_(188),G_(161),G_(95),G_(139),G_(106),G_(174),G_(159),G_(152),G_(234),G_(178),G_(121),G_(179),G_(120),G_(74),G_(106),G_(132),G_(159),G_(158),G_(105),G_(89),G_(138),G_(135),G_(130),G_(71),G_(110),G_(129),G_(75),G_(167),G_(185),G_(187),G_(134),G_(139),G_(188),G_(161),G_(147),G_(116),G_(119),G_(167),G_(151),G_(153),G_(226),G_(213),G_(119),G_(127),G_(119),G_(163),G_(96),G_(133),G_(145),G_(148),G_(104),G_(105),G_(90),G_(119),G_(126),G_(81),G_(95),G_(112),G_(91),G_(117),G_(143),G_(192),G_(135),G_(138),G_(187),G_(168),G_(164),G_(144),G_(158),G_(149),G_(123),G_(191),G_(230),G_(146),G_(84),G_(170),G_(118),G_(208),G_(103),G_(200),G_(116),G_(127),G_(166),G_(147),G_(147),G_(79),G_(129),G_(103),G_(132),G_(137),G_(165),G_(93),G_(162),G_(189),G_(134),G_(138),G_(182),G_(222),G_(220),G_(220),G_(218),G_(219),G_(216),G_(227),G_(225),G_(220),G_(202),G_(223),G_(201),G_(207),G_(213),G_(215),G_(199),G_(207),G_(217),G_(205),G_(215),G_(196),G_(203),G_(210),G_(213),G_(210),G_(214),G_(209),G_(215),G_(182),G_(134),G_(140),G_(181),G_(227),G_(224),G_(222),G_(223),G_(223),G_(224),G_(223),G_(227),G_(193),G_(81),G_(202),G_(88),G_(75),G_(180),G_(156),G_(77),G_(156),G_(196),G_(97),G_(215),G_(147),G_(162),G_(223),G_(216),G_(216),G_(216),G_(215),G_(219),G_(181),G_(134),G_(138),G_(181),G_(224),G_(222),G_(222),G_(222),G_(222),G_(222),G_(224),G_(231),G_(151),G_(95),G_(189),G_(101),G_(128),G_(152),G_(157),G_(146),G_(202),G_(151),G_(93),G_(204),G_(153),G_(174),G_(220),G_(215),G_(215),G_(214),G_(215),G_(218),G_(181),G_(133),G_(137),G_(181),G_(225),G_(223),G_(222),G_(221),G_(223),G_(222),G_(223),G_(224),G_(145),G_(103),G_(127),G_(95),G_(102),G_(170),G_(147),G_(137),G_(192),G_(148),G_(106),G_(148),G_(168),G_(189),G_(218),G_(215),G_(214),G_(214),G_(214),G_(218),G_(180),G_(132),G_(138),G_(179),G_(226),G_(222),G_(221),G_(221),G_(223),G_(223),G_(224),G_(210),G_(75),G_(118),G_(119),G_(87),G_(135),G_(134),G_(140),G_(115),G_(173),G_(79),G_(118),G_(128),G_(181),G_(190),G_(218),G_(216),G_(214),G_(213),G_(214),G_(218),G_(179),G_(132),G_(137),G_(178),G_(224),G_(222),G_(222),G_(222),G_(223),G_(224),G_(224),G_(217),G_(156),G_(213),G_(149),G_(145),G_(198),G_(168),G_(173),G_(127),G_(176),G_(156),G_(215),G_(151),G_(172),G_(197),G_(218),G_(217),G_(216),G_(215),G_(215),G_(218),G_(178),G_(131),G_(134),G_(178),G_(224),G_(221),G_(211),G_(209),G_(220),G_(214),G_(220),G_(221),G_(216),G_(211),G_(220),G_(224),G_(214),G_(211),G_(215),G_(220),G_(216),G_(220),G_(211),G_(215),G_(212),G_(213),G_(208),G_(201),G_(209),G_(208),G_(199),G_(209),G_(178),G_(130),G_(133),G_(177),G_(226),G_(208),G_(113),G_(91),G_(209),G_(129),G_(144),G_(140),G_(133),G_(129),G_(177),G_(158),G_(134),G_(85),G_(124),G_(151),G_(141),G_(142),G_(100),G_(127),G_(152),G_(184),G_(128),G_(113),G_(111),G_(126),G_(98),G_(141),G_(184),G_(130),G_(132),G_(178),G_(224),G_(204),G_(170),G_(166),G_(164),G_(137),G_(160),G_(144),G_(136),G_(146),G_(197),G_(149),G_(136),G_(129),G_(123),G_(143),G_(158),G_(138),G_(107),G_(138),G_(153),G_(211),G_(139),G_(120),G_(102),G_(115),G_(125),G_(157),G_(183),G_(128),G_(132),G_(179),G_(223),G_(218),G_(219),G_(208),G_(146),G_(183),G_(176),G_(207),G_(170),G_(143),G_(143),G_(170),G_(157),G_(147),G_(160),G_(145),G_(151),G_(212),G_(176),G_(170),G_(183),G_(170),G_(155),G_(166),G_(145),G_(160),G_(212),G_(217),G_(178),G_(129),G_(131),G_(179),G_(223),G_(221),G_(222),G_(206),G_(116),G_(164),G_(127),G_(137),G_(133),G_(100),G_(118),G_(157),G_(162),G_(139),G_(179),G_(142),G_(123),G_(194),G_(155),G_(67),G_(143),G_(163),G_(124),G_(118),G_(93),G_(166),G_(214),G_(215),G_(179),G_(129),G_(133),G_(180),G_(221),G_(221),G_(222),G_(214),G_(145),G_(188),G_(157),G_(151),G_(158),G_(161),G_(156),G_(169),G_(187),G_(180),G_(198),G_(145),G_(149),G_(202),G_(178),G_(143),G_(176),G_(188),G_(160),G_(162),G_(165),G_(185),G_(211),G_(215),G_(180),G_(130),G_(132),G_(181),G_(220),G_(220),G_(221),G_(220),G_(227),G_(231),G_(168),G_(113),G_(105),G_(118),G_(112),G_(106),G_(136),G_(156),G_(117),G_(143),G_(178),G_(153),G_(104),G_(119),G_(133),G_(150),G_(110),G_(167),G_(224),G_(216),G_(211),G_(214),G_(181),G_(130),G_(132),G_(183),G_(222),G_(220),G_(220),G_(218),G_(219),G_(225),G_(175),G_(111),G_(214),G_(126),G_(117),G_(119),G_(111),G_(166),G_(129),G_(150),G_(159),G_(160),G_(175),G_(120),G_(138),G_(131),G_(135),G_(198),G_(213),G_(210),G_(210),G_(214),G_(183),G_(131),G_(134),G_(189),G_(219),G_(220),G_(220),G_(218),G_(219),G_(220),G_(210),G_(214),G_(189),G_(169),G_(150),G_(192),G_(154),G_(174),G_(159),G_(178),G_(200),G_(144),G_(166),G_(158),G_(150),G_(196),G_(212),G_(211),G_(212),G_(211),G_(210),G_(213),G_(188),G_(133),G_(136),G_(189),G_(222),G_(221),G_(220),G_(222),G_(223),G_(221),G_(221),G_(223),G_(209),G_(173),G_(107),G_(136),G_(133),G_(110),G_(82),G_(148),G_(207),G_(111),G_(133),G_(142),G_(105),G_(199),G_(216),G_(212),G_(212),G_(211),G_(211),G_(215),G_(189),G_(134),G_(139),G_(182),G_(208),G_(226),G_(233),G_(236),G_(240),G_(235),G_(234),G_(235),G_(238),G_(229),G_(227),G_(225),G_(228),G_(218),G_(219),G_(222),G_(230),G_(226),G_(217),G_(221),G_(217),G_(224),G_(228),G_(227),G_(224),G_(224),G_(215),G_(198),G_(183),G_(134),G_(142),G_(109),G_(131),G_(143),G_(148),G_(140),G_(142),G_(149),G_(151),G_(146),G_(147),G_(157),G_(159),G_(158),G_(161),G_(169),G_(167),G_(164),G_(170),G_(175),G_(167),G_(157),G_(165),G_(162),G_(155),G_(148),G_(145),G_(150),G_(144),G_(124),G_(110),G_(137),G_(194),G_(153),G_(153),G_(156),G_(150),G_(136),G_(139),G_(143),G_(136),G_(132),G_(134),G_(145),G_(145),G_(143),G_(142),G_(155),G_(161),G_(160),G_(165),G_(162),G_(150),G_(140),G_(148),G_(144),G_(136),G_(133),G_(138),G_(150),G_(152),G_(148),G_(145),G_(187),};
 static const struct PL_TEX_CONST building_01Sign_NoSmokingtexture = {
 .data = building_01Sign_NoSmokingtexturedata ,
 };
-static const int building_01brick_red_04texturedata[1024] = {
-147,121,114,115,114,112,118,121,126,122,119,120,119,136,116,114,115,118,117,119,123,123,123,121,122,130,148,128,126,127,129,139,137,82,85,87,84,78,80,78,79,81,84,86,90,138,87,77,74,76,76,76,74,70,68,68,70,85,150,74,70,73,69,107,143,88,86,87,86,83,87,84,84,83,86,82,92,142,83,77,76,77,79,78,74,75,78,74,71,86,148,78,73,72,67,107,144,92,91,86,90,88,87,86,87,88,89,87,93,140,89,82,82,90,88,86,87,85,85,85,81,94,151,91,85,83,84,117,138,131,129,129,132,136,139,140,129,130,129,135,133,141,138,137,136,134,134,142,147,145,142,141,142,145,149,139,144,143,142,142,86,87,86,89,90,93,113,119,73,75,74,79,79,75,81,81,74,70,73,121,127,91,90,88,90,92,90,90,89,85,87,86,84,85,83,83,85,86,112,129,68,71,71,76,79,71,80,84,73,76,68,117,130,85,87,84,87,87,90,87,84,82,85,84,86,84,85,83,89,83,112,131,67,70,72,78,76,72,81,79,73,80,71,126,133,83,89,86,88,87,91,88,84,86,86,88,150,144,146,141,132,127,130,147,133,131,128,132,135,138,137,138,136,135,134,140,132,119,120,123,129,118,116,116,118,122,130,134,144,100,98,100,98,97,95,96,101,102,96,97,122,137,83,83,83,81,83,73,74,77,73,94,137,79,83,82,79,86,86,84,141,87,85,86,84,87,88,89,95,96,87,84,114,137,66,71,71,70,70,64,68,72,72,96,146,76,80,77,79,83,82,79,144,92,90,87,91,88,89,91,97,99,92,86,118,140,65,74,78,76,71,67,69,73,77,101,141,76,77,79,79,83,86,82,139,120,120,115,118,124,125,128,116,114,116,116,130,138,109,116,122,123,123,128,127,121,115,122,136,112,106,111,108,107,114,116,76,78,77,69,70,67,110,131,78,84,82,83,79,79,79,79,84,82,81,125,132,88,87,83,89,88,86,85,84,86,88,85,73,69,72,67,66,62,99,124,70,74,78,77,75,78,75,75,79,75,72,122,128,83,80,80,82,80,82,85,86,85,88,83,81,75,80,75,78,70,108,130,76,81,80,79,78,80,75,75,76,73,73,120,128,82,83,82,82,82,84,88,88,86,86,85,129,112,110,111,118,122,137,138,120,121,124,118,128,128,117,115,114,111,112,139,140,116,116,122,115,115,112,113,113,113,114,122,133,70,70,72,73,75,73,79,78,73,71,64,108,129,93,94,94,97,97,101,104,91,92,140,90,80,85,79,83,85,77,121,132,67,67,72,72,69,70,74,70,65,67,61,102,129,89,95,96,94,90,94,97,89,91,149,88,77,79,75,78,80,75,123,138,70,70,72,75,76,72,70,74,66,66,68,104,135,88,92,100,97,97,95,89,90,95,144,87,73,74,74,75,77,75,121,145,126,126,123,122,121,125,133,127,122,121,124,140,141,125,125,126,121,126,129,130,122,123,136,121,114,116,116,116,115,114,129,76,83,81,85,81,83,92,145,96,84,86,87,82,84,90,98,97,85,83,109,138,84,82,80,85,88,83,84,85,81,83,76,77,80,74,75,76,76,85,143,83,72,71,72,72,77,76,80,86,78,71,103,141,76,77,76,77,78,75,72,72,73,80,77,72,77,72,74,76,74,86,146,79,71,76,75,76,76,78,74,72,74,73,102,144,76,75,75,77,76,75,75,72,72,77,72,136,135,129,131,131,126,130,151,121,119,124,123,125,128,128,127,127,126,132,141,154,126,127,130,130,129,131,130,132,128,134,136,137,92,95,93,100,99,96,92,97,95,95,97,96,145,118,102,104,106,107,107,107,106,105,100,99,99,105,103,100,98,99,148,124,62,66,70,66,65,65,64,69,68,73,65,66,127,88,73,77,75,77,78,78,80,77,79,76,80,79,79,79,75,80,137,120,63,66,74,68,66,66,65,70,68,63,62,67,129,91,74,79,78,76,79,78,77,73,75,78,76,78,73,75,78,75,135,144,103,106,111,114,114,111,106,110,107,105,105,112,150,118,104,106,110,109,110,109,107,110,119,110,111,107,112,119,111,111,153,110,117,125,119,117,114,134,153,119,118,115,120,124,121,125,127,129,126,128,147,154,121,121,121,120,119,121,122,122,120,120,116,76,79,82,79,73,70,100,129,77,82,80,85,85,88,85,83,84,82,94,125,134,69,68,71,71,70,68,68,70,68,71,72,81,81,86,78,74,72,105,131,82,84,81,90,91,97,94,87,91,96,101,120,135,71,79,77,74,80,75,73,75,75,73,72,};
+static const PL_TEXEL building_01brick_red_04texturedata[1024] = {
+G_(147),G_(121),G_(114),G_(115),G_(114),G_(112),G_(118),G_(121),G_(126),G_(122),G_(119),G_(120),G_(119),G_(136),G_(116),G_(114),G_(115),G_(118),G_(117),G_(119),G_(123),G_(123),G_(123),G_(121),G_(122),G_(130),G_(148),G_(128),G_(126),G_(127),G_(129),G_(139),G_(137),G_(82),G_(85),G_(87),G_(84),G_(78),G_(80),G_(78),G_(79),G_(81),G_(84),G_(86),G_(90),G_(138),G_(87),G_(77),G_(74),G_(76),G_(76),G_(76),G_(74),G_(70),G_(68),G_(68),G_(70),G_(85),G_(150),G_(74),G_(70),G_(73),G_(69),G_(107),G_(143),G_(88),G_(86),G_(87),G_(86),G_(83),G_(87),G_(84),G_(84),G_(83),G_(86),G_(82),G_(92),G_(142),G_(83),G_(77),G_(76),G_(77),G_(79),G_(78),G_(74),G_(75),G_(78),G_(74),G_(71),G_(86),G_(148),G_(78),G_(73),G_(72),G_(67),G_(107),G_(144),G_(92),G_(91),G_(86),G_(90),G_(88),G_(87),G_(86),G_(87),G_(88),G_(89),G_(87),G_(93),G_(140),G_(89),G_(82),G_(82),G_(90),G_(88),G_(86),G_(87),G_(85),G_(85),G_(85),G_(81),G_(94),G_(151),G_(91),G_(85),G_(83),G_(84),G_(117),G_(138),G_(131),G_(129),G_(129),G_(132),G_(136),G_(139),G_(140),G_(129),G_(130),G_(129),G_(135),G_(133),G_(141),G_(138),G_(137),G_(136),G_(134),G_(134),G_(142),G_(147),G_(145),G_(142),G_(141),G_(142),G_(145),G_(149),G_(139),G_(144),G_(143),G_(142),G_(142),G_(86),G_(87),G_(86),G_(89),G_(90),G_(93),G_(113),G_(119),G_(73),G_(75),G_(74),G_(79),G_(79),G_(75),G_(81),G_(81),G_(74),G_(70),G_(73),G_(121),G_(127),G_(91),G_(90),G_(88),G_(90),G_(92),G_(90),G_(90),G_(89),G_(85),G_(87),G_(86),G_(84),G_(85),G_(83),G_(83),G_(85),G_(86),G_(112),G_(129),G_(68),G_(71),G_(71),G_(76),G_(79),G_(71),G_(80),G_(84),G_(73),G_(76),G_(68),G_(117),G_(130),G_(85),G_(87),G_(84),G_(87),G_(87),G_(90),G_(87),G_(84),G_(82),G_(85),G_(84),G_(86),G_(84),G_(85),G_(83),G_(89),G_(83),G_(112),G_(131),G_(67),G_(70),G_(72),G_(78),G_(76),G_(72),G_(81),G_(79),G_(73),G_(80),G_(71),G_(126),G_(133),G_(83),G_(89),G_(86),G_(88),G_(87),G_(91),G_(88),G_(84),G_(86),G_(86),G_(88),G_(150),G_(144),G_(146),G_(141),G_(132),G_(127),G_(130),G_(147),G_(133),G_(131),G_(128),G_(132),G_(135),G_(138),G_(137),G_(138),G_(136),G_(135),G_(134),G_(140),G_(132),G_(119),G_(120),G_(123),G_(129),G_(118),G_(116),G_(116),G_(118),G_(122),G_(130),G_(134),G_(144),G_(100),G_(98),G_(100),G_(98),G_(97),G_(95),G_(96),G_(101),G_(102),G_(96),G_(97),G_(122),G_(137),G_(83),G_(83),G_(83),G_(81),G_(83),G_(73),G_(74),G_(77),G_(73),G_(94),G_(137),G_(79),G_(83),G_(82),G_(79),G_(86),G_(86),G_(84),G_(141),G_(87),G_(85),G_(86),G_(84),G_(87),G_(88),G_(89),G_(95),G_(96),G_(87),G_(84),G_(114),G_(137),G_(66),G_(71),G_(71),G_(70),G_(70),G_(64),G_(68),G_(72),G_(72),G_(96),G_(146),G_(76),G_(80),G_(77),G_(79),G_(83),G_(82),G_(79),G_(144),G_(92),G_(90),G_(87),G_(91),G_(88),G_(89),G_(91),G_(97),G_(99),G_(92),G_(86),G_(118),G_(140),G_(65),G_(74),G_(78),G_(76),G_(71),G_(67),G_(69),G_(73),G_(77),G_(101),G_(141),G_(76),G_(77),G_(79),G_(79),G_(83),G_(86),G_(82),G_(139),G_(120),G_(120),G_(115),G_(118),G_(124),G_(125),G_(128),G_(116),G_(114),G_(116),G_(116),G_(130),G_(138),G_(109),G_(116),G_(122),G_(123),G_(123),G_(128),G_(127),G_(121),G_(115),G_(122),G_(136),G_(112),G_(106),G_(111),G_(108),G_(107),G_(114),G_(116),G_(76),G_(78),G_(77),G_(69),G_(70),G_(67),G_(110),G_(131),G_(78),G_(84),G_(82),G_(83),G_(79),G_(79),G_(79),G_(79),G_(84),G_(82),G_(81),G_(125),G_(132),G_(88),G_(87),G_(83),G_(89),G_(88),G_(86),G_(85),G_(84),G_(86),G_(88),G_(85),G_(73),G_(69),G_(72),G_(67),G_(66),G_(62),G_(99),G_(124),G_(70),G_(74),G_(78),G_(77),G_(75),G_(78),G_(75),G_(75),G_(79),G_(75),G_(72),G_(122),G_(128),G_(83),G_(80),G_(80),G_(82),G_(80),G_(82),G_(85),G_(86),G_(85),G_(88),G_(83),G_(81),G_(75),G_(80),G_(75),G_(78),G_(70),G_(108),G_(130),G_(76),G_(81),G_(80),G_(79),G_(78),G_(80),G_(75),G_(75),G_(76),G_(73),G_(73),G_(120),G_(128),G_(82),G_(83),G_(82),G_(82),G_(82),G_(84),G_(88),G_(88),G_(86),G_(86),G_(85),G_(129),G_(112),G_(110),G_(111),G_(118),G_(122),G_(137),G_(138),G_(120),G_(121),G_(124),G_(118),G_(128),G_(128),G_(117),G_(115),G_(114),G_(111),G_(112),G_(139),G_(140),G_(116),G_(116),G_(122),G_(115),G_(115),G_(112),G_(113),G_(113),G_(113),G_(114),G_(122),G_(133),G_(70),G_(70),G_(72),G_(73),G_(75),G_(73),G_(79),G_(78),G_(73),G_(71),G_(64),G_(108),G_(129),G_(93),G_(94),G_(94),G_(97),G_(97),G_(101),G_(104),G_(91),G_(92),G_(140),G_(90),G_(80),G_(85),G_(79),G_(83),G_(85),G_(77),G_(121),G_(132),G_(67),G_(67),G_(72),G_(72),G_(69),G_(70),G_(74),G_(70),G_(65),G_(67),G_(61),G_(102),G_(129),G_(89),G_(95),G_(96),G_(94),G_(90),G_(94),G_(97),G_(89),G_(91),G_(149),G_(88),G_(77),G_(79),G_(75),G_(78),G_(80),G_(75),G_(123),G_(138),G_(70),G_(70),G_(72),G_(75),G_(76),G_(72),G_(70),G_(74),G_(66),G_(66),G_(68),G_(104),G_(135),G_(88),G_(92),G_(100),G_(97),G_(97),G_(95),G_(89),G_(90),G_(95),G_(144),G_(87),G_(73),G_(74),G_(74),G_(75),G_(77),G_(75),G_(121),G_(145),G_(126),G_(126),G_(123),G_(122),G_(121),G_(125),G_(133),G_(127),G_(122),G_(121),G_(124),G_(140),G_(141),G_(125),G_(125),G_(126),G_(121),G_(126),G_(129),G_(130),G_(122),G_(123),G_(136),G_(121),G_(114),G_(116),G_(116),G_(116),G_(115),G_(114),G_(129),G_(76),G_(83),G_(81),G_(85),G_(81),G_(83),G_(92),G_(145),G_(96),G_(84),G_(86),G_(87),G_(82),G_(84),G_(90),G_(98),G_(97),G_(85),G_(83),G_(109),G_(138),G_(84),G_(82),G_(80),G_(85),G_(88),G_(83),G_(84),G_(85),G_(81),G_(83),G_(76),G_(77),G_(80),G_(74),G_(75),G_(76),G_(76),G_(85),G_(143),G_(83),G_(72),G_(71),G_(72),G_(72),G_(77),G_(76),G_(80),G_(86),G_(78),G_(71),G_(103),G_(141),G_(76),G_(77),G_(76),G_(77),G_(78),G_(75),G_(72),G_(72),G_(73),G_(80),G_(77),G_(72),G_(77),G_(72),G_(74),G_(76),G_(74),G_(86),G_(146),G_(79),G_(71),G_(76),G_(75),G_(76),G_(76),G_(78),G_(74),G_(72),G_(74),G_(73),G_(102),G_(144),G_(76),G_(75),G_(75),G_(77),G_(76),G_(75),G_(75),G_(72),G_(72),G_(77),G_(72),G_(136),G_(135),G_(129),G_(131),G_(131),G_(126),G_(130),G_(151),G_(121),G_(119),G_(124),G_(123),G_(125),G_(128),G_(128),G_(127),G_(127),G_(126),G_(132),G_(141),G_(154),G_(126),G_(127),G_(130),G_(130),G_(129),G_(131),G_(130),G_(132),G_(128),G_(134),G_(136),G_(137),G_(92),G_(95),G_(93),G_(100),G_(99),G_(96),G_(92),G_(97),G_(95),G_(95),G_(97),G_(96),G_(145),G_(118),G_(102),G_(104),G_(106),G_(107),G_(107),G_(107),G_(106),G_(105),G_(100),G_(99),G_(99),G_(105),G_(103),G_(100),G_(98),G_(99),G_(148),G_(124),G_(62),G_(66),G_(70),G_(66),G_(65),G_(65),G_(64),G_(69),G_(68),G_(73),G_(65),G_(66),G_(127),G_(88),G_(73),G_(77),G_(75),G_(77),G_(78),G_(78),G_(80),G_(77),G_(79),G_(76),G_(80),G_(79),G_(79),G_(79),G_(75),G_(80),G_(137),G_(120),G_(63),G_(66),G_(74),G_(68),G_(66),G_(66),G_(65),G_(70),G_(68),G_(63),G_(62),G_(67),G_(129),G_(91),G_(74),G_(79),G_(78),G_(76),G_(79),G_(78),G_(77),G_(73),G_(75),G_(78),G_(76),G_(78),G_(73),G_(75),G_(78),G_(75),G_(135),G_(144),G_(103),G_(106),G_(111),G_(114),G_(114),G_(111),G_(106),G_(110),G_(107),G_(105),G_(105),G_(112),G_(150),G_(118),G_(104),G_(106),G_(110),G_(109),G_(110),G_(109),G_(107),G_(110),G_(119),G_(110),G_(111),G_(107),G_(112),G_(119),G_(111),G_(111),G_(153),G_(110),G_(117),G_(125),G_(119),G_(117),G_(114),G_(134),G_(153),G_(119),G_(118),G_(115),G_(120),G_(124),G_(121),G_(125),G_(127),G_(129),G_(126),G_(128),G_(147),G_(154),G_(121),G_(121),G_(121),G_(120),G_(119),G_(121),G_(122),G_(122),G_(120),G_(120),G_(116),G_(76),G_(79),G_(82),G_(79),G_(73),G_(70),G_(100),G_(129),G_(77),G_(82),G_(80),G_(85),G_(85),G_(88),G_(85),G_(83),G_(84),G_(82),G_(94),G_(125),G_(134),G_(69),G_(68),G_(71),G_(71),G_(70),G_(68),G_(68),G_(70),G_(68),G_(71),G_(72),G_(81),G_(81),G_(86),G_(78),G_(74),G_(72),G_(105),G_(131),G_(82),G_(84),G_(81),G_(90),G_(91),G_(97),G_(94),G_(87),G_(91),G_(96),G_(101),G_(120),G_(135),G_(71),G_(79),G_(77),G_(74),G_(80),G_(75),G_(73),G_(75),G_(75),G_(73),G_(72),};
 static const struct PL_TEX_CONST building_01brick_red_04texture = {
 .data = building_01brick_red_04texturedata ,
 };
-static const int building_01door_shed_atexturedata[1024] = {
-69,79,78,77,76,77,76,77,76,76,77,76,76,77,77,77,78,77,77,78,78,78,78,78,77,78,78,79,78,80,78,76,80,93,92,90,91,91,89,89,89,90,89,89,90,91,91,90,91,91,91,91,92,92,91,91,93,92,93,92,93,94,93,91,79,93,100,98,98,98,96,96,96,96,95,96,97,97,96,97,98,98,97,98,98,98,98,98,98,98,99,98,99,100,99,98,84,84,105,107,106,105,104,104,104,103,103,102,103,103,103,103,104,104,104,104,105,105,104,104,105,105,104,106,105,105,106,106,86,96,109,111,111,110,109,109,110,109,109,109,109,109,109,109,110,110,109,110,111,112,112,113,113,113,113,111,111,110,111,108,103,114,113,114,114,114,115,115,114,114,113,113,114,114,114,115,115,114,116,116,116,107,52,50,53,51,92,112,114,113,112,110,103,118,116,117,118,117,117,117,117,118,117,117,118,117,118,118,118,119,121,121,123,108,33,36,40,35,89,118,118,117,116,113,109,121,120,121,122,122,123,122,122,123,123,123,122,121,121,122,122,121,121,122,126,111,36,38,40,36,91,117,121,118,118,117,110,124,124,124,124,124,121,123,124,125,125,125,124,123,122,122,121,122,122,123,128,115,39,40,40,37,96,122,124,120,120,117,111,126,126,126,126,126,123,124,125,125,125,126,126,125,124,123,120,124,125,125,129,114,35,36,34,32,98,126,123,121,120,120,113,128,128,128,129,128,127,127,126,126,127,128,128,127,126,123,119,126,128,127,130,117,39,41,45,40,103,127,123,124,123,122,114,131,130,130,130,130,129,129,129,129,130,131,130,131,131,125,121,129,130,128,131,121,55,60,60,53,107,127,125,125,124,124,114,132,130,131,130,130,129,128,131,130,131,131,132,132,132,130,123,131,132,131,129,125,97,91,90,95,122,126,119,122,123,125,114,134,133,133,133,132,132,133,132,132,133,133,133,133,132,131,126,132,132,132,129,127,129,129,129,128,126,125,125,125,126,122,109,132,135,134,132,132,132,133,134,133,133,133,133,133,134,131,120,132,133,133,134,135,135,135,133,132,132,131,129,129,127,124,124,119,135,134,127,132,133,132,135,135,135,135,135,135,136,132,122,134,135,135,135,132,136,137,136,135,135,132,131,133,135,135,117,116,134,136,134,135,134,133,135,136,137,137,137,137,137,134,133,137,139,138,136,130,137,139,137,137,138,135,134,133,132,132,115,131,135,135,134,136,135,135,136,134,133,138,139,139,139,137,135,138,136,139,139,140,139,139,138,138,138,135,137,135,134,134,118,133,135,135,136,137,138,138,139,138,138,139,139,141,140,138,136,139,137,136,139,140,141,141,139,140,138,136,136,137,135,133,126,134,136,137,137,137,138,138,139,139,139,140,141,141,141,140,138,140,139,132,137,142,140,141,141,140,138,137,139,139,137,137,126,136,136,136,137,137,137,138,139,139,139,140,141,140,140,140,140,141,140,141,141,141,141,143,142,142,139,137,141,141,139,138,127,136,137,136,137,138,136,137,140,140,140,141,142,146,144,140,141,140,140,142,142,142,141,143,144,144,142,137,144,142,140,142,128,135,136,137,138,138,137,138,139,140,141,141,142,145,143,142,140,140,140,141,142,142,140,142,143,143,134,132,140,140,140,142,126,135,136,137,136,139,138,139,140,141,141,142,141,141,142,143,141,141,141,141,141,142,142,142,142,140,133,131,139,141,140,138,121,130,133,132,129,131,132,133,135,141,132,123,136,136,131,135,139,140,130,133,143,138,137,137,141,139,134,127,134,126,137,138,124,138,137,130,104,103,118,132,136,144,127,115,135,127,120,133,132,139,129,130,139,132,137,142,138,139,142,128,109,114,137,128,107,107,107,102,96,99,104,109,106,102,105,110,108,101,99,109,111,109,113,110,99,103,108,109,104,103,104,100,97,102,106,99,114,89,91,94,97,96,97,97,95,93,96,97,100,102,100,99,99,102,102,100,98,97,97,98,97,97,97,97,96,97,96,96,122,85,94,95,97,97,97,98,98,98,98,98,99,102,100,100,102,102,101,101,100,99,99,100,98,98,98,97,96,96,96,97,89,89,96,97,97,96,98,99,99,99,100,100,101,100,100,99,99,101,101,100,98,98,98,98,97,96,97,96,96,96,97,97,81,92,95,94,93,93,95,95,95,94,94,94,95,95,95,96,97,97,96,95,95,95,97,96,96,95,95,95,95,94,95,95,162,160,156,159,150,144,145,144,143,143,146,143,139,139,144,146,142,141,143,143,143,143,144,148,145,142,141,143,144,147,153,154,};
+static const PL_TEXEL building_01door_shed_atexturedata[1024] = {
+G_(69),G_(79),G_(78),G_(77),G_(76),G_(77),G_(76),G_(77),G_(76),G_(76),G_(77),G_(76),G_(76),G_(77),G_(77),G_(77),G_(78),G_(77),G_(77),G_(78),G_(78),G_(78),G_(78),G_(78),G_(77),G_(78),G_(78),G_(79),G_(78),G_(80),G_(78),G_(76),G_(80),G_(93),G_(92),G_(90),G_(91),G_(91),G_(89),G_(89),G_(89),G_(90),G_(89),G_(89),G_(90),G_(91),G_(91),G_(90),G_(91),G_(91),G_(91),G_(91),G_(92),G_(92),G_(91),G_(91),G_(93),G_(92),G_(93),G_(92),G_(93),G_(94),G_(93),G_(91),G_(79),G_(93),G_(100),G_(98),G_(98),G_(98),G_(96),G_(96),G_(96),G_(96),G_(95),G_(96),G_(97),G_(97),G_(96),G_(97),G_(98),G_(98),G_(97),G_(98),G_(98),G_(98),G_(98),G_(98),G_(98),G_(98),G_(99),G_(98),G_(99),G_(100),G_(99),G_(98),G_(84),G_(84),G_(105),G_(107),G_(106),G_(105),G_(104),G_(104),G_(104),G_(103),G_(103),G_(102),G_(103),G_(103),G_(103),G_(103),G_(104),G_(104),G_(104),G_(104),G_(105),G_(105),G_(104),G_(104),G_(105),G_(105),G_(104),G_(106),G_(105),G_(105),G_(106),G_(106),G_(86),G_(96),G_(109),G_(111),G_(111),G_(110),G_(109),G_(109),G_(110),G_(109),G_(109),G_(109),G_(109),G_(109),G_(109),G_(109),G_(110),G_(110),G_(109),G_(110),G_(111),G_(112),G_(112),G_(113),G_(113),G_(113),G_(113),G_(111),G_(111),G_(110),G_(111),G_(108),G_(103),G_(114),G_(113),G_(114),G_(114),G_(114),G_(115),G_(115),G_(114),G_(114),G_(113),G_(113),G_(114),G_(114),G_(114),G_(115),G_(115),G_(114),G_(116),G_(116),G_(116),G_(107),G_(52),G_(50),G_(53),G_(51),G_(92),G_(112),G_(114),G_(113),G_(112),G_(110),G_(103),G_(118),G_(116),G_(117),G_(118),G_(117),G_(117),G_(117),G_(117),G_(118),G_(117),G_(117),G_(118),G_(117),G_(118),G_(118),G_(118),G_(119),G_(121),G_(121),G_(123),G_(108),G_(33),G_(36),G_(40),G_(35),G_(89),G_(118),G_(118),G_(117),G_(116),G_(113),G_(109),G_(121),G_(120),G_(121),G_(122),G_(122),G_(123),G_(122),G_(122),G_(123),G_(123),G_(123),G_(122),G_(121),G_(121),G_(122),G_(122),G_(121),G_(121),G_(122),G_(126),G_(111),G_(36),G_(38),G_(40),G_(36),G_(91),G_(117),G_(121),G_(118),G_(118),G_(117),G_(110),G_(124),G_(124),G_(124),G_(124),G_(124),G_(121),G_(123),G_(124),G_(125),G_(125),G_(125),G_(124),G_(123),G_(122),G_(122),G_(121),G_(122),G_(122),G_(123),G_(128),G_(115),G_(39),G_(40),G_(40),G_(37),G_(96),G_(122),G_(124),G_(120),G_(120),G_(117),G_(111),G_(126),G_(126),G_(126),G_(126),G_(126),G_(123),G_(124),G_(125),G_(125),G_(125),G_(126),G_(126),G_(125),G_(124),G_(123),G_(120),G_(124),G_(125),G_(125),G_(129),G_(114),G_(35),G_(36),G_(34),G_(32),G_(98),G_(126),G_(123),G_(121),G_(120),G_(120),G_(113),G_(128),G_(128),G_(128),G_(129),G_(128),G_(127),G_(127),G_(126),G_(126),G_(127),G_(128),G_(128),G_(127),G_(126),G_(123),G_(119),G_(126),G_(128),G_(127),G_(130),G_(117),G_(39),G_(41),G_(45),G_(40),G_(103),G_(127),G_(123),G_(124),G_(123),G_(122),G_(114),G_(131),G_(130),G_(130),G_(130),G_(130),G_(129),G_(129),G_(129),G_(129),G_(130),G_(131),G_(130),G_(131),G_(131),G_(125),G_(121),G_(129),G_(130),G_(128),G_(131),G_(121),G_(55),G_(60),G_(60),G_(53),G_(107),G_(127),G_(125),G_(125),G_(124),G_(124),G_(114),G_(132),G_(130),G_(131),G_(130),G_(130),G_(129),G_(128),G_(131),G_(130),G_(131),G_(131),G_(132),G_(132),G_(132),G_(130),G_(123),G_(131),G_(132),G_(131),G_(129),G_(125),G_(97),G_(91),G_(90),G_(95),G_(122),G_(126),G_(119),G_(122),G_(123),G_(125),G_(114),G_(134),G_(133),G_(133),G_(133),G_(132),G_(132),G_(133),G_(132),G_(132),G_(133),G_(133),G_(133),G_(133),G_(132),G_(131),G_(126),G_(132),G_(132),G_(132),G_(129),G_(127),G_(129),G_(129),G_(129),G_(128),G_(126),G_(125),G_(125),G_(125),G_(126),G_(122),G_(109),G_(132),G_(135),G_(134),G_(132),G_(132),G_(132),G_(133),G_(134),G_(133),G_(133),G_(133),G_(133),G_(133),G_(134),G_(131),G_(120),G_(132),G_(133),G_(133),G_(134),G_(135),G_(135),G_(135),G_(133),G_(132),G_(132),G_(131),G_(129),G_(129),G_(127),G_(124),G_(124),G_(119),G_(135),G_(134),G_(127),G_(132),G_(133),G_(132),G_(135),G_(135),G_(135),G_(135),G_(135),G_(135),G_(136),G_(132),G_(122),G_(134),G_(135),G_(135),G_(135),G_(132),G_(136),G_(137),G_(136),G_(135),G_(135),G_(132),G_(131),G_(133),G_(135),G_(135),G_(117),G_(116),G_(134),G_(136),G_(134),G_(135),G_(134),G_(133),G_(135),G_(136),G_(137),G_(137),G_(137),G_(137),G_(137),G_(134),G_(133),G_(137),G_(139),G_(138),G_(136),G_(130),G_(137),G_(139),G_(137),G_(137),G_(138),G_(135),G_(134),G_(133),G_(132),G_(132),G_(115),G_(131),G_(135),G_(135),G_(134),G_(136),G_(135),G_(135),G_(136),G_(134),G_(133),G_(138),G_(139),G_(139),G_(139),G_(137),G_(135),G_(138),G_(136),G_(139),G_(139),G_(140),G_(139),G_(139),G_(138),G_(138),G_(138),G_(135),G_(137),G_(135),G_(134),G_(134),G_(118),G_(133),G_(135),G_(135),G_(136),G_(137),G_(138),G_(138),G_(139),G_(138),G_(138),G_(139),G_(139),G_(141),G_(140),G_(138),G_(136),G_(139),G_(137),G_(136),G_(139),G_(140),G_(141),G_(141),G_(139),G_(140),G_(138),G_(136),G_(136),G_(137),G_(135),G_(133),G_(126),G_(134),G_(136),G_(137),G_(137),G_(137),G_(138),G_(138),G_(139),G_(139),G_(139),G_(140),G_(141),G_(141),G_(141),G_(140),G_(138),G_(140),G_(139),G_(132),G_(137),G_(142),G_(140),G_(141),G_(141),G_(140),G_(138),G_(137),G_(139),G_(139),G_(137),G_(137),G_(126),G_(136),G_(136),G_(136),G_(137),G_(137),G_(137),G_(138),G_(139),G_(139),G_(139),G_(140),G_(141),G_(140),G_(140),G_(140),G_(140),G_(141),G_(140),G_(141),G_(141),G_(141),G_(141),G_(143),G_(142),G_(142),G_(139),G_(137),G_(141),G_(141),G_(139),G_(138),G_(127),G_(136),G_(137),G_(136),G_(137),G_(138),G_(136),G_(137),G_(140),G_(140),G_(140),G_(141),G_(142),G_(146),G_(144),G_(140),G_(141),G_(140),G_(140),G_(142),G_(142),G_(142),G_(141),G_(143),G_(144),G_(144),G_(142),G_(137),G_(144),G_(142),G_(140),G_(142),G_(128),G_(135),G_(136),G_(137),G_(138),G_(138),G_(137),G_(138),G_(139),G_(140),G_(141),G_(141),G_(142),G_(145),G_(143),G_(142),G_(140),G_(140),G_(140),G_(141),G_(142),G_(142),G_(140),G_(142),G_(143),G_(143),G_(134),G_(132),G_(140),G_(140),G_(140),G_(142),G_(126),G_(135),G_(136),G_(137),G_(136),G_(139),G_(138),G_(139),G_(140),G_(141),G_(141),G_(142),G_(141),G_(141),G_(142),G_(143),G_(141),G_(141),G_(141),G_(141),G_(141),G_(142),G_(142),G_(142),G_(142),G_(140),G_(133),G_(131),G_(139),G_(141),G_(140),G_(138),G_(121),G_(130),G_(133),G_(132),G_(129),G_(131),G_(132),G_(133),G_(135),G_(141),G_(132),G_(123),G_(136),G_(136),G_(131),G_(135),G_(139),G_(140),G_(130),G_(133),G_(143),G_(138),G_(137),G_(137),G_(141),G_(139),G_(134),G_(127),G_(134),G_(126),G_(137),G_(138),G_(124),G_(138),G_(137),G_(130),G_(104),G_(103),G_(118),G_(132),G_(136),G_(144),G_(127),G_(115),G_(135),G_(127),G_(120),G_(133),G_(132),G_(139),G_(129),G_(130),G_(139),G_(132),G_(137),G_(142),G_(138),G_(139),G_(142),G_(128),G_(109),G_(114),G_(137),G_(128),G_(107),G_(107),G_(107),G_(102),G_(96),G_(99),G_(104),G_(109),G_(106),G_(102),G_(105),G_(110),G_(108),G_(101),G_(99),G_(109),G_(111),G_(109),G_(113),G_(110),G_(99),G_(103),G_(108),G_(109),G_(104),G_(103),G_(104),G_(100),G_(97),G_(102),G_(106),G_(99),G_(114),G_(89),G_(91),G_(94),G_(97),G_(96),G_(97),G_(97),G_(95),G_(93),G_(96),G_(97),G_(100),G_(102),G_(100),G_(99),G_(99),G_(102),G_(102),G_(100),G_(98),G_(97),G_(97),G_(98),G_(97),G_(97),G_(97),G_(97),G_(96),G_(97),G_(96),G_(96),G_(122),G_(85),G_(94),G_(95),G_(97),G_(97),G_(97),G_(98),G_(98),G_(98),G_(98),G_(98),G_(99),G_(102),G_(100),G_(100),G_(102),G_(102),G_(101),G_(101),G_(100),G_(99),G_(99),G_(100),G_(98),G_(98),G_(98),G_(97),G_(96),G_(96),G_(96),G_(97),G_(89),G_(89),G_(96),G_(97),G_(97),G_(96),G_(98),G_(99),G_(99),G_(99),G_(100),G_(100),G_(101),G_(100),G_(100),G_(99),G_(99),G_(101),G_(101),G_(100),G_(98),G_(98),G_(98),G_(98),G_(97),G_(96),G_(97),G_(96),G_(96),G_(96),G_(97),G_(97),G_(81),G_(92),G_(95),G_(94),G_(93),G_(93),G_(95),G_(95),G_(95),G_(94),G_(94),G_(94),G_(95),G_(95),G_(95),G_(96),G_(97),G_(97),G_(96),G_(95),G_(95),G_(95),G_(97),G_(96),G_(96),G_(95),G_(95),G_(95),G_(95),G_(94),G_(95),G_(95),G_(162),G_(160),G_(156),G_(159),G_(150),G_(144),G_(145),G_(144),G_(143),G_(143),G_(146),G_(143),G_(139),G_(139),G_(144),G_(146),G_(142),G_(141),G_(143),G_(143),G_(143),G_(143),G_(144),G_(148),G_(145),G_(142),G_(141),G_(143),G_(144),G_(147),G_(153),G_(154),};
 static const struct PL_TEX_CONST building_01door_shed_atexture = {
 .data = building_01door_shed_atexturedata ,
 };
-static const int building_01electrical_junctionbox_smalltexturedata[1024] = {
-126,128,127,128,127,151,165,161,161,161,166,178,201,203,204,201,199,202,202,195,181,177,177,188,187,163,167,163,162,163,158,150,100,99,101,101,98,143,167,164,166,180,215,222,208,212,207,209,215,209,210,211,219,228,224,229,237,216,185,168,168,170,164,154,97,115,90,90,88,145,168,165,177,222,211,184,198,195,172,185,188,186,183,184,195,206,200,181,190,225,227,176,166,165,164,157,91,148,64,54,54,138,155,118,173,225,189,189,159,132,132,132,121,126,125,115,118,114,122,145,171,192,230,195,124,148,163,157,184,187,145,112,114,156,131,97,185,169,178,133,112,164,191,182,176,171,150,173,178,192,209,139,136,179,175,159,95,119,164,159,170,179,164,156,157,163,129,126,98,92,165,123,147,131,159,176,163,154,150,164,165,163,187,197,124,179,115,80,119,122,158,162,99,98,124,120,99,144,152,148,79,100,178,130,198,143,160,172,168,162,162,154,158,161,153,138,125,188,115,70,135,152,158,165,62,64,76,75,60,137,151,127,137,185,193,128,144,148,138,147,155,148,140,140,124,125,119,92,121,192,191,142,122,143,155,165,115,117,112,110,114,150,141,149,144,163,182,180,122,114,119,117,115,106,95,86,80,76,77,84,152,191,170,144,150,141,143,166,169,171,170,169,176,157,102,87,100,151,165,176,173,162,157,156,156,154,152,142,143,141,141,144,159,165,156,109,94,99,140,165,162,164,168,166,170,153,91,62,59,87,138,155,159,157,157,157,156,156,156,157,156,156,155,150,153,141,94,61,61,82,127,163,159,163,166,165,169,148,88,84,79,75,80,95,119,129,129,130,130,130,130,131,131,131,130,132,101,76,73,71,79,85,110,161,157,158,161,163,164,154,117,119,120,119,121,120,123,122,117,116,117,117,119,120,118,117,116,117,117,117,121,122,125,121,128,158,157,160,181,205,187,162,159,158,158,158,161,162,162,161,159,158,159,158,164,172,190,188,174,158,158,160,173,169,167,168,160,158,153,189,225,229,206,163,154,154,154,154,154,154,154,155,154,154,154,154,156,183,226,222,220,211,196,205,223,215,202,207,184,154,149,192,186,166,164,161,154,154,154,154,154,154,154,154,154,154,154,154,152,178,212,195,185,192,207,200,178,193,212,209,190,149,150,153,150,155,156,153,154,154,154,154,154,154,154,154,154,153,153,154,152,178,176,148,153,148,148,152,150,154,155,150,153,150,150,151,158,159,156,153,154,154,154,154,154,154,154,154,154,153,154,153,154,184,176,151,156,154,151,152,157,157,157,154,151,150,142,142,151,149,144,145,147,149,153,153,152,153,153,153,152,150,148,144,141,183,164,145,144,144,146,146,144,144,148,143,142,142,125,126,135,135,127,126,128,130,138,140,138,142,141,140,144,136,127,127,122,178,143,125,126,126,126,126,127,126,128,127,126,125,107,111,111,115,112,110,109,110,112,114,114,118,114,115,119,114,108,111,105,166,126,108,110,109,110,109,110,109,110,110,111,107,93,96,98,100,96,95,95,95,96,95,97,97,95,96,97,97,95,96,92,155,111,95,96,97,95,97,96,96,95,96,96,93,84,87,85,83,85,85,87,85,84,83,85,85,85,85,86,84,84,86,81,146,101,84,87,87,85,84,86,86,85,85,87,84,80,84,85,80,83,85,90,82,76,80,86,79,81,84,85,80,80,84,81,152,98,83,90,81,76,81,85,80,81,85,84,80,78,82,83,80,85,84,94,95,95,92,84,84,80,82,83,78,78,83,81,169,98,84,94,95,95,92,83,85,80,83,82,78,77,81,79,77,85,76,79,84,91,85,80,84,77,79,81,77,77,80,79,174,96,74,79,84,90,85,80,84,78,79,81,77,75,78,83,81,85,81,78,79,88,86,80,85,78,78,78,75,75,78,84,170,91,79,78,80,88,86,80,85,78,78,78,75,71,75,79,79,80,77,81,80,83,87,80,85,81,76,75,72,72,75,82,161,81,77,81,80,84,86,81,85,82,76,75,72,70,70,75,79,79,78,84,86,85,82,78,79,78,76,71,70,70,69,88,165,77,78,84,86,86,81,78,78,79,75,70,70,70,71,80,81,77,77,80,84,85,79,80,79,78,76,71,71,71,69,99,152,73,77,81,84,84,79,80,79,78,76,71,71,72,73,82,82,78,76,76,80,81,76,78,81,83,80,74,72,72,74,83,85,77,76,75,80,80,76,78,82,83,80,73,72,78,83,80,84,82,85,81,83,83,81,85,83,84,81,83,78,78,83,80,83,82,84,81,84,82,82,85,82,85,81,83,78,};
+static const PL_TEXEL building_01electrical_junctionbox_smalltexturedata[1024] = {
+G_(126),G_(128),G_(127),G_(128),G_(127),G_(151),G_(165),G_(161),G_(161),G_(161),G_(166),G_(178),G_(201),G_(203),G_(204),G_(201),G_(199),G_(202),G_(202),G_(195),G_(181),G_(177),G_(177),G_(188),G_(187),G_(163),G_(167),G_(163),G_(162),G_(163),G_(158),G_(150),G_(100),G_(99),G_(101),G_(101),G_(98),G_(143),G_(167),G_(164),G_(166),G_(180),G_(215),G_(222),G_(208),G_(212),G_(207),G_(209),G_(215),G_(209),G_(210),G_(211),G_(219),G_(228),G_(224),G_(229),G_(237),G_(216),G_(185),G_(168),G_(168),G_(170),G_(164),G_(154),G_(97),G_(115),G_(90),G_(90),G_(88),G_(145),G_(168),G_(165),G_(177),G_(222),G_(211),G_(184),G_(198),G_(195),G_(172),G_(185),G_(188),G_(186),G_(183),G_(184),G_(195),G_(206),G_(200),G_(181),G_(190),G_(225),G_(227),G_(176),G_(166),G_(165),G_(164),G_(157),G_(91),G_(148),G_(64),G_(54),G_(54),G_(138),G_(155),G_(118),G_(173),G_(225),G_(189),G_(189),G_(159),G_(132),G_(132),G_(132),G_(121),G_(126),G_(125),G_(115),G_(118),G_(114),G_(122),G_(145),G_(171),G_(192),G_(230),G_(195),G_(124),G_(148),G_(163),G_(157),G_(184),G_(187),G_(145),G_(112),G_(114),G_(156),G_(131),G_(97),G_(185),G_(169),G_(178),G_(133),G_(112),G_(164),G_(191),G_(182),G_(176),G_(171),G_(150),G_(173),G_(178),G_(192),G_(209),G_(139),G_(136),G_(179),G_(175),G_(159),G_(95),G_(119),G_(164),G_(159),G_(170),G_(179),G_(164),G_(156),G_(157),G_(163),G_(129),G_(126),G_(98),G_(92),G_(165),G_(123),G_(147),G_(131),G_(159),G_(176),G_(163),G_(154),G_(150),G_(164),G_(165),G_(163),G_(187),G_(197),G_(124),G_(179),G_(115),G_(80),G_(119),G_(122),G_(158),G_(162),G_(99),G_(98),G_(124),G_(120),G_(99),G_(144),G_(152),G_(148),G_(79),G_(100),G_(178),G_(130),G_(198),G_(143),G_(160),G_(172),G_(168),G_(162),G_(162),G_(154),G_(158),G_(161),G_(153),G_(138),G_(125),G_(188),G_(115),G_(70),G_(135),G_(152),G_(158),G_(165),G_(62),G_(64),G_(76),G_(75),G_(60),G_(137),G_(151),G_(127),G_(137),G_(185),G_(193),G_(128),G_(144),G_(148),G_(138),G_(147),G_(155),G_(148),G_(140),G_(140),G_(124),G_(125),G_(119),G_(92),G_(121),G_(192),G_(191),G_(142),G_(122),G_(143),G_(155),G_(165),G_(115),G_(117),G_(112),G_(110),G_(114),G_(150),G_(141),G_(149),G_(144),G_(163),G_(182),G_(180),G_(122),G_(114),G_(119),G_(117),G_(115),G_(106),G_(95),G_(86),G_(80),G_(76),G_(77),G_(84),G_(152),G_(191),G_(170),G_(144),G_(150),G_(141),G_(143),G_(166),G_(169),G_(171),G_(170),G_(169),G_(176),G_(157),G_(102),G_(87),G_(100),G_(151),G_(165),G_(176),G_(173),G_(162),G_(157),G_(156),G_(156),G_(154),G_(152),G_(142),G_(143),G_(141),G_(141),G_(144),G_(159),G_(165),G_(156),G_(109),G_(94),G_(99),G_(140),G_(165),G_(162),G_(164),G_(168),G_(166),G_(170),G_(153),G_(91),G_(62),G_(59),G_(87),G_(138),G_(155),G_(159),G_(157),G_(157),G_(157),G_(156),G_(156),G_(156),G_(157),G_(156),G_(156),G_(155),G_(150),G_(153),G_(141),G_(94),G_(61),G_(61),G_(82),G_(127),G_(163),G_(159),G_(163),G_(166),G_(165),G_(169),G_(148),G_(88),G_(84),G_(79),G_(75),G_(80),G_(95),G_(119),G_(129),G_(129),G_(130),G_(130),G_(130),G_(130),G_(131),G_(131),G_(131),G_(130),G_(132),G_(101),G_(76),G_(73),G_(71),G_(79),G_(85),G_(110),G_(161),G_(157),G_(158),G_(161),G_(163),G_(164),G_(154),G_(117),G_(119),G_(120),G_(119),G_(121),G_(120),G_(123),G_(122),G_(117),G_(116),G_(117),G_(117),G_(119),G_(120),G_(118),G_(117),G_(116),G_(117),G_(117),G_(117),G_(121),G_(122),G_(125),G_(121),G_(128),G_(158),G_(157),G_(160),G_(181),G_(205),G_(187),G_(162),G_(159),G_(158),G_(158),G_(158),G_(161),G_(162),G_(162),G_(161),G_(159),G_(158),G_(159),G_(158),G_(164),G_(172),G_(190),G_(188),G_(174),G_(158),G_(158),G_(160),G_(173),G_(169),G_(167),G_(168),G_(160),G_(158),G_(153),G_(189),G_(225),G_(229),G_(206),G_(163),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(155),G_(154),G_(154),G_(154),G_(154),G_(156),G_(183),G_(226),G_(222),G_(220),G_(211),G_(196),G_(205),G_(223),G_(215),G_(202),G_(207),G_(184),G_(154),G_(149),G_(192),G_(186),G_(166),G_(164),G_(161),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(152),G_(178),G_(212),G_(195),G_(185),G_(192),G_(207),G_(200),G_(178),G_(193),G_(212),G_(209),G_(190),G_(149),G_(150),G_(153),G_(150),G_(155),G_(156),G_(153),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(153),G_(153),G_(154),G_(152),G_(178),G_(176),G_(148),G_(153),G_(148),G_(148),G_(152),G_(150),G_(154),G_(155),G_(150),G_(153),G_(150),G_(150),G_(151),G_(158),G_(159),G_(156),G_(153),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(154),G_(153),G_(154),G_(153),G_(154),G_(184),G_(176),G_(151),G_(156),G_(154),G_(151),G_(152),G_(157),G_(157),G_(157),G_(154),G_(151),G_(150),G_(142),G_(142),G_(151),G_(149),G_(144),G_(145),G_(147),G_(149),G_(153),G_(153),G_(152),G_(153),G_(153),G_(153),G_(152),G_(150),G_(148),G_(144),G_(141),G_(183),G_(164),G_(145),G_(144),G_(144),G_(146),G_(146),G_(144),G_(144),G_(148),G_(143),G_(142),G_(142),G_(125),G_(126),G_(135),G_(135),G_(127),G_(126),G_(128),G_(130),G_(138),G_(140),G_(138),G_(142),G_(141),G_(140),G_(144),G_(136),G_(127),G_(127),G_(122),G_(178),G_(143),G_(125),G_(126),G_(126),G_(126),G_(126),G_(127),G_(126),G_(128),G_(127),G_(126),G_(125),G_(107),G_(111),G_(111),G_(115),G_(112),G_(110),G_(109),G_(110),G_(112),G_(114),G_(114),G_(118),G_(114),G_(115),G_(119),G_(114),G_(108),G_(111),G_(105),G_(166),G_(126),G_(108),G_(110),G_(109),G_(110),G_(109),G_(110),G_(109),G_(110),G_(110),G_(111),G_(107),G_(93),G_(96),G_(98),G_(100),G_(96),G_(95),G_(95),G_(95),G_(96),G_(95),G_(97),G_(97),G_(95),G_(96),G_(97),G_(97),G_(95),G_(96),G_(92),G_(155),G_(111),G_(95),G_(96),G_(97),G_(95),G_(97),G_(96),G_(96),G_(95),G_(96),G_(96),G_(93),G_(84),G_(87),G_(85),G_(83),G_(85),G_(85),G_(87),G_(85),G_(84),G_(83),G_(85),G_(85),G_(85),G_(85),G_(86),G_(84),G_(84),G_(86),G_(81),G_(146),G_(101),G_(84),G_(87),G_(87),G_(85),G_(84),G_(86),G_(86),G_(85),G_(85),G_(87),G_(84),G_(80),G_(84),G_(85),G_(80),G_(83),G_(85),G_(90),G_(82),G_(76),G_(80),G_(86),G_(79),G_(81),G_(84),G_(85),G_(80),G_(80),G_(84),G_(81),G_(152),G_(98),G_(83),G_(90),G_(81),G_(76),G_(81),G_(85),G_(80),G_(81),G_(85),G_(84),G_(80),G_(78),G_(82),G_(83),G_(80),G_(85),G_(84),G_(94),G_(95),G_(95),G_(92),G_(84),G_(84),G_(80),G_(82),G_(83),G_(78),G_(78),G_(83),G_(81),G_(169),G_(98),G_(84),G_(94),G_(95),G_(95),G_(92),G_(83),G_(85),G_(80),G_(83),G_(82),G_(78),G_(77),G_(81),G_(79),G_(77),G_(85),G_(76),G_(79),G_(84),G_(91),G_(85),G_(80),G_(84),G_(77),G_(79),G_(81),G_(77),G_(77),G_(80),G_(79),G_(174),G_(96),G_(74),G_(79),G_(84),G_(90),G_(85),G_(80),G_(84),G_(78),G_(79),G_(81),G_(77),G_(75),G_(78),G_(83),G_(81),G_(85),G_(81),G_(78),G_(79),G_(88),G_(86),G_(80),G_(85),G_(78),G_(78),G_(78),G_(75),G_(75),G_(78),G_(84),G_(170),G_(91),G_(79),G_(78),G_(80),G_(88),G_(86),G_(80),G_(85),G_(78),G_(78),G_(78),G_(75),G_(71),G_(75),G_(79),G_(79),G_(80),G_(77),G_(81),G_(80),G_(83),G_(87),G_(80),G_(85),G_(81),G_(76),G_(75),G_(72),G_(72),G_(75),G_(82),G_(161),G_(81),G_(77),G_(81),G_(80),G_(84),G_(86),G_(81),G_(85),G_(82),G_(76),G_(75),G_(72),G_(70),G_(70),G_(75),G_(79),G_(79),G_(78),G_(84),G_(86),G_(85),G_(82),G_(78),G_(79),G_(78),G_(76),G_(71),G_(70),G_(70),G_(69),G_(88),G_(165),G_(77),G_(78),G_(84),G_(86),G_(86),G_(81),G_(78),G_(78),G_(79),G_(75),G_(70),G_(70),G_(70),G_(71),G_(80),G_(81),G_(77),G_(77),G_(80),G_(84),G_(85),G_(79),G_(80),G_(79),G_(78),G_(76),G_(71),G_(71),G_(71),G_(69),G_(99),G_(152),G_(73),G_(77),G_(81),G_(84),G_(84),G_(79),G_(80),G_(79),G_(78),G_(76),G_(71),G_(71),G_(72),G_(73),G_(82),G_(82),G_(78),G_(76),G_(76),G_(80),G_(81),G_(76),G_(78),G_(81),G_(83),G_(80),G_(74),G_(72),G_(72),G_(74),G_(83),G_(85),G_(77),G_(76),G_(75),G_(80),G_(80),G_(76),G_(78),G_(82),G_(83),G_(80),G_(73),G_(72),G_(78),G_(83),G_(80),G_(84),G_(82),G_(85),G_(81),G_(83),G_(83),G_(81),G_(85),G_(83),G_(84),G_(81),G_(83),G_(78),G_(78),G_(83),G_(80),G_(83),G_(82),G_(84),G_(81),G_(84),G_(82),G_(82),G_(85),G_(82),G_(85),G_(81),G_(83),G_(78),};
 static const struct PL_TEX_CONST building_01electrical_junctionbox_smalltexture = {
 .data = building_01electrical_junctionbox_smalltexturedata ,
 };
-static const int building_01gutter_brown_01texturedata[1024] = {
-179,167,167,149,103,91,101,93,82,119,131,98,91,136,144,87,105,146,132,89,122,146,97,80,133,132,114,109,79,55,50,49,176,171,165,155,111,91,103,96,84,119,131,102,92,134,141,88,105,148,134,93,122,154,104,84,135,130,111,108,80,54,51,48,179,169,167,152,108,91,104,97,83,117,128,102,94,139,139,92,106,148,130,89,121,148,101,85,133,129,111,110,80,54,62,55,178,167,166,150,107,99,106,93,80,116,124,97,94,137,141,90,106,149,129,87,123,146,106,88,133,132,114,110,79,55,53,48,176,168,166,149,108,106,106,94,83,122,128,94,94,139,140,89,107,152,133,89,124,149,99,86,133,131,115,111,78,56,54,48,178,168,169,149,103,100,107,98,85,127,126,89,88,136,144,91,106,152,133,90,125,150,98,84,131,131,114,109,83,58,65,52,181,166,166,148,107,104,114,99,87,132,134,93,87,137,145,90,106,150,132,91,126,152,100,84,130,129,110,112,88,58,55,48,181,167,164,157,113,102,111,98,85,130,142,99,96,145,144,91,107,150,132,92,126,153,100,82,127,129,111,112,84,55,54,53,182,167,163,154,112,102,109,98,81,128,142,100,95,145,144,89,111,151,134,91,121,150,98,83,129,128,113,111,79,57,56,53,180,167,164,156,114,102,110,97,79,125,145,100,92,143,145,91,111,154,135,92,123,150,100,86,135,131,110,108,76,60,57,50,172,170,168,157,120,102,111,99,83,130,148,101,87,139,144,91,109,155,134,90,124,150,101,85,131,130,109,107,77,57,55,51,170,171,170,159,116,107,122,103,90,140,150,102,88,139,143,90,106,155,133,87,121,150,100,78,126,130,108,105,77,57,54,51,173,170,170,157,106,116,149,103,89,140,150,101,90,140,142,88,106,154,135,86,121,150,100,77,131,132,108,106,77,54,53,52,176,169,170,156,107,107,130,100,85,133,146,101,95,145,140,86,109,156,136,87,124,152,101,78,129,131,108,108,78,54,53,51,180,167,170,156,109,94,108,99,83,133,146,101,94,145,141,89,110,158,135,88,123,151,102,81,125,128,106,106,79,54,53,50,184,167,169,157,110,97,110,99,84,138,151,100,92,142,143,88,107,158,134,88,124,151,99,80,126,128,106,106,80,54,51,49,186,169,167,157,111,103,118,97,88,139,150,98,98,149,143,89,106,159,132,82,118,147,109,98,126,130,107,107,78,55,49,49,191,169,166,156,111,94,110,99,87,143,152,101,97,151,139,89,107,161,130,83,115,151,117,101,140,136,109,108,80,55,56,50,195,172,167,155,113,98,112,95,87,141,150,97,94,149,139,89,108,161,131,86,119,147,116,87,148,140,113,111,87,54,54,51,196,175,168,153,112,105,119,97,85,132,148,96,91,145,141,90,105,156,131,84,116,149,98,83,139,137,116,110,85,55,53,51,198,178,168,150,110,105,115,95,87,135,149,97,96,148,142,90,106,158,131,83,114,149,96,79,130,136,115,107,80,54,52,52,196,182,169,152,111,108,113,97,92,139,150,95,96,151,145,90,106,158,132,86,116,150,99,84,129,131,111,107,80,56,54,51,199,179,172,151,111,107,113,97,88,137,149,94,91,147,143,89,106,158,131,84,113,148,101,91,133,132,111,107,79,57,54,50,192,182,173,148,109,112,122,95,89,139,150,94,96,149,141,89,107,156,127,81,112,146,98,88,132,133,113,108,77,54,52,49,195,182,170,149,120,119,127,101,93,136,148,93,96,152,140,88,109,156,125,86,111,146,96,82,124,129,112,107,75,52,52,49,195,181,171,146,116,119,125,96,87,134,146,92,93,149,144,87,105,155,127,84,110,147,98,80,122,128,110,105,76,52,52,51,194,181,174,148,119,119,121,97,86,138,145,90,93,150,148,88,102,156,125,83,111,146,99,80,124,130,112,106,77,52,52,52,197,186,182,153,109,121,124,91,90,145,146,89,93,150,145,87,103,157,120,82,112,144,99,81,125,131,113,106,76,54,54,52,199,192,189,161,113,119,121,90,92,145,145,86,93,149,139,87,105,157,124,81,113,144,98,84,128,130,112,106,76,56,52,52,196,190,189,168,120,119,121,93,94,146,142,86,97,149,135,85,102,156,122,84,116,142,95,84,126,130,111,105,76,55,52,51,190,189,187,165,123,116,119,92,97,149,145,91,100,152,135,85,104,155,118,79,112,140,93,80,119,128,107,103,73,54,54,50,189,188,186,168,125,116,118,90,96,147,140,87,100,156,138,87,110,156,120,78,106,138,92,77,116,127,107,104,72,52,56,50,};
+static const PL_TEXEL building_01gutter_brown_01texturedata[1024] = {
+G_(179),G_(167),G_(167),G_(149),G_(103),G_(91),G_(101),G_(93),G_(82),G_(119),G_(131),G_(98),G_(91),G_(136),G_(144),G_(87),G_(105),G_(146),G_(132),G_(89),G_(122),G_(146),G_(97),G_(80),G_(133),G_(132),G_(114),G_(109),G_(79),G_(55),G_(50),G_(49),G_(176),G_(171),G_(165),G_(155),G_(111),G_(91),G_(103),G_(96),G_(84),G_(119),G_(131),G_(102),G_(92),G_(134),G_(141),G_(88),G_(105),G_(148),G_(134),G_(93),G_(122),G_(154),G_(104),G_(84),G_(135),G_(130),G_(111),G_(108),G_(80),G_(54),G_(51),G_(48),G_(179),G_(169),G_(167),G_(152),G_(108),G_(91),G_(104),G_(97),G_(83),G_(117),G_(128),G_(102),G_(94),G_(139),G_(139),G_(92),G_(106),G_(148),G_(130),G_(89),G_(121),G_(148),G_(101),G_(85),G_(133),G_(129),G_(111),G_(110),G_(80),G_(54),G_(62),G_(55),G_(178),G_(167),G_(166),G_(150),G_(107),G_(99),G_(106),G_(93),G_(80),G_(116),G_(124),G_(97),G_(94),G_(137),G_(141),G_(90),G_(106),G_(149),G_(129),G_(87),G_(123),G_(146),G_(106),G_(88),G_(133),G_(132),G_(114),G_(110),G_(79),G_(55),G_(53),G_(48),G_(176),G_(168),G_(166),G_(149),G_(108),G_(106),G_(106),G_(94),G_(83),G_(122),G_(128),G_(94),G_(94),G_(139),G_(140),G_(89),G_(107),G_(152),G_(133),G_(89),G_(124),G_(149),G_(99),G_(86),G_(133),G_(131),G_(115),G_(111),G_(78),G_(56),G_(54),G_(48),G_(178),G_(168),G_(169),G_(149),G_(103),G_(100),G_(107),G_(98),G_(85),G_(127),G_(126),G_(89),G_(88),G_(136),G_(144),G_(91),G_(106),G_(152),G_(133),G_(90),G_(125),G_(150),G_(98),G_(84),G_(131),G_(131),G_(114),G_(109),G_(83),G_(58),G_(65),G_(52),G_(181),G_(166),G_(166),G_(148),G_(107),G_(104),G_(114),G_(99),G_(87),G_(132),G_(134),G_(93),G_(87),G_(137),G_(145),G_(90),G_(106),G_(150),G_(132),G_(91),G_(126),G_(152),G_(100),G_(84),G_(130),G_(129),G_(110),G_(112),G_(88),G_(58),G_(55),G_(48),G_(181),G_(167),G_(164),G_(157),G_(113),G_(102),G_(111),G_(98),G_(85),G_(130),G_(142),G_(99),G_(96),G_(145),G_(144),G_(91),G_(107),G_(150),G_(132),G_(92),G_(126),G_(153),G_(100),G_(82),G_(127),G_(129),G_(111),G_(112),G_(84),G_(55),G_(54),G_(53),G_(182),G_(167),G_(163),G_(154),G_(112),G_(102),G_(109),G_(98),G_(81),G_(128),G_(142),G_(100),G_(95),G_(145),G_(144),G_(89),G_(111),G_(151),G_(134),G_(91),G_(121),G_(150),G_(98),G_(83),G_(129),G_(128),G_(113),G_(111),G_(79),G_(57),G_(56),G_(53),G_(180),G_(167),G_(164),G_(156),G_(114),G_(102),G_(110),G_(97),G_(79),G_(125),G_(145),G_(100),G_(92),G_(143),G_(145),G_(91),G_(111),G_(154),G_(135),G_(92),G_(123),G_(150),G_(100),G_(86),G_(135),G_(131),G_(110),G_(108),G_(76),G_(60),G_(57),G_(50),G_(172),G_(170),G_(168),G_(157),G_(120),G_(102),G_(111),G_(99),G_(83),G_(130),G_(148),G_(101),G_(87),G_(139),G_(144),G_(91),G_(109),G_(155),G_(134),G_(90),G_(124),G_(150),G_(101),G_(85),G_(131),G_(130),G_(109),G_(107),G_(77),G_(57),G_(55),G_(51),G_(170),G_(171),G_(170),G_(159),G_(116),G_(107),G_(122),G_(103),G_(90),G_(140),G_(150),G_(102),G_(88),G_(139),G_(143),G_(90),G_(106),G_(155),G_(133),G_(87),G_(121),G_(150),G_(100),G_(78),G_(126),G_(130),G_(108),G_(105),G_(77),G_(57),G_(54),G_(51),G_(173),G_(170),G_(170),G_(157),G_(106),G_(116),G_(149),G_(103),G_(89),G_(140),G_(150),G_(101),G_(90),G_(140),G_(142),G_(88),G_(106),G_(154),G_(135),G_(86),G_(121),G_(150),G_(100),G_(77),G_(131),G_(132),G_(108),G_(106),G_(77),G_(54),G_(53),G_(52),G_(176),G_(169),G_(170),G_(156),G_(107),G_(107),G_(130),G_(100),G_(85),G_(133),G_(146),G_(101),G_(95),G_(145),G_(140),G_(86),G_(109),G_(156),G_(136),G_(87),G_(124),G_(152),G_(101),G_(78),G_(129),G_(131),G_(108),G_(108),G_(78),G_(54),G_(53),G_(51),G_(180),G_(167),G_(170),G_(156),G_(109),G_(94),G_(108),G_(99),G_(83),G_(133),G_(146),G_(101),G_(94),G_(145),G_(141),G_(89),G_(110),G_(158),G_(135),G_(88),G_(123),G_(151),G_(102),G_(81),G_(125),G_(128),G_(106),G_(106),G_(79),G_(54),G_(53),G_(50),G_(184),G_(167),G_(169),G_(157),G_(110),G_(97),G_(110),G_(99),G_(84),G_(138),G_(151),G_(100),G_(92),G_(142),G_(143),G_(88),G_(107),G_(158),G_(134),G_(88),G_(124),G_(151),G_(99),G_(80),G_(126),G_(128),G_(106),G_(106),G_(80),G_(54),G_(51),G_(49),G_(186),G_(169),G_(167),G_(157),G_(111),G_(103),G_(118),G_(97),G_(88),G_(139),G_(150),G_(98),G_(98),G_(149),G_(143),G_(89),G_(106),G_(159),G_(132),G_(82),G_(118),G_(147),G_(109),G_(98),G_(126),G_(130),G_(107),G_(107),G_(78),G_(55),G_(49),G_(49),G_(191),G_(169),G_(166),G_(156),G_(111),G_(94),G_(110),G_(99),G_(87),G_(143),G_(152),G_(101),G_(97),G_(151),G_(139),G_(89),G_(107),G_(161),G_(130),G_(83),G_(115),G_(151),G_(117),G_(101),G_(140),G_(136),G_(109),G_(108),G_(80),G_(55),G_(56),G_(50),G_(195),G_(172),G_(167),G_(155),G_(113),G_(98),G_(112),G_(95),G_(87),G_(141),G_(150),G_(97),G_(94),G_(149),G_(139),G_(89),G_(108),G_(161),G_(131),G_(86),G_(119),G_(147),G_(116),G_(87),G_(148),G_(140),G_(113),G_(111),G_(87),G_(54),G_(54),G_(51),G_(196),G_(175),G_(168),G_(153),G_(112),G_(105),G_(119),G_(97),G_(85),G_(132),G_(148),G_(96),G_(91),G_(145),G_(141),G_(90),G_(105),G_(156),G_(131),G_(84),G_(116),G_(149),G_(98),G_(83),G_(139),G_(137),G_(116),G_(110),G_(85),G_(55),G_(53),G_(51),G_(198),G_(178),G_(168),G_(150),G_(110),G_(105),G_(115),G_(95),G_(87),G_(135),G_(149),G_(97),G_(96),G_(148),G_(142),G_(90),G_(106),G_(158),G_(131),G_(83),G_(114),G_(149),G_(96),G_(79),G_(130),G_(136),G_(115),G_(107),G_(80),G_(54),G_(52),G_(52),G_(196),G_(182),G_(169),G_(152),G_(111),G_(108),G_(113),G_(97),G_(92),G_(139),G_(150),G_(95),G_(96),G_(151),G_(145),G_(90),G_(106),G_(158),G_(132),G_(86),G_(116),G_(150),G_(99),G_(84),G_(129),G_(131),G_(111),G_(107),G_(80),G_(56),G_(54),G_(51),G_(199),G_(179),G_(172),G_(151),G_(111),G_(107),G_(113),G_(97),G_(88),G_(137),G_(149),G_(94),G_(91),G_(147),G_(143),G_(89),G_(106),G_(158),G_(131),G_(84),G_(113),G_(148),G_(101),G_(91),G_(133),G_(132),G_(111),G_(107),G_(79),G_(57),G_(54),G_(50),G_(192),G_(182),G_(173),G_(148),G_(109),G_(112),G_(122),G_(95),G_(89),G_(139),G_(150),G_(94),G_(96),G_(149),G_(141),G_(89),G_(107),G_(156),G_(127),G_(81),G_(112),G_(146),G_(98),G_(88),G_(132),G_(133),G_(113),G_(108),G_(77),G_(54),G_(52),G_(49),G_(195),G_(182),G_(170),G_(149),G_(120),G_(119),G_(127),G_(101),G_(93),G_(136),G_(148),G_(93),G_(96),G_(152),G_(140),G_(88),G_(109),G_(156),G_(125),G_(86),G_(111),G_(146),G_(96),G_(82),G_(124),G_(129),G_(112),G_(107),G_(75),G_(52),G_(52),G_(49),G_(195),G_(181),G_(171),G_(146),G_(116),G_(119),G_(125),G_(96),G_(87),G_(134),G_(146),G_(92),G_(93),G_(149),G_(144),G_(87),G_(105),G_(155),G_(127),G_(84),G_(110),G_(147),G_(98),G_(80),G_(122),G_(128),G_(110),G_(105),G_(76),G_(52),G_(52),G_(51),G_(194),G_(181),G_(174),G_(148),G_(119),G_(119),G_(121),G_(97),G_(86),G_(138),G_(145),G_(90),G_(93),G_(150),G_(148),G_(88),G_(102),G_(156),G_(125),G_(83),G_(111),G_(146),G_(99),G_(80),G_(124),G_(130),G_(112),G_(106),G_(77),G_(52),G_(52),G_(52),G_(197),G_(186),G_(182),G_(153),G_(109),G_(121),G_(124),G_(91),G_(90),G_(145),G_(146),G_(89),G_(93),G_(150),G_(145),G_(87),G_(103),G_(157),G_(120),G_(82),G_(112),G_(144),G_(99),G_(81),G_(125),G_(131),G_(113),G_(106),G_(76),G_(54),G_(54),G_(52),G_(199),G_(192),G_(189),G_(161),G_(113),G_(119),G_(121),G_(90),G_(92),G_(145),G_(145),G_(86),G_(93),G_(149),G_(139),G_(87),G_(105),G_(157),G_(124),G_(81),G_(113),G_(144),G_(98),G_(84),G_(128),G_(130),G_(112),G_(106),G_(76),G_(56),G_(52),G_(52),G_(196),G_(190),G_(189),G_(168),G_(120),G_(119),G_(121),G_(93),G_(94),G_(146),G_(142),G_(86),G_(97),G_(149),G_(135),G_(85),G_(102),G_(156),G_(122),G_(84),G_(116),G_(142),G_(95),G_(84),G_(126),G_(130),G_(111),G_(105),G_(76),G_(55),G_(52),G_(51),G_(190),G_(189),G_(187),G_(165),G_(123),G_(116),G_(119),G_(92),G_(97),G_(149),G_(145),G_(91),G_(100),G_(152),G_(135),G_(85),G_(104),G_(155),G_(118),G_(79),G_(112),G_(140),G_(93),G_(80),G_(119),G_(128),G_(107),G_(103),G_(73),G_(54),G_(54),G_(50),G_(189),G_(188),G_(186),G_(168),G_(125),G_(116),G_(118),G_(90),G_(96),G_(147),G_(140),G_(87),G_(100),G_(156),G_(138),G_(87),G_(110),G_(156),G_(120),G_(78),G_(106),G_(138),G_(92),G_(77),G_(116),G_(127),G_(107),G_(104),G_(72),G_(52),G_(56),G_(50),};
 static const struct PL_TEX_CONST building_01gutter_brown_01texture = {
 .data = building_01gutter_brown_01texturedata ,
 };
-static const int building_01gutter_brown_bottomtexturedata[1024] = {
-118,119,119,118,116,113,115,114,113,112,113,115,111,112,112,113,113,112,112,112,113,113,113,113,113,114,112,115,118,119,119,118,118,119,119,118,115,115,117,115,115,115,116,115,115,115,114,113,114,114,114,116,115,115,115,115,116,116,114,116,118,119,119,118,51,52,52,51,50,50,48,54,49,49,50,50,51,51,50,50,51,50,50,51,50,50,50,51,50,48,49,50,51,52,52,51,60,61,61,60,59,62,56,88,79,52,58,57,56,56,57,58,57,56,56,56,58,58,58,58,56,55,59,60,60,61,61,60,75,74,73,73,72,75,65,98,93,63,69,68,68,68,69,69,67,67,67,67,68,68,68,67,66,67,71,72,73,73,74,75,93,91,90,91,91,91,88,84,80,82,86,87,85,84,85,86,85,85,85,85,86,86,85,85,86,88,90,91,91,90,91,93,119,118,116,117,117,115,115,117,116,112,115,115,113,112,113,114,114,114,114,114,115,115,114,114,114,115,117,117,117,117,118,119,147,146,145,146,146,146,145,144,145,143,144,144,143,142,144,144,144,144,144,144,144,143,143,142,145,146,147,147,145,145,146,147,157,155,157,158,159,158,157,157,158,156,155,156,156,156,156,156,156,156,156,156,155,155,156,157,157,157,158,159,158,157,155,157,161,161,163,162,162,162,161,161,160,160,159,157,160,160,160,160,160,160,160,160,157,159,160,160,161,161,162,162,162,163,161,161,160,160,161,161,161,161,160,160,159,159,159,157,160,160,160,160,160,160,160,160,157,159,159,159,160,160,161,161,161,161,160,160,152,149,151,153,151,151,150,150,150,149,150,151,150,150,150,150,150,150,150,150,151,150,149,150,150,150,151,151,153,151,149,152,126,126,126,126,125,126,126,125,126,127,126,127,127,127,127,127,128,128,127,127,127,126,127,126,125,126,126,125,126,126,126,126,100,100,100,100,101,100,100,101,101,101,100,101,101,101,101,101,102,102,101,101,101,100,101,101,101,100,100,101,100,100,100,100,84,84,84,84,85,84,84,85,84,86,84,85,86,86,86,86,85,85,85,86,85,84,86,84,85,84,84,85,84,84,84,84,108,109,109,108,107,108,109,107,106,107,106,107,105,105,105,106,104,104,105,106,107,106,107,106,107,109,108,107,108,109,109,108,168,170,171,170,168,169,170,169,169,168,168,169,169,168,169,171,170,169,169,170,169,168,168,169,169,170,170,169,169,171,170,168,133,133,133,134,134,136,135,135,136,136,136,137,140,139,138,139,140,138,138,139,137,136,136,136,135,135,136,134,134,133,133,133,49,50,50,51,52,54,53,52,52,51,53,54,56,55,54,54,55,55,54,55,54,53,52,52,52,53,53,52,51,50,50,49,53,55,56,54,55,57,57,56,55,54,56,57,56,56,56,57,56,55,55,56,57,56,54,55,55,56,56,55,54,56,55,53,50,50,50,50,51,52,52,52,54,57,58,57,56,55,54,54,56,56,55,55,56,56,56,56,51,51,51,51,50,50,50,50,45,45,45,45,45,45,46,46,48,51,52,51,50,50,49,49,51,51,50,50,50,50,50,50,50,49,47,46,45,45,45,45,45,45,45,45,46,47,47,47,47,48,49,49,48,49,49,49,50,50,49,50,49,49,49,49,49,49,46,45,45,45,45,45,46,46,46,46,46,47,47,47,47,47,48,49,48,48,50,50,51,50,50,49,49,49,48,48,48,48,47,47,46,46,46,46,45,45,47,47,46,46,46,46,46,47,47,48,49,49,49,50,52,51,49,49,49,49,48,47,47,46,47,48,48,47,45,45,44,45,46,47,46,46,46,46,46,47,47,48,49,49,49,50,51,51,49,49,49,50,49,48,47,46,46,47,47,46,45,44,43,43,45,45,45,45,45,45,46,47,47,48,49,49,49,50,50,50,50,50,49,50,50,50,47,46,45,45,45,45,43,43,42,43,44,45,45,45,45,45,46,47,47,48,49,49,50,50,50,50,50,50,49,50,51,50,47,46,44,44,44,44,43,42,43,44,45,46,46,46,47,46,46,46,48,50,48,51,49,50,51,52,52,51,51,49,49,50,47,46,45,45,46,45,44,43,44,45,46,47,48,49,49,49,47,47,48,49,50,51,52,52,54,54,54,54,53,54,52,49,49,49,49,48,47,46,45,44,45,45,47,47,49,50,50,50,50,50,51,52,50,42,53,56,57,56,56,57,55,54,51,49,50,50,50,49,47,47,45,45,45,46,47,47,49,50,50,50,49,49,52,53,51,50,52,54,57,56,56,57,55,52,50,50,50,50,49,49,48,47,46,45,};
+static const PL_TEXEL building_01gutter_brown_bottomtexturedata[1024] = {
+G_(118),G_(119),G_(119),G_(118),G_(116),G_(113),G_(115),G_(114),G_(113),G_(112),G_(113),G_(115),G_(111),G_(112),G_(112),G_(113),G_(113),G_(112),G_(112),G_(112),G_(113),G_(113),G_(113),G_(113),G_(113),G_(114),G_(112),G_(115),G_(118),G_(119),G_(119),G_(118),G_(118),G_(119),G_(119),G_(118),G_(115),G_(115),G_(117),G_(115),G_(115),G_(115),G_(116),G_(115),G_(115),G_(115),G_(114),G_(113),G_(114),G_(114),G_(114),G_(116),G_(115),G_(115),G_(115),G_(115),G_(116),G_(116),G_(114),G_(116),G_(118),G_(119),G_(119),G_(118),G_(51),G_(52),G_(52),G_(51),G_(50),G_(50),G_(48),G_(54),G_(49),G_(49),G_(50),G_(50),G_(51),G_(51),G_(50),G_(50),G_(51),G_(50),G_(50),G_(51),G_(50),G_(50),G_(50),G_(51),G_(50),G_(48),G_(49),G_(50),G_(51),G_(52),G_(52),G_(51),G_(60),G_(61),G_(61),G_(60),G_(59),G_(62),G_(56),G_(88),G_(79),G_(52),G_(58),G_(57),G_(56),G_(56),G_(57),G_(58),G_(57),G_(56),G_(56),G_(56),G_(58),G_(58),G_(58),G_(58),G_(56),G_(55),G_(59),G_(60),G_(60),G_(61),G_(61),G_(60),G_(75),G_(74),G_(73),G_(73),G_(72),G_(75),G_(65),G_(98),G_(93),G_(63),G_(69),G_(68),G_(68),G_(68),G_(69),G_(69),G_(67),G_(67),G_(67),G_(67),G_(68),G_(68),G_(68),G_(67),G_(66),G_(67),G_(71),G_(72),G_(73),G_(73),G_(74),G_(75),G_(93),G_(91),G_(90),G_(91),G_(91),G_(91),G_(88),G_(84),G_(80),G_(82),G_(86),G_(87),G_(85),G_(84),G_(85),G_(86),G_(85),G_(85),G_(85),G_(85),G_(86),G_(86),G_(85),G_(85),G_(86),G_(88),G_(90),G_(91),G_(91),G_(90),G_(91),G_(93),G_(119),G_(118),G_(116),G_(117),G_(117),G_(115),G_(115),G_(117),G_(116),G_(112),G_(115),G_(115),G_(113),G_(112),G_(113),G_(114),G_(114),G_(114),G_(114),G_(114),G_(115),G_(115),G_(114),G_(114),G_(114),G_(115),G_(117),G_(117),G_(117),G_(117),G_(118),G_(119),G_(147),G_(146),G_(145),G_(146),G_(146),G_(146),G_(145),G_(144),G_(145),G_(143),G_(144),G_(144),G_(143),G_(142),G_(144),G_(144),G_(144),G_(144),G_(144),G_(144),G_(144),G_(143),G_(143),G_(142),G_(145),G_(146),G_(147),G_(147),G_(145),G_(145),G_(146),G_(147),G_(157),G_(155),G_(157),G_(158),G_(159),G_(158),G_(157),G_(157),G_(158),G_(156),G_(155),G_(156),G_(156),G_(156),G_(156),G_(156),G_(156),G_(156),G_(156),G_(156),G_(155),G_(155),G_(156),G_(157),G_(157),G_(157),G_(158),G_(159),G_(158),G_(157),G_(155),G_(157),G_(161),G_(161),G_(163),G_(162),G_(162),G_(162),G_(161),G_(161),G_(160),G_(160),G_(159),G_(157),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(157),G_(159),G_(160),G_(160),G_(161),G_(161),G_(162),G_(162),G_(162),G_(163),G_(161),G_(161),G_(160),G_(160),G_(161),G_(161),G_(161),G_(161),G_(160),G_(160),G_(159),G_(159),G_(159),G_(157),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(160),G_(157),G_(159),G_(159),G_(159),G_(160),G_(160),G_(161),G_(161),G_(161),G_(161),G_(160),G_(160),G_(152),G_(149),G_(151),G_(153),G_(151),G_(151),G_(150),G_(150),G_(150),G_(149),G_(150),G_(151),G_(150),G_(150),G_(150),G_(150),G_(150),G_(150),G_(150),G_(150),G_(151),G_(150),G_(149),G_(150),G_(150),G_(150),G_(151),G_(151),G_(153),G_(151),G_(149),G_(152),G_(126),G_(126),G_(126),G_(126),G_(125),G_(126),G_(126),G_(125),G_(126),G_(127),G_(126),G_(127),G_(127),G_(127),G_(127),G_(127),G_(128),G_(128),G_(127),G_(127),G_(127),G_(126),G_(127),G_(126),G_(125),G_(126),G_(126),G_(125),G_(126),G_(126),G_(126),G_(126),G_(100),G_(100),G_(100),G_(100),G_(101),G_(100),G_(100),G_(101),G_(101),G_(101),G_(100),G_(101),G_(101),G_(101),G_(101),G_(101),G_(102),G_(102),G_(101),G_(101),G_(101),G_(100),G_(101),G_(101),G_(101),G_(100),G_(100),G_(101),G_(100),G_(100),G_(100),G_(100),G_(84),G_(84),G_(84),G_(84),G_(85),G_(84),G_(84),G_(85),G_(84),G_(86),G_(84),G_(85),G_(86),G_(86),G_(86),G_(86),G_(85),G_(85),G_(85),G_(86),G_(85),G_(84),G_(86),G_(84),G_(85),G_(84),G_(84),G_(85),G_(84),G_(84),G_(84),G_(84),G_(108),G_(109),G_(109),G_(108),G_(107),G_(108),G_(109),G_(107),G_(106),G_(107),G_(106),G_(107),G_(105),G_(105),G_(105),G_(106),G_(104),G_(104),G_(105),G_(106),G_(107),G_(106),G_(107),G_(106),G_(107),G_(109),G_(108),G_(107),G_(108),G_(109),G_(109),G_(108),G_(168),G_(170),G_(171),G_(170),G_(168),G_(169),G_(170),G_(169),G_(169),G_(168),G_(168),G_(169),G_(169),G_(168),G_(169),G_(171),G_(170),G_(169),G_(169),G_(170),G_(169),G_(168),G_(168),G_(169),G_(169),G_(170),G_(170),G_(169),G_(169),G_(171),G_(170),G_(168),G_(133),G_(133),G_(133),G_(134),G_(134),G_(136),G_(135),G_(135),G_(136),G_(136),G_(136),G_(137),G_(140),G_(139),G_(138),G_(139),G_(140),G_(138),G_(138),G_(139),G_(137),G_(136),G_(136),G_(136),G_(135),G_(135),G_(136),G_(134),G_(134),G_(133),G_(133),G_(133),G_(49),G_(50),G_(50),G_(51),G_(52),G_(54),G_(53),G_(52),G_(52),G_(51),G_(53),G_(54),G_(56),G_(55),G_(54),G_(54),G_(55),G_(55),G_(54),G_(55),G_(54),G_(53),G_(52),G_(52),G_(52),G_(53),G_(53),G_(52),G_(51),G_(50),G_(50),G_(49),G_(53),G_(55),G_(56),G_(54),G_(55),G_(57),G_(57),G_(56),G_(55),G_(54),G_(56),G_(57),G_(56),G_(56),G_(56),G_(57),G_(56),G_(55),G_(55),G_(56),G_(57),G_(56),G_(54),G_(55),G_(55),G_(56),G_(56),G_(55),G_(54),G_(56),G_(55),G_(53),G_(50),G_(50),G_(50),G_(50),G_(51),G_(52),G_(52),G_(52),G_(54),G_(57),G_(58),G_(57),G_(56),G_(55),G_(54),G_(54),G_(56),G_(56),G_(55),G_(55),G_(56),G_(56),G_(56),G_(56),G_(51),G_(51),G_(51),G_(51),G_(50),G_(50),G_(50),G_(50),G_(45),G_(45),G_(45),G_(45),G_(45),G_(45),G_(46),G_(46),G_(48),G_(51),G_(52),G_(51),G_(50),G_(50),G_(49),G_(49),G_(51),G_(51),G_(50),G_(50),G_(50),G_(50),G_(50),G_(50),G_(50),G_(49),G_(47),G_(46),G_(45),G_(45),G_(45),G_(45),G_(45),G_(45),G_(45),G_(45),G_(46),G_(47),G_(47),G_(47),G_(47),G_(48),G_(49),G_(49),G_(48),G_(49),G_(49),G_(49),G_(50),G_(50),G_(49),G_(50),G_(49),G_(49),G_(49),G_(49),G_(49),G_(49),G_(46),G_(45),G_(45),G_(45),G_(45),G_(45),G_(46),G_(46),G_(46),G_(46),G_(46),G_(47),G_(47),G_(47),G_(47),G_(47),G_(48),G_(49),G_(48),G_(48),G_(50),G_(50),G_(51),G_(50),G_(50),G_(49),G_(49),G_(49),G_(48),G_(48),G_(48),G_(48),G_(47),G_(47),G_(46),G_(46),G_(46),G_(46),G_(45),G_(45),G_(47),G_(47),G_(46),G_(46),G_(46),G_(46),G_(46),G_(47),G_(47),G_(48),G_(49),G_(49),G_(49),G_(50),G_(52),G_(51),G_(49),G_(49),G_(49),G_(49),G_(48),G_(47),G_(47),G_(46),G_(47),G_(48),G_(48),G_(47),G_(45),G_(45),G_(44),G_(45),G_(46),G_(47),G_(46),G_(46),G_(46),G_(46),G_(46),G_(47),G_(47),G_(48),G_(49),G_(49),G_(49),G_(50),G_(51),G_(51),G_(49),G_(49),G_(49),G_(50),G_(49),G_(48),G_(47),G_(46),G_(46),G_(47),G_(47),G_(46),G_(45),G_(44),G_(43),G_(43),G_(45),G_(45),G_(45),G_(45),G_(45),G_(45),G_(46),G_(47),G_(47),G_(48),G_(49),G_(49),G_(49),G_(50),G_(50),G_(50),G_(50),G_(50),G_(49),G_(50),G_(50),G_(50),G_(47),G_(46),G_(45),G_(45),G_(45),G_(45),G_(43),G_(43),G_(42),G_(43),G_(44),G_(45),G_(45),G_(45),G_(45),G_(45),G_(46),G_(47),G_(47),G_(48),G_(49),G_(49),G_(50),G_(50),G_(50),G_(50),G_(50),G_(50),G_(49),G_(50),G_(51),G_(50),G_(47),G_(46),G_(44),G_(44),G_(44),G_(44),G_(43),G_(42),G_(43),G_(44),G_(45),G_(46),G_(46),G_(46),G_(47),G_(46),G_(46),G_(46),G_(48),G_(50),G_(48),G_(51),G_(49),G_(50),G_(51),G_(52),G_(52),G_(51),G_(51),G_(49),G_(49),G_(50),G_(47),G_(46),G_(45),G_(45),G_(46),G_(45),G_(44),G_(43),G_(44),G_(45),G_(46),G_(47),G_(48),G_(49),G_(49),G_(49),G_(47),G_(47),G_(48),G_(49),G_(50),G_(51),G_(52),G_(52),G_(54),G_(54),G_(54),G_(54),G_(53),G_(54),G_(52),G_(49),G_(49),G_(49),G_(49),G_(48),G_(47),G_(46),G_(45),G_(44),G_(45),G_(45),G_(47),G_(47),G_(49),G_(50),G_(50),G_(50),G_(50),G_(50),G_(51),G_(52),G_(50),G_(42),G_(53),G_(56),G_(57),G_(56),G_(56),G_(57),G_(55),G_(54),G_(51),G_(49),G_(50),G_(50),G_(50),G_(49),G_(47),G_(47),G_(45),G_(45),G_(45),G_(46),G_(47),G_(47),G_(49),G_(50),G_(50),G_(50),G_(49),G_(49),G_(52),G_(53),G_(51),G_(50),G_(52),G_(54),G_(57),G_(56),G_(56),G_(57),G_(55),G_(52),G_(50),G_(50),G_(50),G_(50),G_(49),G_(49),G_(48),G_(47),G_(46),G_(45),};
 static const struct PL_TEX_CONST building_01gutter_brown_bottomtexture = {
 .data = building_01gutter_brown_bottomtexturedata ,
 };
-static const int building_01metal_grungy_tall_01texturedata[1024] = {
-81,94,107,120,115,112,127,135,113,118,140,144,127,144,161,158,146,137,147,135,144,140,120,116,110,103,114,127,121,106,93,81,86,96,101,122,137,120,106,109,124,114,130,147,156,154,137,135,130,137,154,154,146,129,113,124,112,109,120,137,122,100,96,85,91,106,109,135,148,130,122,101,102,115,121,143,166,154,144,130,129,154,152,161,165,139,116,103,101,122,129,148,136,109,106,90,85,97,99,136,154,144,128,100,105,112,126,144,166,161,155,137,142,155,147,152,173,160,113,105,100,128,144,155,136,100,97,86,85,89,85,111,136,144,132,116,113,127,135,154,165,165,164,148,151,164,166,172,173,152,126,113,117,132,145,136,112,85,89,85,87,86,84,103,131,132,119,106,106,110,118,156,166,165,161,147,153,171,167,172,172,147,117,106,106,119,132,132,103,84,86,87,79,88,94,100,109,122,127,104,115,122,114,134,148,158,166,162,167,177,166,168,186,174,127,114,104,127,122,109,100,94,88,79,85,82,99,119,115,125,126,107,111,132,140,154,173,167,180,169,173,168,154,168,167,173,149,111,107,125,125,118,122,97,83,84,91,85,110,128,111,123,130,108,120,140,146,168,182,187,186,168,169,181,175,174,166,157,148,120,109,130,127,134,121,91,82,91,85,92,123,155,127,121,125,103,106,122,138,179,196,181,173,164,178,171,179,196,179,136,123,106,103,127,129,115,94,92,92,85,72,80,109,153,132,112,122,105,109,111,129,184,187,146,155,173,182,168,169,191,183,129,111,108,105,122,117,110,113,102,85,73,81,81,95,138,117,118,122,107,109,118,131,169,175,151,138,159,172,159,166,180,169,132,116,109,106,122,117,117,139,97,81,81,77,81,104,146,129,123,123,102,106,111,130,137,174,151,141,140,142,140,150,170,154,138,117,106,103,123,123,129,146,104,81,76,76,79,108,131,115,136,129,107,110,106,128,145,187,171,152,151,151,147,144,164,150,135,114,111,106,129,137,115,131,108,78,76,82,92,100,116,121,135,136,120,109,114,135,151,169,167,150,133,133,136,142,161,152,135,113,110,120,136,135,121,116,100,92,82,87,89,111,125,124,119,120,109,108,122,135,155,163,147,151,141,137,140,150,165,155,136,123,108,109,120,119,124,125,111,89,87,93,95,112,130,121,117,120,113,111,123,128,153,157,143,147,152,151,146,144,159,153,128,123,111,113,121,117,121,129,112,95,93,89,101,117,129,133,127,121,110,116,117,119,136,147,143,136,127,123,133,140,149,136,119,117,116,110,121,127,132,129,117,101,90,95,91,103,123,128,117,120,110,113,121,140,155,159,150,134,128,126,135,138,155,155,138,121,112,110,120,117,127,124,103,91,96,95,92,100,116,133,132,130,119,112,113,124,142,158,143,129,122,109,108,122,134,137,125,113,113,119,130,132,136,120,96,96,97,91,85,91,114,128,127,134,120,115,114,115,127,146,138,129,117,117,125,132,142,128,115,113,115,120,133,126,119,103,101,110,114,87,88,105,114,117,124,131,120,118,120,112,137,162,138,137,121,124,137,139,162,137,111,121,117,120,128,137,110,121,169,169,161,95,96,96,111,118,123,131,120,116,117,104,121,155,136,129,119,120,129,135,155,121,104,117,116,119,131,129,119,120,139,117,98,94,91,95,108,117,128,133,119,110,114,109,123,142,133,135,129,130,134,133,141,123,110,114,110,119,134,127,117,105,92,89,93,91,88,86,101,119,127,123,114,108,110,111,124,148,138,136,127,128,136,139,148,124,111,111,108,114,123,127,120,101,85,88,91,95,83,98,110,119,124,127,118,105,108,107,108,143,147,139,125,125,138,147,142,108,107,108,105,119,128,121,117,109,98,82,95,86,87,119,121,123,134,130,113,104,104,104,108,132,127,125,119,121,129,126,132,108,104,104,104,113,121,116,125,112,97,87,86,94,97,127,120,120,129,126,110,108,109,103,117,151,129,107,110,110,117,128,142,117,103,110,108,110,113,118,136,116,100,88,96,81,92,120,127,128,135,126,112,99,108,102,115,142,125,116,124,123,113,126,133,114,102,108,99,112,116,129,130,112,94,88,82,100,92,103,125,129,130,133,114,100,105,102,103,130,128,117,117,118,128,132,129,102,102,105,100,112,119,115,109,98,80,90,101,90,86,88,106,117,121,121,118,103,99,101,95,138,131,125,112,112,129,134,139,94,100,99,103,119,122,122,121,102,80,88,90,78,75,76,99,103,108,112,105,95,96,102,101,138,136,130,123,127,139,146,138,101,102,96,95,106,110,108,103,100,76,76,78,};
+static const PL_TEXEL building_01metal_grungy_tall_01texturedata[1024] = {
+G_(81),G_(94),G_(107),G_(120),G_(115),G_(112),G_(127),G_(135),G_(113),G_(118),G_(140),G_(144),G_(127),G_(144),G_(161),G_(158),G_(146),G_(137),G_(147),G_(135),G_(144),G_(140),G_(120),G_(116),G_(110),G_(103),G_(114),G_(127),G_(121),G_(106),G_(93),G_(81),G_(86),G_(96),G_(101),G_(122),G_(137),G_(120),G_(106),G_(109),G_(124),G_(114),G_(130),G_(147),G_(156),G_(154),G_(137),G_(135),G_(130),G_(137),G_(154),G_(154),G_(146),G_(129),G_(113),G_(124),G_(112),G_(109),G_(120),G_(137),G_(122),G_(100),G_(96),G_(85),G_(91),G_(106),G_(109),G_(135),G_(148),G_(130),G_(122),G_(101),G_(102),G_(115),G_(121),G_(143),G_(166),G_(154),G_(144),G_(130),G_(129),G_(154),G_(152),G_(161),G_(165),G_(139),G_(116),G_(103),G_(101),G_(122),G_(129),G_(148),G_(136),G_(109),G_(106),G_(90),G_(85),G_(97),G_(99),G_(136),G_(154),G_(144),G_(128),G_(100),G_(105),G_(112),G_(126),G_(144),G_(166),G_(161),G_(155),G_(137),G_(142),G_(155),G_(147),G_(152),G_(173),G_(160),G_(113),G_(105),G_(100),G_(128),G_(144),G_(155),G_(136),G_(100),G_(97),G_(86),G_(85),G_(89),G_(85),G_(111),G_(136),G_(144),G_(132),G_(116),G_(113),G_(127),G_(135),G_(154),G_(165),G_(165),G_(164),G_(148),G_(151),G_(164),G_(166),G_(172),G_(173),G_(152),G_(126),G_(113),G_(117),G_(132),G_(145),G_(136),G_(112),G_(85),G_(89),G_(85),G_(87),G_(86),G_(84),G_(103),G_(131),G_(132),G_(119),G_(106),G_(106),G_(110),G_(118),G_(156),G_(166),G_(165),G_(161),G_(147),G_(153),G_(171),G_(167),G_(172),G_(172),G_(147),G_(117),G_(106),G_(106),G_(119),G_(132),G_(132),G_(103),G_(84),G_(86),G_(87),G_(79),G_(88),G_(94),G_(100),G_(109),G_(122),G_(127),G_(104),G_(115),G_(122),G_(114),G_(134),G_(148),G_(158),G_(166),G_(162),G_(167),G_(177),G_(166),G_(168),G_(186),G_(174),G_(127),G_(114),G_(104),G_(127),G_(122),G_(109),G_(100),G_(94),G_(88),G_(79),G_(85),G_(82),G_(99),G_(119),G_(115),G_(125),G_(126),G_(107),G_(111),G_(132),G_(140),G_(154),G_(173),G_(167),G_(180),G_(169),G_(173),G_(168),G_(154),G_(168),G_(167),G_(173),G_(149),G_(111),G_(107),G_(125),G_(125),G_(118),G_(122),G_(97),G_(83),G_(84),G_(91),G_(85),G_(110),G_(128),G_(111),G_(123),G_(130),G_(108),G_(120),G_(140),G_(146),G_(168),G_(182),G_(187),G_(186),G_(168),G_(169),G_(181),G_(175),G_(174),G_(166),G_(157),G_(148),G_(120),G_(109),G_(130),G_(127),G_(134),G_(121),G_(91),G_(82),G_(91),G_(85),G_(92),G_(123),G_(155),G_(127),G_(121),G_(125),G_(103),G_(106),G_(122),G_(138),G_(179),G_(196),G_(181),G_(173),G_(164),G_(178),G_(171),G_(179),G_(196),G_(179),G_(136),G_(123),G_(106),G_(103),G_(127),G_(129),G_(115),G_(94),G_(92),G_(92),G_(85),G_(72),G_(80),G_(109),G_(153),G_(132),G_(112),G_(122),G_(105),G_(109),G_(111),G_(129),G_(184),G_(187),G_(146),G_(155),G_(173),G_(182),G_(168),G_(169),G_(191),G_(183),G_(129),G_(111),G_(108),G_(105),G_(122),G_(117),G_(110),G_(113),G_(102),G_(85),G_(73),G_(81),G_(81),G_(95),G_(138),G_(117),G_(118),G_(122),G_(107),G_(109),G_(118),G_(131),G_(169),G_(175),G_(151),G_(138),G_(159),G_(172),G_(159),G_(166),G_(180),G_(169),G_(132),G_(116),G_(109),G_(106),G_(122),G_(117),G_(117),G_(139),G_(97),G_(81),G_(81),G_(77),G_(81),G_(104),G_(146),G_(129),G_(123),G_(123),G_(102),G_(106),G_(111),G_(130),G_(137),G_(174),G_(151),G_(141),G_(140),G_(142),G_(140),G_(150),G_(170),G_(154),G_(138),G_(117),G_(106),G_(103),G_(123),G_(123),G_(129),G_(146),G_(104),G_(81),G_(76),G_(76),G_(79),G_(108),G_(131),G_(115),G_(136),G_(129),G_(107),G_(110),G_(106),G_(128),G_(145),G_(187),G_(171),G_(152),G_(151),G_(151),G_(147),G_(144),G_(164),G_(150),G_(135),G_(114),G_(111),G_(106),G_(129),G_(137),G_(115),G_(131),G_(108),G_(78),G_(76),G_(82),G_(92),G_(100),G_(116),G_(121),G_(135),G_(136),G_(120),G_(109),G_(114),G_(135),G_(151),G_(169),G_(167),G_(150),G_(133),G_(133),G_(136),G_(142),G_(161),G_(152),G_(135),G_(113),G_(110),G_(120),G_(136),G_(135),G_(121),G_(116),G_(100),G_(92),G_(82),G_(87),G_(89),G_(111),G_(125),G_(124),G_(119),G_(120),G_(109),G_(108),G_(122),G_(135),G_(155),G_(163),G_(147),G_(151),G_(141),G_(137),G_(140),G_(150),G_(165),G_(155),G_(136),G_(123),G_(108),G_(109),G_(120),G_(119),G_(124),G_(125),G_(111),G_(89),G_(87),G_(93),G_(95),G_(112),G_(130),G_(121),G_(117),G_(120),G_(113),G_(111),G_(123),G_(128),G_(153),G_(157),G_(143),G_(147),G_(152),G_(151),G_(146),G_(144),G_(159),G_(153),G_(128),G_(123),G_(111),G_(113),G_(121),G_(117),G_(121),G_(129),G_(112),G_(95),G_(93),G_(89),G_(101),G_(117),G_(129),G_(133),G_(127),G_(121),G_(110),G_(116),G_(117),G_(119),G_(136),G_(147),G_(143),G_(136),G_(127),G_(123),G_(133),G_(140),G_(149),G_(136),G_(119),G_(117),G_(116),G_(110),G_(121),G_(127),G_(132),G_(129),G_(117),G_(101),G_(90),G_(95),G_(91),G_(103),G_(123),G_(128),G_(117),G_(120),G_(110),G_(113),G_(121),G_(140),G_(155),G_(159),G_(150),G_(134),G_(128),G_(126),G_(135),G_(138),G_(155),G_(155),G_(138),G_(121),G_(112),G_(110),G_(120),G_(117),G_(127),G_(124),G_(103),G_(91),G_(96),G_(95),G_(92),G_(100),G_(116),G_(133),G_(132),G_(130),G_(119),G_(112),G_(113),G_(124),G_(142),G_(158),G_(143),G_(129),G_(122),G_(109),G_(108),G_(122),G_(134),G_(137),G_(125),G_(113),G_(113),G_(119),G_(130),G_(132),G_(136),G_(120),G_(96),G_(96),G_(97),G_(91),G_(85),G_(91),G_(114),G_(128),G_(127),G_(134),G_(120),G_(115),G_(114),G_(115),G_(127),G_(146),G_(138),G_(129),G_(117),G_(117),G_(125),G_(132),G_(142),G_(128),G_(115),G_(113),G_(115),G_(120),G_(133),G_(126),G_(119),G_(103),G_(101),G_(110),G_(114),G_(87),G_(88),G_(105),G_(114),G_(117),G_(124),G_(131),G_(120),G_(118),G_(120),G_(112),G_(137),G_(162),G_(138),G_(137),G_(121),G_(124),G_(137),G_(139),G_(162),G_(137),G_(111),G_(121),G_(117),G_(120),G_(128),G_(137),G_(110),G_(121),G_(169),G_(169),G_(161),G_(95),G_(96),G_(96),G_(111),G_(118),G_(123),G_(131),G_(120),G_(116),G_(117),G_(104),G_(121),G_(155),G_(136),G_(129),G_(119),G_(120),G_(129),G_(135),G_(155),G_(121),G_(104),G_(117),G_(116),G_(119),G_(131),G_(129),G_(119),G_(120),G_(139),G_(117),G_(98),G_(94),G_(91),G_(95),G_(108),G_(117),G_(128),G_(133),G_(119),G_(110),G_(114),G_(109),G_(123),G_(142),G_(133),G_(135),G_(129),G_(130),G_(134),G_(133),G_(141),G_(123),G_(110),G_(114),G_(110),G_(119),G_(134),G_(127),G_(117),G_(105),G_(92),G_(89),G_(93),G_(91),G_(88),G_(86),G_(101),G_(119),G_(127),G_(123),G_(114),G_(108),G_(110),G_(111),G_(124),G_(148),G_(138),G_(136),G_(127),G_(128),G_(136),G_(139),G_(148),G_(124),G_(111),G_(111),G_(108),G_(114),G_(123),G_(127),G_(120),G_(101),G_(85),G_(88),G_(91),G_(95),G_(83),G_(98),G_(110),G_(119),G_(124),G_(127),G_(118),G_(105),G_(108),G_(107),G_(108),G_(143),G_(147),G_(139),G_(125),G_(125),G_(138),G_(147),G_(142),G_(108),G_(107),G_(108),G_(105),G_(119),G_(128),G_(121),G_(117),G_(109),G_(98),G_(82),G_(95),G_(86),G_(87),G_(119),G_(121),G_(123),G_(134),G_(130),G_(113),G_(104),G_(104),G_(104),G_(108),G_(132),G_(127),G_(125),G_(119),G_(121),G_(129),G_(126),G_(132),G_(108),G_(104),G_(104),G_(104),G_(113),G_(121),G_(116),G_(125),G_(112),G_(97),G_(87),G_(86),G_(94),G_(97),G_(127),G_(120),G_(120),G_(129),G_(126),G_(110),G_(108),G_(109),G_(103),G_(117),G_(151),G_(129),G_(107),G_(110),G_(110),G_(117),G_(128),G_(142),G_(117),G_(103),G_(110),G_(108),G_(110),G_(113),G_(118),G_(136),G_(116),G_(100),G_(88),G_(96),G_(81),G_(92),G_(120),G_(127),G_(128),G_(135),G_(126),G_(112),G_(99),G_(108),G_(102),G_(115),G_(142),G_(125),G_(116),G_(124),G_(123),G_(113),G_(126),G_(133),G_(114),G_(102),G_(108),G_(99),G_(112),G_(116),G_(129),G_(130),G_(112),G_(94),G_(88),G_(82),G_(100),G_(92),G_(103),G_(125),G_(129),G_(130),G_(133),G_(114),G_(100),G_(105),G_(102),G_(103),G_(130),G_(128),G_(117),G_(117),G_(118),G_(128),G_(132),G_(129),G_(102),G_(102),G_(105),G_(100),G_(112),G_(119),G_(115),G_(109),G_(98),G_(80),G_(90),G_(101),G_(90),G_(86),G_(88),G_(106),G_(117),G_(121),G_(121),G_(118),G_(103),G_(99),G_(101),G_(95),G_(138),G_(131),G_(125),G_(112),G_(112),G_(129),G_(134),G_(139),G_(94),G_(100),G_(99),G_(103),G_(119),G_(122),G_(122),G_(121),G_(102),G_(80),G_(88),G_(90),G_(78),G_(75),G_(76),G_(99),G_(103),G_(108),G_(112),G_(105),G_(95),G_(96),G_(102),G_(101),G_(138),G_(136),G_(130),G_(123),G_(127),G_(139),G_(146),G_(138),G_(101),G_(102),G_(96),G_(95),G_(106),G_(110),G_(108),G_(103),G_(100),G_(76),G_(76),G_(78),};
 static const struct PL_TEX_CONST building_01metal_grungy_tall_01texture = {
 .data = building_01metal_grungy_tall_01texturedata ,
 };
-static const int building_01pallet_bottomtexturedata[1024] = {
-121,129,135,125,129,134,139,129,129,135,133,134,133,132,140,136,137,131,129,143,138,132,135,138,134,130,133,135,143,155,154,162,141,139,152,156,157,152,146,146,147,147,147,147,151,153,151,153,153,152,148,154,158,155,155,155,164,162,163,167,171,167,172,175,151,154,152,147,146,153,156,147,145,152,153,152,156,157,152,155,153,154,157,157,161,166,160,156,165,167,169,165,169,176,174,174,151,162,154,143,142,143,145,139,146,153,154,154,159,159,163,161,156,154,159,157,162,167,162,157,164,170,175,173,175,173,177,178,154,167,163,133,133,143,142,136,146,153,151,156,160,164,165,166,157,162,165,160,159,158,158,157,161,170,174,172,170,170,179,183,155,168,166,157,147,155,152,149,162,158,152,163,165,166,160,168,167,163,163,155,160,159,159,163,169,174,174,174,171,169,180,182,160,168,169,164,162,158,159,155,165,160,156,167,167,160,152,160,172,166,163,161,165,168,164,161,173,176,172,178,175,172,180,177,156,174,169,164,170,166,167,163,163,169,166,170,167,159,155,151,168,174,169,167,166,171,172,173,176,175,167,175,178,176,181,177,159,173,173,169,164,157,165,168,165,170,172,171,166,165,165,155,166,166,164,166,171,173,172,169,171,176,173,175,182,185,182,173,163,176,176,172,172,165,166,164,166,170,175,172,167,168,158,164,171,166,171,171,176,175,175,170,171,172,175,177,178,183,178,174,167,181,177,174,173,168,174,171,170,175,175,172,168,168,164,170,171,164,168,171,175,174,174,173,172,173,179,179,178,177,179,178,168,181,180,176,174,170,171,177,176,177,173,173,173,175,173,177,173,168,166,169,171,174,172,173,175,175,176,179,182,182,182,177,159,175,176,174,170,175,176,174,178,173,170,171,174,177,175,172,169,174,171,160,157,165,172,173,176,173,176,176,174,182,186,182,148,173,176,174,176,181,176,170,171,170,169,170,171,175,174,170,171,175,173,159,138,164,173,173,176,177,172,169,168,181,185,185,157,176,169,173,179,169,171,176,173,173,168,170,169,170,167,169,172,168,167,164,167,167,171,173,173,171,164,178,173,173,173,170,160,172,174,178,178,162,166,179,180,178,177,175,172,171,172,175,178,172,171,175,180,176,174,171,177,167,167,171,172,167,169,164,167,174,173,176,167,173,166,174,176,172,177,175,175,170,174,174,179,178,173,176,178,170,176,181,177,168,174,168,172,172,176,181,166,168,171,164,152,174,166,169,173,169,175,174,174,173,173,172,173,176,175,175,175,170,167,171,173,169,172,171,172,176,177,180,172,172,170,163,156,172,169,165,172,173,172,175,174,171,168,171,165,167,172,172,175,172,174,173,159,169,169,169,169,170,175,171,165,167,169,160,166,172,169,161,171,172,168,173,173,170,166,167,165,166,165,166,165,168,167,155,162,170,166,169,164,165,172,166,168,172,162,167,172,169,172,163,167,163,168,175,173,171,169,166,168,167,164,163,169,169,164,158,172,167,166,171,166,165,168,175,173,174,162,170,169,167,173,168,166,170,167,173,171,169,165,163,168,171,171,161,168,169,159,160,171,167,174,169,164,167,168,180,173,172,161,164,159,163,169,164,167,172,166,169,167,166,161,158,165,167,165,165,166,168,166,160,166,166,170,168,167,164,163,175,168,169,161,163,158,160,164,160,167,165,163,166,164,164,164,154,161,165,159,160,160,163,163,160,161,158,160,169,167,163,160,171,163,159,160,169,165,161,165,162,168,161,162,163,160,160,162,154,161,162,161,161,164,160,161,162,159,150,151,165,168,161,163,164,162,161,167,172,167,162,159,157,159,162,162,162,161,155,153,159,159,151,157,156,159,158,160,160,153,161,152,161,167,161,166,157,162,162,159,166,158,157,155,157,156,165,163,163,160,156,157,153,156,154,154,151,147,148,157,159,158,159,153,162,167,168,152,154,163,159,155,161,159,159,148,158,155,164,161,160,159,157,158,155,156,153,145,146,146,149,157,157,156,156,157,162,169,168,151,145,163,157,156,158,157,158,144,152,157,161,158,157,152,152,144,130,144,145,147,148,143,151,153,146,144,150,149,159,153,155,160,148,164,161,161,155,155,155,155,150,144,146,152,154,151,144,142,140,137,147,151,146,142,141,151,151,141,154,149,142,136,132,145,135,157,160,155,153,151,156,159,146,153,150,151,152,152,145,148,154,146,145,152,146,146,148,143,143,135,141,136,131,136,127,130,130,155,161,146,140,153,144,150,142,147,147,152,141,135,133,140,147,146,142,143,135,135,125,119,114,106,117,121,110,109,106,112,112,};
+static const PL_TEXEL building_01pallet_bottomtexturedata[1024] = {
+G_(121),G_(129),G_(135),G_(125),G_(129),G_(134),G_(139),G_(129),G_(129),G_(135),G_(133),G_(134),G_(133),G_(132),G_(140),G_(136),G_(137),G_(131),G_(129),G_(143),G_(138),G_(132),G_(135),G_(138),G_(134),G_(130),G_(133),G_(135),G_(143),G_(155),G_(154),G_(162),G_(141),G_(139),G_(152),G_(156),G_(157),G_(152),G_(146),G_(146),G_(147),G_(147),G_(147),G_(147),G_(151),G_(153),G_(151),G_(153),G_(153),G_(152),G_(148),G_(154),G_(158),G_(155),G_(155),G_(155),G_(164),G_(162),G_(163),G_(167),G_(171),G_(167),G_(172),G_(175),G_(151),G_(154),G_(152),G_(147),G_(146),G_(153),G_(156),G_(147),G_(145),G_(152),G_(153),G_(152),G_(156),G_(157),G_(152),G_(155),G_(153),G_(154),G_(157),G_(157),G_(161),G_(166),G_(160),G_(156),G_(165),G_(167),G_(169),G_(165),G_(169),G_(176),G_(174),G_(174),G_(151),G_(162),G_(154),G_(143),G_(142),G_(143),G_(145),G_(139),G_(146),G_(153),G_(154),G_(154),G_(159),G_(159),G_(163),G_(161),G_(156),G_(154),G_(159),G_(157),G_(162),G_(167),G_(162),G_(157),G_(164),G_(170),G_(175),G_(173),G_(175),G_(173),G_(177),G_(178),G_(154),G_(167),G_(163),G_(133),G_(133),G_(143),G_(142),G_(136),G_(146),G_(153),G_(151),G_(156),G_(160),G_(164),G_(165),G_(166),G_(157),G_(162),G_(165),G_(160),G_(159),G_(158),G_(158),G_(157),G_(161),G_(170),G_(174),G_(172),G_(170),G_(170),G_(179),G_(183),G_(155),G_(168),G_(166),G_(157),G_(147),G_(155),G_(152),G_(149),G_(162),G_(158),G_(152),G_(163),G_(165),G_(166),G_(160),G_(168),G_(167),G_(163),G_(163),G_(155),G_(160),G_(159),G_(159),G_(163),G_(169),G_(174),G_(174),G_(174),G_(171),G_(169),G_(180),G_(182),G_(160),G_(168),G_(169),G_(164),G_(162),G_(158),G_(159),G_(155),G_(165),G_(160),G_(156),G_(167),G_(167),G_(160),G_(152),G_(160),G_(172),G_(166),G_(163),G_(161),G_(165),G_(168),G_(164),G_(161),G_(173),G_(176),G_(172),G_(178),G_(175),G_(172),G_(180),G_(177),G_(156),G_(174),G_(169),G_(164),G_(170),G_(166),G_(167),G_(163),G_(163),G_(169),G_(166),G_(170),G_(167),G_(159),G_(155),G_(151),G_(168),G_(174),G_(169),G_(167),G_(166),G_(171),G_(172),G_(173),G_(176),G_(175),G_(167),G_(175),G_(178),G_(176),G_(181),G_(177),G_(159),G_(173),G_(173),G_(169),G_(164),G_(157),G_(165),G_(168),G_(165),G_(170),G_(172),G_(171),G_(166),G_(165),G_(165),G_(155),G_(166),G_(166),G_(164),G_(166),G_(171),G_(173),G_(172),G_(169),G_(171),G_(176),G_(173),G_(175),G_(182),G_(185),G_(182),G_(173),G_(163),G_(176),G_(176),G_(172),G_(172),G_(165),G_(166),G_(164),G_(166),G_(170),G_(175),G_(172),G_(167),G_(168),G_(158),G_(164),G_(171),G_(166),G_(171),G_(171),G_(176),G_(175),G_(175),G_(170),G_(171),G_(172),G_(175),G_(177),G_(178),G_(183),G_(178),G_(174),G_(167),G_(181),G_(177),G_(174),G_(173),G_(168),G_(174),G_(171),G_(170),G_(175),G_(175),G_(172),G_(168),G_(168),G_(164),G_(170),G_(171),G_(164),G_(168),G_(171),G_(175),G_(174),G_(174),G_(173),G_(172),G_(173),G_(179),G_(179),G_(178),G_(177),G_(179),G_(178),G_(168),G_(181),G_(180),G_(176),G_(174),G_(170),G_(171),G_(177),G_(176),G_(177),G_(173),G_(173),G_(173),G_(175),G_(173),G_(177),G_(173),G_(168),G_(166),G_(169),G_(171),G_(174),G_(172),G_(173),G_(175),G_(175),G_(176),G_(179),G_(182),G_(182),G_(182),G_(177),G_(159),G_(175),G_(176),G_(174),G_(170),G_(175),G_(176),G_(174),G_(178),G_(173),G_(170),G_(171),G_(174),G_(177),G_(175),G_(172),G_(169),G_(174),G_(171),G_(160),G_(157),G_(165),G_(172),G_(173),G_(176),G_(173),G_(176),G_(176),G_(174),G_(182),G_(186),G_(182),G_(148),G_(173),G_(176),G_(174),G_(176),G_(181),G_(176),G_(170),G_(171),G_(170),G_(169),G_(170),G_(171),G_(175),G_(174),G_(170),G_(171),G_(175),G_(173),G_(159),G_(138),G_(164),G_(173),G_(173),G_(176),G_(177),G_(172),G_(169),G_(168),G_(181),G_(185),G_(185),G_(157),G_(176),G_(169),G_(173),G_(179),G_(169),G_(171),G_(176),G_(173),G_(173),G_(168),G_(170),G_(169),G_(170),G_(167),G_(169),G_(172),G_(168),G_(167),G_(164),G_(167),G_(167),G_(171),G_(173),G_(173),G_(171),G_(164),G_(178),G_(173),G_(173),G_(173),G_(170),G_(160),G_(172),G_(174),G_(178),G_(178),G_(162),G_(166),G_(179),G_(180),G_(178),G_(177),G_(175),G_(172),G_(171),G_(172),G_(175),G_(178),G_(172),G_(171),G_(175),G_(180),G_(176),G_(174),G_(171),G_(177),G_(167),G_(167),G_(171),G_(172),G_(167),G_(169),G_(164),G_(167),G_(174),G_(173),G_(176),G_(167),G_(173),G_(166),G_(174),G_(176),G_(172),G_(177),G_(175),G_(175),G_(170),G_(174),G_(174),G_(179),G_(178),G_(173),G_(176),G_(178),G_(170),G_(176),G_(181),G_(177),G_(168),G_(174),G_(168),G_(172),G_(172),G_(176),G_(181),G_(166),G_(168),G_(171),G_(164),G_(152),G_(174),G_(166),G_(169),G_(173),G_(169),G_(175),G_(174),G_(174),G_(173),G_(173),G_(172),G_(173),G_(176),G_(175),G_(175),G_(175),G_(170),G_(167),G_(171),G_(173),G_(169),G_(172),G_(171),G_(172),G_(176),G_(177),G_(180),G_(172),G_(172),G_(170),G_(163),G_(156),G_(172),G_(169),G_(165),G_(172),G_(173),G_(172),G_(175),G_(174),G_(171),G_(168),G_(171),G_(165),G_(167),G_(172),G_(172),G_(175),G_(172),G_(174),G_(173),G_(159),G_(169),G_(169),G_(169),G_(169),G_(170),G_(175),G_(171),G_(165),G_(167),G_(169),G_(160),G_(166),G_(172),G_(169),G_(161),G_(171),G_(172),G_(168),G_(173),G_(173),G_(170),G_(166),G_(167),G_(165),G_(166),G_(165),G_(166),G_(165),G_(168),G_(167),G_(155),G_(162),G_(170),G_(166),G_(169),G_(164),G_(165),G_(172),G_(166),G_(168),G_(172),G_(162),G_(167),G_(172),G_(169),G_(172),G_(163),G_(167),G_(163),G_(168),G_(175),G_(173),G_(171),G_(169),G_(166),G_(168),G_(167),G_(164),G_(163),G_(169),G_(169),G_(164),G_(158),G_(172),G_(167),G_(166),G_(171),G_(166),G_(165),G_(168),G_(175),G_(173),G_(174),G_(162),G_(170),G_(169),G_(167),G_(173),G_(168),G_(166),G_(170),G_(167),G_(173),G_(171),G_(169),G_(165),G_(163),G_(168),G_(171),G_(171),G_(161),G_(168),G_(169),G_(159),G_(160),G_(171),G_(167),G_(174),G_(169),G_(164),G_(167),G_(168),G_(180),G_(173),G_(172),G_(161),G_(164),G_(159),G_(163),G_(169),G_(164),G_(167),G_(172),G_(166),G_(169),G_(167),G_(166),G_(161),G_(158),G_(165),G_(167),G_(165),G_(165),G_(166),G_(168),G_(166),G_(160),G_(166),G_(166),G_(170),G_(168),G_(167),G_(164),G_(163),G_(175),G_(168),G_(169),G_(161),G_(163),G_(158),G_(160),G_(164),G_(160),G_(167),G_(165),G_(163),G_(166),G_(164),G_(164),G_(164),G_(154),G_(161),G_(165),G_(159),G_(160),G_(160),G_(163),G_(163),G_(160),G_(161),G_(158),G_(160),G_(169),G_(167),G_(163),G_(160),G_(171),G_(163),G_(159),G_(160),G_(169),G_(165),G_(161),G_(165),G_(162),G_(168),G_(161),G_(162),G_(163),G_(160),G_(160),G_(162),G_(154),G_(161),G_(162),G_(161),G_(161),G_(164),G_(160),G_(161),G_(162),G_(159),G_(150),G_(151),G_(165),G_(168),G_(161),G_(163),G_(164),G_(162),G_(161),G_(167),G_(172),G_(167),G_(162),G_(159),G_(157),G_(159),G_(162),G_(162),G_(162),G_(161),G_(155),G_(153),G_(159),G_(159),G_(151),G_(157),G_(156),G_(159),G_(158),G_(160),G_(160),G_(153),G_(161),G_(152),G_(161),G_(167),G_(161),G_(166),G_(157),G_(162),G_(162),G_(159),G_(166),G_(158),G_(157),G_(155),G_(157),G_(156),G_(165),G_(163),G_(163),G_(160),G_(156),G_(157),G_(153),G_(156),G_(154),G_(154),G_(151),G_(147),G_(148),G_(157),G_(159),G_(158),G_(159),G_(153),G_(162),G_(167),G_(168),G_(152),G_(154),G_(163),G_(159),G_(155),G_(161),G_(159),G_(159),G_(148),G_(158),G_(155),G_(164),G_(161),G_(160),G_(159),G_(157),G_(158),G_(155),G_(156),G_(153),G_(145),G_(146),G_(146),G_(149),G_(157),G_(157),G_(156),G_(156),G_(157),G_(162),G_(169),G_(168),G_(151),G_(145),G_(163),G_(157),G_(156),G_(158),G_(157),G_(158),G_(144),G_(152),G_(157),G_(161),G_(158),G_(157),G_(152),G_(152),G_(144),G_(130),G_(144),G_(145),G_(147),G_(148),G_(143),G_(151),G_(153),G_(146),G_(144),G_(150),G_(149),G_(159),G_(153),G_(155),G_(160),G_(148),G_(164),G_(161),G_(161),G_(155),G_(155),G_(155),G_(155),G_(150),G_(144),G_(146),G_(152),G_(154),G_(151),G_(144),G_(142),G_(140),G_(137),G_(147),G_(151),G_(146),G_(142),G_(141),G_(151),G_(151),G_(141),G_(154),G_(149),G_(142),G_(136),G_(132),G_(145),G_(135),G_(157),G_(160),G_(155),G_(153),G_(151),G_(156),G_(159),G_(146),G_(153),G_(150),G_(151),G_(152),G_(152),G_(145),G_(148),G_(154),G_(146),G_(145),G_(152),G_(146),G_(146),G_(148),G_(143),G_(143),G_(135),G_(141),G_(136),G_(131),G_(136),G_(127),G_(130),G_(130),G_(155),G_(161),G_(146),G_(140),G_(153),G_(144),G_(150),G_(142),G_(147),G_(147),G_(152),G_(141),G_(135),G_(133),G_(140),G_(147),G_(146),G_(142),G_(143),G_(135),G_(135),G_(125),G_(119),G_(114),G_(106),G_(117),G_(121),G_(110),G_(109),G_(106),G_(112),G_(112),};
 static const struct PL_TEX_CONST building_01pallet_bottomtexture = {
 .data = building_01pallet_bottomtexturedata ,
 };
-static const int building_01pallet_toptexturedata[1024] = {
-167,185,183,182,174,161,168,178,179,177,176,173,173,173,171,174,184,183,183,178,171,169,165,164,177,183,184,186,180,192,202,200,157,183,178,176,170,170,168,172,175,176,171,174,171,169,170,151,147,176,167,169,167,159,156,161,161,164,164,174,177,177,178,156,153,178,174,176,167,158,166,173,174,173,169,170,165,165,163,151,150,165,167,165,166,164,159,168,163,163,160,170,173,166,162,151,123,118,102,101,112,127,134,146,157,164,165,168,163,165,164,155,156,165,172,173,176,180,177,185,171,163,163,169,167,171,169,159,177,162,80,48,66,67,60,73,85,106,124,140,154,164,168,162,165,172,171,168,173,180,176,175,172,169,168,170,166,163,163,153,197,191,120,71,86,93,80,74,63,68,77,76,69,65,53,71,107,44,58,67,66,63,58,55,54,53,59,48,39,30,56,111,202,194,143,85,92,117,124,117,100,100,107,98,89,80,67,96,137,59,79,85,81,65,61,66,66,65,63,54,54,35,70,132,204,193,151,90,93,103,116,122,123,130,120,112,108,108,107,122,142,91,120,127,105,106,109,108,106,105,104,85,83,62,80,132,202,173,145,91,96,113,126,111,115,126,124,131,127,129,125,129,144,105,133,128,112,122,125,122,121,121,120,99,91,93,86,129,205,184,160,93,101,121,104,98,111,112,125,127,119,128,128,133,145,110,135,132,133,135,133,133,129,118,106,103,95,75,85,129,206,184,161,94,104,110,95,108,112,112,110,113,112,119,121,132,142,105,127,128,127,125,123,132,128,122,114,105,92,61,83,130,205,190,160,92,99,103,99,110,111,121,123,108,116,123,107,116,143,84,105,115,121,115,111,115,116,109,93,94,72,54,83,129,203,188,159,103,114,117,117,122,124,124,132,120,105,110,103,117,139,88,113,123,120,121,119,120,119,111,94,96,78,57,81,125,183,167,150,114,130,129,122,124,133,139,142,131,123,120,111,117,137,104,118,123,123,122,123,121,116,118,110,106,97,82,93,130,140,137,135,129,140,144,146,149,144,152,154,153,150,142,135,145,140,139,139,144,155,145,145,146,140,141,135,137,130,124,119,122,141,149,155,149,142,149,159,166,160,148,121,138,138,131,152,150,138,136,119,135,148,144,146,143,150,148,146,139,134,131,126,116,144,154,156,144,139,149,152,153,153,149,140,146,152,134,139,145,143,144,143,150,148,141,151,144,152,156,154,152,147,145,141,116,145,159,160,149,160,162,156,155,152,150,150,152,154,156,153,143,135,143,146,156,156,144,139,148,150,146,145,149,149,149,142,130,129,124,85,83,92,96,96,96,84,83,90,78,90,104,112,116,106,100,102,106,107,96,100,105,112,113,105,103,105,108,110,117,168,145,60,44,67,73,68,63,54,49,53,41,56,62,65,77,75,36,56,58,61,63,62,59,57,52,39,32,33,23,54,105,180,163,93,74,95,94,84,81,89,84,85,90,88,80,89,105,101,68,95,97,97,86,80,75,69,66,62,66,65,45,66,109,180,166,104,81,84,78,78,99,93,99,105,121,96,78,89,109,112,88,116,111,96,81,78,81,88,92,94,90,77,52,71,108,176,171,113,95,110,109,99,107,103,99,111,110,87,84,102,113,106,89,109,104,96,101,99,103,109,109,94,80,70,52,74,119,166,162,119,105,118,125,120,102,116,112,120,113,98,99,105,113,110,73,94,104,106,111,113,116,117,103,87,86,82,59,73,107,155,155,121,99,117,124,120,105,93,106,108,113,108,102,92,99,117,80,101,107,106,116,118,120,106,93,91,89,78,56,70,100,154,157,115,84,108,120,107,94,83,93,90,86,80,72,64,82,109,73,91,99,98,106,108,109,104,98,81,74,60,42,59,96,157,159,135,120,138,139,121,127,141,142,140,120,114,113,113,122,139,124,128,132,132,132,128,124,126,124,117,117,114,102,107,124,150,145,128,157,168,171,165,163,169,170,168,148,147,140,130,147,149,150,146,148,138,140,140,125,128,128,125,131,144,146,144,137,151,139,120,127,135,134,136,130,131,142,139,138,140,142,115,129,138,135,136,139,128,128,137,127,116,124,126,115,129,131,132,132,165,153,145,146,148,146,145,147,145,152,150,147,144,151,142,151,149,153,149,143,140,144,147,145,128,140,142,133,143,144,131,140,160,154,154,153,152,150,143,149,158,150,151,156,150,147,157,154,151,154,152,148,148,152,153,145,146,150,152,146,145,144,140,140,159,164,167,161,152,157,156,156,160,160,159,164,157,156,165,162,162,158,148,150,151,141,140,143,145,141,139,139,133,142,144,132,};
+static const PL_TEXEL building_01pallet_toptexturedata[1024] = {
+G_(167),G_(185),G_(183),G_(182),G_(174),G_(161),G_(168),G_(178),G_(179),G_(177),G_(176),G_(173),G_(173),G_(173),G_(171),G_(174),G_(184),G_(183),G_(183),G_(178),G_(171),G_(169),G_(165),G_(164),G_(177),G_(183),G_(184),G_(186),G_(180),G_(192),G_(202),G_(200),G_(157),G_(183),G_(178),G_(176),G_(170),G_(170),G_(168),G_(172),G_(175),G_(176),G_(171),G_(174),G_(171),G_(169),G_(170),G_(151),G_(147),G_(176),G_(167),G_(169),G_(167),G_(159),G_(156),G_(161),G_(161),G_(164),G_(164),G_(174),G_(177),G_(177),G_(178),G_(156),G_(153),G_(178),G_(174),G_(176),G_(167),G_(158),G_(166),G_(173),G_(174),G_(173),G_(169),G_(170),G_(165),G_(165),G_(163),G_(151),G_(150),G_(165),G_(167),G_(165),G_(166),G_(164),G_(159),G_(168),G_(163),G_(163),G_(160),G_(170),G_(173),G_(166),G_(162),G_(151),G_(123),G_(118),G_(102),G_(101),G_(112),G_(127),G_(134),G_(146),G_(157),G_(164),G_(165),G_(168),G_(163),G_(165),G_(164),G_(155),G_(156),G_(165),G_(172),G_(173),G_(176),G_(180),G_(177),G_(185),G_(171),G_(163),G_(163),G_(169),G_(167),G_(171),G_(169),G_(159),G_(177),G_(162),G_(80),G_(48),G_(66),G_(67),G_(60),G_(73),G_(85),G_(106),G_(124),G_(140),G_(154),G_(164),G_(168),G_(162),G_(165),G_(172),G_(171),G_(168),G_(173),G_(180),G_(176),G_(175),G_(172),G_(169),G_(168),G_(170),G_(166),G_(163),G_(163),G_(153),G_(197),G_(191),G_(120),G_(71),G_(86),G_(93),G_(80),G_(74),G_(63),G_(68),G_(77),G_(76),G_(69),G_(65),G_(53),G_(71),G_(107),G_(44),G_(58),G_(67),G_(66),G_(63),G_(58),G_(55),G_(54),G_(53),G_(59),G_(48),G_(39),G_(30),G_(56),G_(111),G_(202),G_(194),G_(143),G_(85),G_(92),G_(117),G_(124),G_(117),G_(100),G_(100),G_(107),G_(98),G_(89),G_(80),G_(67),G_(96),G_(137),G_(59),G_(79),G_(85),G_(81),G_(65),G_(61),G_(66),G_(66),G_(65),G_(63),G_(54),G_(54),G_(35),G_(70),G_(132),G_(204),G_(193),G_(151),G_(90),G_(93),G_(103),G_(116),G_(122),G_(123),G_(130),G_(120),G_(112),G_(108),G_(108),G_(107),G_(122),G_(142),G_(91),G_(120),G_(127),G_(105),G_(106),G_(109),G_(108),G_(106),G_(105),G_(104),G_(85),G_(83),G_(62),G_(80),G_(132),G_(202),G_(173),G_(145),G_(91),G_(96),G_(113),G_(126),G_(111),G_(115),G_(126),G_(124),G_(131),G_(127),G_(129),G_(125),G_(129),G_(144),G_(105),G_(133),G_(128),G_(112),G_(122),G_(125),G_(122),G_(121),G_(121),G_(120),G_(99),G_(91),G_(93),G_(86),G_(129),G_(205),G_(184),G_(160),G_(93),G_(101),G_(121),G_(104),G_(98),G_(111),G_(112),G_(125),G_(127),G_(119),G_(128),G_(128),G_(133),G_(145),G_(110),G_(135),G_(132),G_(133),G_(135),G_(133),G_(133),G_(129),G_(118),G_(106),G_(103),G_(95),G_(75),G_(85),G_(129),G_(206),G_(184),G_(161),G_(94),G_(104),G_(110),G_(95),G_(108),G_(112),G_(112),G_(110),G_(113),G_(112),G_(119),G_(121),G_(132),G_(142),G_(105),G_(127),G_(128),G_(127),G_(125),G_(123),G_(132),G_(128),G_(122),G_(114),G_(105),G_(92),G_(61),G_(83),G_(130),G_(205),G_(190),G_(160),G_(92),G_(99),G_(103),G_(99),G_(110),G_(111),G_(121),G_(123),G_(108),G_(116),G_(123),G_(107),G_(116),G_(143),G_(84),G_(105),G_(115),G_(121),G_(115),G_(111),G_(115),G_(116),G_(109),G_(93),G_(94),G_(72),G_(54),G_(83),G_(129),G_(203),G_(188),G_(159),G_(103),G_(114),G_(117),G_(117),G_(122),G_(124),G_(124),G_(132),G_(120),G_(105),G_(110),G_(103),G_(117),G_(139),G_(88),G_(113),G_(123),G_(120),G_(121),G_(119),G_(120),G_(119),G_(111),G_(94),G_(96),G_(78),G_(57),G_(81),G_(125),G_(183),G_(167),G_(150),G_(114),G_(130),G_(129),G_(122),G_(124),G_(133),G_(139),G_(142),G_(131),G_(123),G_(120),G_(111),G_(117),G_(137),G_(104),G_(118),G_(123),G_(123),G_(122),G_(123),G_(121),G_(116),G_(118),G_(110),G_(106),G_(97),G_(82),G_(93),G_(130),G_(140),G_(137),G_(135),G_(129),G_(140),G_(144),G_(146),G_(149),G_(144),G_(152),G_(154),G_(153),G_(150),G_(142),G_(135),G_(145),G_(140),G_(139),G_(139),G_(144),G_(155),G_(145),G_(145),G_(146),G_(140),G_(141),G_(135),G_(137),G_(130),G_(124),G_(119),G_(122),G_(141),G_(149),G_(155),G_(149),G_(142),G_(149),G_(159),G_(166),G_(160),G_(148),G_(121),G_(138),G_(138),G_(131),G_(152),G_(150),G_(138),G_(136),G_(119),G_(135),G_(148),G_(144),G_(146),G_(143),G_(150),G_(148),G_(146),G_(139),G_(134),G_(131),G_(126),G_(116),G_(144),G_(154),G_(156),G_(144),G_(139),G_(149),G_(152),G_(153),G_(153),G_(149),G_(140),G_(146),G_(152),G_(134),G_(139),G_(145),G_(143),G_(144),G_(143),G_(150),G_(148),G_(141),G_(151),G_(144),G_(152),G_(156),G_(154),G_(152),G_(147),G_(145),G_(141),G_(116),G_(145),G_(159),G_(160),G_(149),G_(160),G_(162),G_(156),G_(155),G_(152),G_(150),G_(150),G_(152),G_(154),G_(156),G_(153),G_(143),G_(135),G_(143),G_(146),G_(156),G_(156),G_(144),G_(139),G_(148),G_(150),G_(146),G_(145),G_(149),G_(149),G_(149),G_(142),G_(130),G_(129),G_(124),G_(85),G_(83),G_(92),G_(96),G_(96),G_(96),G_(84),G_(83),G_(90),G_(78),G_(90),G_(104),G_(112),G_(116),G_(106),G_(100),G_(102),G_(106),G_(107),G_(96),G_(100),G_(105),G_(112),G_(113),G_(105),G_(103),G_(105),G_(108),G_(110),G_(117),G_(168),G_(145),G_(60),G_(44),G_(67),G_(73),G_(68),G_(63),G_(54),G_(49),G_(53),G_(41),G_(56),G_(62),G_(65),G_(77),G_(75),G_(36),G_(56),G_(58),G_(61),G_(63),G_(62),G_(59),G_(57),G_(52),G_(39),G_(32),G_(33),G_(23),G_(54),G_(105),G_(180),G_(163),G_(93),G_(74),G_(95),G_(94),G_(84),G_(81),G_(89),G_(84),G_(85),G_(90),G_(88),G_(80),G_(89),G_(105),G_(101),G_(68),G_(95),G_(97),G_(97),G_(86),G_(80),G_(75),G_(69),G_(66),G_(62),G_(66),G_(65),G_(45),G_(66),G_(109),G_(180),G_(166),G_(104),G_(81),G_(84),G_(78),G_(78),G_(99),G_(93),G_(99),G_(105),G_(121),G_(96),G_(78),G_(89),G_(109),G_(112),G_(88),G_(116),G_(111),G_(96),G_(81),G_(78),G_(81),G_(88),G_(92),G_(94),G_(90),G_(77),G_(52),G_(71),G_(108),G_(176),G_(171),G_(113),G_(95),G_(110),G_(109),G_(99),G_(107),G_(103),G_(99),G_(111),G_(110),G_(87),G_(84),G_(102),G_(113),G_(106),G_(89),G_(109),G_(104),G_(96),G_(101),G_(99),G_(103),G_(109),G_(109),G_(94),G_(80),G_(70),G_(52),G_(74),G_(119),G_(166),G_(162),G_(119),G_(105),G_(118),G_(125),G_(120),G_(102),G_(116),G_(112),G_(120),G_(113),G_(98),G_(99),G_(105),G_(113),G_(110),G_(73),G_(94),G_(104),G_(106),G_(111),G_(113),G_(116),G_(117),G_(103),G_(87),G_(86),G_(82),G_(59),G_(73),G_(107),G_(155),G_(155),G_(121),G_(99),G_(117),G_(124),G_(120),G_(105),G_(93),G_(106),G_(108),G_(113),G_(108),G_(102),G_(92),G_(99),G_(117),G_(80),G_(101),G_(107),G_(106),G_(116),G_(118),G_(120),G_(106),G_(93),G_(91),G_(89),G_(78),G_(56),G_(70),G_(100),G_(154),G_(157),G_(115),G_(84),G_(108),G_(120),G_(107),G_(94),G_(83),G_(93),G_(90),G_(86),G_(80),G_(72),G_(64),G_(82),G_(109),G_(73),G_(91),G_(99),G_(98),G_(106),G_(108),G_(109),G_(104),G_(98),G_(81),G_(74),G_(60),G_(42),G_(59),G_(96),G_(157),G_(159),G_(135),G_(120),G_(138),G_(139),G_(121),G_(127),G_(141),G_(142),G_(140),G_(120),G_(114),G_(113),G_(113),G_(122),G_(139),G_(124),G_(128),G_(132),G_(132),G_(132),G_(128),G_(124),G_(126),G_(124),G_(117),G_(117),G_(114),G_(102),G_(107),G_(124),G_(150),G_(145),G_(128),G_(157),G_(168),G_(171),G_(165),G_(163),G_(169),G_(170),G_(168),G_(148),G_(147),G_(140),G_(130),G_(147),G_(149),G_(150),G_(146),G_(148),G_(138),G_(140),G_(140),G_(125),G_(128),G_(128),G_(125),G_(131),G_(144),G_(146),G_(144),G_(137),G_(151),G_(139),G_(120),G_(127),G_(135),G_(134),G_(136),G_(130),G_(131),G_(142),G_(139),G_(138),G_(140),G_(142),G_(115),G_(129),G_(138),G_(135),G_(136),G_(139),G_(128),G_(128),G_(137),G_(127),G_(116),G_(124),G_(126),G_(115),G_(129),G_(131),G_(132),G_(132),G_(165),G_(153),G_(145),G_(146),G_(148),G_(146),G_(145),G_(147),G_(145),G_(152),G_(150),G_(147),G_(144),G_(151),G_(142),G_(151),G_(149),G_(153),G_(149),G_(143),G_(140),G_(144),G_(147),G_(145),G_(128),G_(140),G_(142),G_(133),G_(143),G_(144),G_(131),G_(140),G_(160),G_(154),G_(154),G_(153),G_(152),G_(150),G_(143),G_(149),G_(158),G_(150),G_(151),G_(156),G_(150),G_(147),G_(157),G_(154),G_(151),G_(154),G_(152),G_(148),G_(148),G_(152),G_(153),G_(145),G_(146),G_(150),G_(152),G_(146),G_(145),G_(144),G_(140),G_(140),G_(159),G_(164),G_(167),G_(161),G_(152),G_(157),G_(156),G_(156),G_(160),G_(160),G_(159),G_(164),G_(157),G_(156),G_(165),G_(162),G_(162),G_(158),G_(148),G_(150),G_(151),G_(141),G_(140),G_(143),G_(145),G_(141),G_(139),G_(139),G_(133),G_(142),G_(144),G_(132),};
 static const struct PL_TEX_CONST building_01pallet_toptexture = {
 .data = building_01pallet_toptexturedata ,
 };
-static const int building_01panel_electrictexturedata[1024] = {
-151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,152,151,151,151,151,151,151,151,151,151,151,151,151,152,152,152,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,146,147,148,147,148,147,147,148,148,148,148,148,149,149,149,149,149,149,149,148,149,148,148,149,148,149,148,149,149,149,149,147,147,147,146,146,146,146,146,146,146,146,146,147,146,147,147,148,148,149,149,148,147,148,148,148,148,148,148,148,148,148,148,149,152,149,150,150,150,150,150,150,150,152,153,152,151,152,153,153,153,153,152,150,150,150,151,152,150,150,150,150,149,150,149,150,152,149,149,149,148,148,148,149,148,147,146,147,147,147,148,148,147,147,147,145,145,147,147,147,147,148,148,148,148,148,149,151,150,148,149,149,148,146,141,140,143,143,143,141,140,143,142,141,142,142,141,142,141,141,142,142,138,140,148,148,149,149,148,148,147,148,149,149,148,149,137,150,155,154,154,152,154,155,156,155,155,154,156,154,153,155,155,154,150,127,148,149,148,149,148,147,146,148,150,149,149,148,135,148,156,154,153,153,154,156,147,145,147,140,153,156,153,154,155,155,153,124,147,149,149,150,149,145,146,148,149,149,149,148,133,147,158,155,153,153,157,156,117,137,133,123,140,158,154,153,156,156,155,132,146,149,149,149,148,144,145,147,148,148,148,148,133,147,158,156,154,154,156,157,120,133,134,127,144,159,156,155,156,156,156,133,146,149,148,149,148,144,146,148,149,149,149,147,133,150,159,156,154,155,157,158,118,109,114,108,149,160,156,157,158,157,156,133,145,149,149,149,148,144,145,148,149,149,149,146,135,151,158,156,152,154,156,158,110,89,94,84,144,161,157,157,157,158,157,134,144,149,149,149,148,143,146,148,149,149,149,146,134,151,159,155,151,154,156,156,143,133,132,129,155,159,157,157,158,158,157,132,144,149,149,148,149,145,144,149,149,149,149,145,135,152,158,154,152,154,156,155,157,158,159,160,157,157,156,156,156,156,156,133,143,149,149,149,149,143,145,149,149,149,149,144,137,153,157,154,151,153,154,154,154,155,157,156,156,155,155,154,155,155,155,135,143,148,149,148,149,145,145,149,149,149,149,144,139,155,157,154,150,151,152,151,154,155,157,155,155,155,154,154,154,155,154,138,144,148,149,149,149,144,145,149,149,149,149,144,138,154,155,153,151,151,151,151,153,155,155,155,154,153,152,153,154,155,155,137,143,147,148,149,149,145,144,149,149,149,149,144,138,153,154,151,151,150,151,152,152,154,155,154,153,152,152,151,152,154,154,135,141,147,148,149,149,144,143,148,148,147,146,142,137,152,154,150,148,149,151,150,151,153,153,152,152,151,149,150,152,153,153,135,140,146,147,148,149,143,143,149,147,145,145,141,136,151,153,150,148,148,150,150,151,152,152,152,151,150,150,151,151,152,152,134,139,145,145,147,148,143,141,146,146,144,143,140,136,151,152,150,148,148,150,150,150,151,152,151,150,151,151,150,150,152,152,132,139,143,144,145,146,142,143,146,143,141,140,139,131,131,135,132,132,132,134,134,134,134,135,132,132,135,135,134,135,138,135,130,141,141,141,143,146,144,141,143,141,139,138,139,137,127,117,109,103,102,103,102,103,102,103,101,104,107,110,109,113,124,126,135,141,138,138,141,143,141,143,142,142,141,142,143,142,139,137,136,132,131,132,132,131,132,134,132,133,135,134,133,135,137,136,139,143,142,142,142,142,143,141,141,141,141,141,141,141,140,140,139,138,139,141,141,141,142,141,141,141,141,140,141,139,138,139,140,140,142,143,142,143,142,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,141,141,142,144,143,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,136,121,116,81,60,89,143,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,136,117,116,90,70,95,142,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,};
+static const PL_TEXEL building_01panel_electrictexturedata[1024] = {
+G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(152),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(152),G_(152),G_(152),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(151),G_(146),G_(147),G_(148),G_(147),G_(148),G_(147),G_(147),G_(148),G_(148),G_(148),G_(148),G_(148),G_(149),G_(149),G_(149),G_(149),G_(149),G_(149),G_(149),G_(148),G_(149),G_(148),G_(148),G_(149),G_(148),G_(149),G_(148),G_(149),G_(149),G_(149),G_(149),G_(147),G_(147),G_(147),G_(146),G_(146),G_(146),G_(146),G_(146),G_(146),G_(146),G_(146),G_(146),G_(147),G_(146),G_(147),G_(147),G_(148),G_(148),G_(149),G_(149),G_(148),G_(147),G_(148),G_(148),G_(148),G_(148),G_(148),G_(148),G_(148),G_(148),G_(148),G_(148),G_(149),G_(152),G_(149),G_(150),G_(150),G_(150),G_(150),G_(150),G_(150),G_(150),G_(152),G_(153),G_(152),G_(151),G_(152),G_(153),G_(153),G_(153),G_(153),G_(152),G_(150),G_(150),G_(150),G_(151),G_(152),G_(150),G_(150),G_(150),G_(150),G_(149),G_(150),G_(149),G_(150),G_(152),G_(149),G_(149),G_(149),G_(148),G_(148),G_(148),G_(149),G_(148),G_(147),G_(146),G_(147),G_(147),G_(147),G_(148),G_(148),G_(147),G_(147),G_(147),G_(145),G_(145),G_(147),G_(147),G_(147),G_(147),G_(148),G_(148),G_(148),G_(148),G_(148),G_(149),G_(151),G_(150),G_(148),G_(149),G_(149),G_(148),G_(146),G_(141),G_(140),G_(143),G_(143),G_(143),G_(141),G_(140),G_(143),G_(142),G_(141),G_(142),G_(142),G_(141),G_(142),G_(141),G_(141),G_(142),G_(142),G_(138),G_(140),G_(148),G_(148),G_(149),G_(149),G_(148),G_(148),G_(147),G_(148),G_(149),G_(149),G_(148),G_(149),G_(137),G_(150),G_(155),G_(154),G_(154),G_(152),G_(154),G_(155),G_(156),G_(155),G_(155),G_(154),G_(156),G_(154),G_(153),G_(155),G_(155),G_(154),G_(150),G_(127),G_(148),G_(149),G_(148),G_(149),G_(148),G_(147),G_(146),G_(148),G_(150),G_(149),G_(149),G_(148),G_(135),G_(148),G_(156),G_(154),G_(153),G_(153),G_(154),G_(156),G_(147),G_(145),G_(147),G_(140),G_(153),G_(156),G_(153),G_(154),G_(155),G_(155),G_(153),G_(124),G_(147),G_(149),G_(149),G_(150),G_(149),G_(145),G_(146),G_(148),G_(149),G_(149),G_(149),G_(148),G_(133),G_(147),G_(158),G_(155),G_(153),G_(153),G_(157),G_(156),G_(117),G_(137),G_(133),G_(123),G_(140),G_(158),G_(154),G_(153),G_(156),G_(156),G_(155),G_(132),G_(146),G_(149),G_(149),G_(149),G_(148),G_(144),G_(145),G_(147),G_(148),G_(148),G_(148),G_(148),G_(133),G_(147),G_(158),G_(156),G_(154),G_(154),G_(156),G_(157),G_(120),G_(133),G_(134),G_(127),G_(144),G_(159),G_(156),G_(155),G_(156),G_(156),G_(156),G_(133),G_(146),G_(149),G_(148),G_(149),G_(148),G_(144),G_(146),G_(148),G_(149),G_(149),G_(149),G_(147),G_(133),G_(150),G_(159),G_(156),G_(154),G_(155),G_(157),G_(158),G_(118),G_(109),G_(114),G_(108),G_(149),G_(160),G_(156),G_(157),G_(158),G_(157),G_(156),G_(133),G_(145),G_(149),G_(149),G_(149),G_(148),G_(144),G_(145),G_(148),G_(149),G_(149),G_(149),G_(146),G_(135),G_(151),G_(158),G_(156),G_(152),G_(154),G_(156),G_(158),G_(110),G_(89),G_(94),G_(84),G_(144),G_(161),G_(157),G_(157),G_(157),G_(158),G_(157),G_(134),G_(144),G_(149),G_(149),G_(149),G_(148),G_(143),G_(146),G_(148),G_(149),G_(149),G_(149),G_(146),G_(134),G_(151),G_(159),G_(155),G_(151),G_(154),G_(156),G_(156),G_(143),G_(133),G_(132),G_(129),G_(155),G_(159),G_(157),G_(157),G_(158),G_(158),G_(157),G_(132),G_(144),G_(149),G_(149),G_(148),G_(149),G_(145),G_(144),G_(149),G_(149),G_(149),G_(149),G_(145),G_(135),G_(152),G_(158),G_(154),G_(152),G_(154),G_(156),G_(155),G_(157),G_(158),G_(159),G_(160),G_(157),G_(157),G_(156),G_(156),G_(156),G_(156),G_(156),G_(133),G_(143),G_(149),G_(149),G_(149),G_(149),G_(143),G_(145),G_(149),G_(149),G_(149),G_(149),G_(144),G_(137),G_(153),G_(157),G_(154),G_(151),G_(153),G_(154),G_(154),G_(154),G_(155),G_(157),G_(156),G_(156),G_(155),G_(155),G_(154),G_(155),G_(155),G_(155),G_(135),G_(143),G_(148),G_(149),G_(148),G_(149),G_(145),G_(145),G_(149),G_(149),G_(149),G_(149),G_(144),G_(139),G_(155),G_(157),G_(154),G_(150),G_(151),G_(152),G_(151),G_(154),G_(155),G_(157),G_(155),G_(155),G_(155),G_(154),G_(154),G_(154),G_(155),G_(154),G_(138),G_(144),G_(148),G_(149),G_(149),G_(149),G_(144),G_(145),G_(149),G_(149),G_(149),G_(149),G_(144),G_(138),G_(154),G_(155),G_(153),G_(151),G_(151),G_(151),G_(151),G_(153),G_(155),G_(155),G_(155),G_(154),G_(153),G_(152),G_(153),G_(154),G_(155),G_(155),G_(137),G_(143),G_(147),G_(148),G_(149),G_(149),G_(145),G_(144),G_(149),G_(149),G_(149),G_(149),G_(144),G_(138),G_(153),G_(154),G_(151),G_(151),G_(150),G_(151),G_(152),G_(152),G_(154),G_(155),G_(154),G_(153),G_(152),G_(152),G_(151),G_(152),G_(154),G_(154),G_(135),G_(141),G_(147),G_(148),G_(149),G_(149),G_(144),G_(143),G_(148),G_(148),G_(147),G_(146),G_(142),G_(137),G_(152),G_(154),G_(150),G_(148),G_(149),G_(151),G_(150),G_(151),G_(153),G_(153),G_(152),G_(152),G_(151),G_(149),G_(150),G_(152),G_(153),G_(153),G_(135),G_(140),G_(146),G_(147),G_(148),G_(149),G_(143),G_(143),G_(149),G_(147),G_(145),G_(145),G_(141),G_(136),G_(151),G_(153),G_(150),G_(148),G_(148),G_(150),G_(150),G_(151),G_(152),G_(152),G_(152),G_(151),G_(150),G_(150),G_(151),G_(151),G_(152),G_(152),G_(134),G_(139),G_(145),G_(145),G_(147),G_(148),G_(143),G_(141),G_(146),G_(146),G_(144),G_(143),G_(140),G_(136),G_(151),G_(152),G_(150),G_(148),G_(148),G_(150),G_(150),G_(150),G_(151),G_(152),G_(151),G_(150),G_(151),G_(151),G_(150),G_(150),G_(152),G_(152),G_(132),G_(139),G_(143),G_(144),G_(145),G_(146),G_(142),G_(143),G_(146),G_(143),G_(141),G_(140),G_(139),G_(131),G_(131),G_(135),G_(132),G_(132),G_(132),G_(134),G_(134),G_(134),G_(134),G_(135),G_(132),G_(132),G_(135),G_(135),G_(134),G_(135),G_(138),G_(135),G_(130),G_(141),G_(141),G_(141),G_(143),G_(146),G_(144),G_(141),G_(143),G_(141),G_(139),G_(138),G_(139),G_(137),G_(127),G_(117),G_(109),G_(103),G_(102),G_(103),G_(102),G_(103),G_(102),G_(103),G_(101),G_(104),G_(107),G_(110),G_(109),G_(113),G_(124),G_(126),G_(135),G_(141),G_(138),G_(138),G_(141),G_(143),G_(141),G_(143),G_(142),G_(142),G_(141),G_(142),G_(143),G_(142),G_(139),G_(137),G_(136),G_(132),G_(131),G_(132),G_(132),G_(131),G_(132),G_(134),G_(132),G_(133),G_(135),G_(134),G_(133),G_(135),G_(137),G_(136),G_(139),G_(143),G_(142),G_(142),G_(142),G_(142),G_(143),G_(141),G_(141),G_(141),G_(141),G_(141),G_(141),G_(141),G_(140),G_(140),G_(139),G_(138),G_(139),G_(141),G_(141),G_(141),G_(142),G_(141),G_(141),G_(141),G_(141),G_(140),G_(141),G_(139),G_(138),G_(139),G_(140),G_(140),G_(142),G_(143),G_(142),G_(143),G_(142),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(141),G_(141),G_(142),G_(144),G_(143),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(136),G_(121),G_(116),G_(81),G_(60),G_(89),G_(143),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(136),G_(117),G_(116),G_(90),G_(70),G_(95),G_(142),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),G_(140),};
 static const struct PL_TEX_CONST building_01panel_electrictexture = {
 .data = building_01panel_electrictexturedata ,
 };
-static const int building_01propane_storagetexturedata[1024] = {
-189,189,189,189,189,189,189,189,189,189,189,189,188,188,189,189,189,188,189,189,189,189,187,189,189,189,189,187,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,188,187,187,188,188,188,187,188,187,188,187,187,188,187,188,187,187,188,187,189,189,189,189,189,189,189,189,189,189,189,189,189,189,188,188,188,187,188,188,188,188,187,188,188,188,188,188,189,188,188,188,188,189,189,189,189,189,189,189,189,189,189,189,189,189,188,188,187,187,188,188,188,187,187,188,188,188,187,187,188,188,187,187,188,189,189,189,189,189,189,189,189,189,189,189,189,189,188,188,188,187,189,189,189,188,188,189,188,189,188,189,189,187,188,187,188,190,190,189,189,190,189,189,188,188,186,185,185,186,182,182,177,186,180,176,178,180,181,182,183,182,180,180,186,188,188,187,187,178,182,185,184,180,180,176,179,178,175,174,174,174,169,169,167,176,145,115,137,127,121,124,141,133,139,148,176,179,181,175,175,164,139,133,138,138,132,127,134,139,139,134,158,158,149,149,150,152,143,105,111,113,110,126,120,120,116,131,170,166,169,164,163,173,131,126,129,134,126,127,129,132,132,128,156,183,131,127,130,127,108,138,166,161,164,171,165,167,165,131,193,187,190,189,188,178,137,133,139,148,87,85,156,142,140,137,162,185,168,161,151,166,147,146,188,173,179,182,181,172,182,122,166,164,159,164,175,181,146,145,154,94,75,95,122,159,142,137,165,190,184,165,155,172,163,144,183,183,185,177,179,177,177,129,180,178,175,178,178,181,154,151,153,141,174,181,136,159,144,141,166,186,186,134,139,148,166,145,184,182,183,178,175,178,176,136,193,189,189,188,189,182,155,155,154,153,182,183,165,162,145,143,168,173,188,156,144,153,168,148,185,182,185,165,169,188,178,134,192,188,187,185,186,181,153,154,156,150,144,156,168,166,151,143,173,182,189,191,188,197,164,142,178,177,181,175,171,174,167,132,192,187,187,180,181,180,151,154,155,156,153,152,155,155,157,152,177,188,178,174,175,176,159,118,128,129,129,126,123,123,119,135,177,174,174,173,182,183,148,150,148,152,157,161,155,154,160,149,179,191,136,105,110,109,109,113,111,112,113,111,112,112,111,110,111,143,132,149,184,186,149,146,148,149,157,158,145,142,149,148,177,189,138,114,124,126,121,120,122,125,128,124,123,121,120,122,123,164,160,174,187,181,148,144,151,151,152,148,147,147,150,155,177,186,143,129,129,131,126,125,127,131,132,131,130,127,131,131,129,138,133,138,186,184,152,150,154,157,154,153,159,158,158,162,179,186,143,132,140,140,135,126,130,138,142,140,134,127,137,140,140,135,124,126,185,188,171,169,168,169,171,174,174,173,176,177,186,188,142,133,143,146,139,124,125,127,129,123,119,120,127,128,126,121,113,123,184,185,145,148,155,151,150,153,152,150,152,157,178,190,144,135,143,133,130,126,126,130,133,127,124,123,125,127,129,121,111,128,183,185,151,158,163,162,156,159,163,159,153,154,177,189,142,128,136,131,130,125,125,133,134,131,132,126,129,131,128,122,116,136,182,183,158,161,162,160,160,159,159,157,155,153,178,188,164,153,157,163,162,160,161,163,163,162,161,159,159,160,161,157,156,162,180,185,162,152,151,151,156,153,152,153,156,155,178,184,146,133,136,130,134,132,134,133,134,134,134,137,143,145,143,142,145,152,177,187,163,148,154,154,154,151,154,154,159,160,179,182,129,125,122,118,115,108,112,111,107,111,104,105,110,116,118,118,108,127,178,188,159,150,157,159,157,158,160,161,162,161,179,187,137,137,133,132,127,122,125,130,124,123,117,115,121,117,118,118,106,126,178,189,155,155,159,160,158,165,169,166,163,160,181,187,131,134,141,140,134,129,132,138,136,133,128,120,129,129,128,126,110,120,177,189,153,144,156,154,156,167,175,160,155,155,182,186,129,123,126,127,127,125,126,128,124,123,126,120,131,131,133,115,103,127,177,185,148,144,145,151,153,157,160,154,151,154,183,183,126,121,124,125,126,126,126,129,126,121,126,122,127,116,126,106,104,138,175,182,143,143,147,154,154,156,159,156,155,157,183,180,126,123,124,126,128,126,125,125,125,125,130,125,127,119,122,113,110,133,175,179,132,134,144,152,152,153,152,153,156,164,180,175,135,139,130,128,132,132,126,125,126,123,127,126,123,121,128,119,118,124,173,176,161,166,172,177,178,176,175,176,184,186,182,179,176,180,172,155,166,168,169,168,166,164,168,167,168,163,164,159,155,152,173,};
+static const PL_TEXEL building_01propane_storagetexturedata[1024] = {
+G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(188),G_(188),G_(189),G_(189),G_(189),G_(188),G_(189),G_(189),G_(189),G_(189),G_(187),G_(189),G_(189),G_(189),G_(189),G_(187),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(188),G_(187),G_(187),G_(188),G_(188),G_(188),G_(187),G_(188),G_(187),G_(188),G_(187),G_(187),G_(188),G_(187),G_(188),G_(187),G_(187),G_(188),G_(187),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(188),G_(188),G_(188),G_(187),G_(188),G_(188),G_(188),G_(188),G_(187),G_(188),G_(188),G_(188),G_(188),G_(188),G_(189),G_(188),G_(188),G_(188),G_(188),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(188),G_(188),G_(187),G_(187),G_(188),G_(188),G_(188),G_(187),G_(187),G_(188),G_(188),G_(188),G_(187),G_(187),G_(188),G_(188),G_(187),G_(187),G_(188),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(189),G_(188),G_(188),G_(188),G_(187),G_(189),G_(189),G_(189),G_(188),G_(188),G_(189),G_(188),G_(189),G_(188),G_(189),G_(189),G_(187),G_(188),G_(187),G_(188),G_(190),G_(190),G_(189),G_(189),G_(190),G_(189),G_(189),G_(188),G_(188),G_(186),G_(185),G_(185),G_(186),G_(182),G_(182),G_(177),G_(186),G_(180),G_(176),G_(178),G_(180),G_(181),G_(182),G_(183),G_(182),G_(180),G_(180),G_(186),G_(188),G_(188),G_(187),G_(187),G_(178),G_(182),G_(185),G_(184),G_(180),G_(180),G_(176),G_(179),G_(178),G_(175),G_(174),G_(174),G_(174),G_(169),G_(169),G_(167),G_(176),G_(145),G_(115),G_(137),G_(127),G_(121),G_(124),G_(141),G_(133),G_(139),G_(148),G_(176),G_(179),G_(181),G_(175),G_(175),G_(164),G_(139),G_(133),G_(138),G_(138),G_(132),G_(127),G_(134),G_(139),G_(139),G_(134),G_(158),G_(158),G_(149),G_(149),G_(150),G_(152),G_(143),G_(105),G_(111),G_(113),G_(110),G_(126),G_(120),G_(120),G_(116),G_(131),G_(170),G_(166),G_(169),G_(164),G_(163),G_(173),G_(131),G_(126),G_(129),G_(134),G_(126),G_(127),G_(129),G_(132),G_(132),G_(128),G_(156),G_(183),G_(131),G_(127),G_(130),G_(127),G_(108),G_(138),G_(166),G_(161),G_(164),G_(171),G_(165),G_(167),G_(165),G_(131),G_(193),G_(187),G_(190),G_(189),G_(188),G_(178),G_(137),G_(133),G_(139),G_(148),G_(87),G_(85),G_(156),G_(142),G_(140),G_(137),G_(162),G_(185),G_(168),G_(161),G_(151),G_(166),G_(147),G_(146),G_(188),G_(173),G_(179),G_(182),G_(181),G_(172),G_(182),G_(122),G_(166),G_(164),G_(159),G_(164),G_(175),G_(181),G_(146),G_(145),G_(154),G_(94),G_(75),G_(95),G_(122),G_(159),G_(142),G_(137),G_(165),G_(190),G_(184),G_(165),G_(155),G_(172),G_(163),G_(144),G_(183),G_(183),G_(185),G_(177),G_(179),G_(177),G_(177),G_(129),G_(180),G_(178),G_(175),G_(178),G_(178),G_(181),G_(154),G_(151),G_(153),G_(141),G_(174),G_(181),G_(136),G_(159),G_(144),G_(141),G_(166),G_(186),G_(186),G_(134),G_(139),G_(148),G_(166),G_(145),G_(184),G_(182),G_(183),G_(178),G_(175),G_(178),G_(176),G_(136),G_(193),G_(189),G_(189),G_(188),G_(189),G_(182),G_(155),G_(155),G_(154),G_(153),G_(182),G_(183),G_(165),G_(162),G_(145),G_(143),G_(168),G_(173),G_(188),G_(156),G_(144),G_(153),G_(168),G_(148),G_(185),G_(182),G_(185),G_(165),G_(169),G_(188),G_(178),G_(134),G_(192),G_(188),G_(187),G_(185),G_(186),G_(181),G_(153),G_(154),G_(156),G_(150),G_(144),G_(156),G_(168),G_(166),G_(151),G_(143),G_(173),G_(182),G_(189),G_(191),G_(188),G_(197),G_(164),G_(142),G_(178),G_(177),G_(181),G_(175),G_(171),G_(174),G_(167),G_(132),G_(192),G_(187),G_(187),G_(180),G_(181),G_(180),G_(151),G_(154),G_(155),G_(156),G_(153),G_(152),G_(155),G_(155),G_(157),G_(152),G_(177),G_(188),G_(178),G_(174),G_(175),G_(176),G_(159),G_(118),G_(128),G_(129),G_(129),G_(126),G_(123),G_(123),G_(119),G_(135),G_(177),G_(174),G_(174),G_(173),G_(182),G_(183),G_(148),G_(150),G_(148),G_(152),G_(157),G_(161),G_(155),G_(154),G_(160),G_(149),G_(179),G_(191),G_(136),G_(105),G_(110),G_(109),G_(109),G_(113),G_(111),G_(112),G_(113),G_(111),G_(112),G_(112),G_(111),G_(110),G_(111),G_(143),G_(132),G_(149),G_(184),G_(186),G_(149),G_(146),G_(148),G_(149),G_(157),G_(158),G_(145),G_(142),G_(149),G_(148),G_(177),G_(189),G_(138),G_(114),G_(124),G_(126),G_(121),G_(120),G_(122),G_(125),G_(128),G_(124),G_(123),G_(121),G_(120),G_(122),G_(123),G_(164),G_(160),G_(174),G_(187),G_(181),G_(148),G_(144),G_(151),G_(151),G_(152),G_(148),G_(147),G_(147),G_(150),G_(155),G_(177),G_(186),G_(143),G_(129),G_(129),G_(131),G_(126),G_(125),G_(127),G_(131),G_(132),G_(131),G_(130),G_(127),G_(131),G_(131),G_(129),G_(138),G_(133),G_(138),G_(186),G_(184),G_(152),G_(150),G_(154),G_(157),G_(154),G_(153),G_(159),G_(158),G_(158),G_(162),G_(179),G_(186),G_(143),G_(132),G_(140),G_(140),G_(135),G_(126),G_(130),G_(138),G_(142),G_(140),G_(134),G_(127),G_(137),G_(140),G_(140),G_(135),G_(124),G_(126),G_(185),G_(188),G_(171),G_(169),G_(168),G_(169),G_(171),G_(174),G_(174),G_(173),G_(176),G_(177),G_(186),G_(188),G_(142),G_(133),G_(143),G_(146),G_(139),G_(124),G_(125),G_(127),G_(129),G_(123),G_(119),G_(120),G_(127),G_(128),G_(126),G_(121),G_(113),G_(123),G_(184),G_(185),G_(145),G_(148),G_(155),G_(151),G_(150),G_(153),G_(152),G_(150),G_(152),G_(157),G_(178),G_(190),G_(144),G_(135),G_(143),G_(133),G_(130),G_(126),G_(126),G_(130),G_(133),G_(127),G_(124),G_(123),G_(125),G_(127),G_(129),G_(121),G_(111),G_(128),G_(183),G_(185),G_(151),G_(158),G_(163),G_(162),G_(156),G_(159),G_(163),G_(159),G_(153),G_(154),G_(177),G_(189),G_(142),G_(128),G_(136),G_(131),G_(130),G_(125),G_(125),G_(133),G_(134),G_(131),G_(132),G_(126),G_(129),G_(131),G_(128),G_(122),G_(116),G_(136),G_(182),G_(183),G_(158),G_(161),G_(162),G_(160),G_(160),G_(159),G_(159),G_(157),G_(155),G_(153),G_(178),G_(188),G_(164),G_(153),G_(157),G_(163),G_(162),G_(160),G_(161),G_(163),G_(163),G_(162),G_(161),G_(159),G_(159),G_(160),G_(161),G_(157),G_(156),G_(162),G_(180),G_(185),G_(162),G_(152),G_(151),G_(151),G_(156),G_(153),G_(152),G_(153),G_(156),G_(155),G_(178),G_(184),G_(146),G_(133),G_(136),G_(130),G_(134),G_(132),G_(134),G_(133),G_(134),G_(134),G_(134),G_(137),G_(143),G_(145),G_(143),G_(142),G_(145),G_(152),G_(177),G_(187),G_(163),G_(148),G_(154),G_(154),G_(154),G_(151),G_(154),G_(154),G_(159),G_(160),G_(179),G_(182),G_(129),G_(125),G_(122),G_(118),G_(115),G_(108),G_(112),G_(111),G_(107),G_(111),G_(104),G_(105),G_(110),G_(116),G_(118),G_(118),G_(108),G_(127),G_(178),G_(188),G_(159),G_(150),G_(157),G_(159),G_(157),G_(158),G_(160),G_(161),G_(162),G_(161),G_(179),G_(187),G_(137),G_(137),G_(133),G_(132),G_(127),G_(122),G_(125),G_(130),G_(124),G_(123),G_(117),G_(115),G_(121),G_(117),G_(118),G_(118),G_(106),G_(126),G_(178),G_(189),G_(155),G_(155),G_(159),G_(160),G_(158),G_(165),G_(169),G_(166),G_(163),G_(160),G_(181),G_(187),G_(131),G_(134),G_(141),G_(140),G_(134),G_(129),G_(132),G_(138),G_(136),G_(133),G_(128),G_(120),G_(129),G_(129),G_(128),G_(126),G_(110),G_(120),G_(177),G_(189),G_(153),G_(144),G_(156),G_(154),G_(156),G_(167),G_(175),G_(160),G_(155),G_(155),G_(182),G_(186),G_(129),G_(123),G_(126),G_(127),G_(127),G_(125),G_(126),G_(128),G_(124),G_(123),G_(126),G_(120),G_(131),G_(131),G_(133),G_(115),G_(103),G_(127),G_(177),G_(185),G_(148),G_(144),G_(145),G_(151),G_(153),G_(157),G_(160),G_(154),G_(151),G_(154),G_(183),G_(183),G_(126),G_(121),G_(124),G_(125),G_(126),G_(126),G_(126),G_(129),G_(126),G_(121),G_(126),G_(122),G_(127),G_(116),G_(126),G_(106),G_(104),G_(138),G_(175),G_(182),G_(143),G_(143),G_(147),G_(154),G_(154),G_(156),G_(159),G_(156),G_(155),G_(157),G_(183),G_(180),G_(126),G_(123),G_(124),G_(126),G_(128),G_(126),G_(125),G_(125),G_(125),G_(125),G_(130),G_(125),G_(127),G_(119),G_(122),G_(113),G_(110),G_(133),G_(175),G_(179),G_(132),G_(134),G_(144),G_(152),G_(152),G_(153),G_(152),G_(153),G_(156),G_(164),G_(180),G_(175),G_(135),G_(139),G_(130),G_(128),G_(132),G_(132),G_(126),G_(125),G_(126),G_(123),G_(127),G_(126),G_(123),G_(121),G_(128),G_(119),G_(118),G_(124),G_(173),G_(176),G_(161),G_(166),G_(172),G_(177),G_(178),G_(176),G_(175),G_(176),G_(184),G_(186),G_(182),G_(179),G_(176),G_(180),G_(172),G_(155),G_(166),G_(168),G_(169),G_(168),G_(166),G_(164),G_(168),G_(167),G_(168),G_(163),G_(164),G_(159),G_(155),G_(152),G_(173),};
 static const struct PL_TEX_CONST building_01propane_storagetexture = {
 .data = building_01propane_storagetexturedata ,
 };
-static const int building_01shingles_old_01texturedata[1024] = {
-46,41,47,76,76,66,51,45,59,44,40,42,36,33,31,35,36,41,46,47,43,41,43,37,35,31,33,34,41,43,40,58,106,99,108,133,125,129,122,103,128,98,110,111,105,98,88,100,105,111,116,117,111,95,113,106,104,89,96,103,111,113,96,124,107,102,80,77,91,78,70,95,110,84,84,99,107,107,99,104,104,106,112,112,105,89,107,106,104,101,107,104,88,78,83,100,83,94,62,53,73,86,70,70,80,93,65,68,67,72,77,67,63,78,63,45,74,91,84,66,63,79,90,71,54,49,89,85,129,121,106,127,124,133,126,126,124,130,103,124,124,127,127,124,102,120,119,85,117,121,122,102,120,127,132,124,127,107,123,128,123,118,129,139,127,121,124,125,122,124,122,142,129,123,121,129,108,129,125,102,138,136,131,109,123,125,123,127,139,128,119,123,63,92,123,106,70,57,76,83,67,74,90,101,81,56,65,85,91,85,90,84,80,76,86,90,88,74,57,71,106,123,91,64,110,113,99,57,88,89,92,108,107,103,106,55,81,93,78,101,94,44,80,97,67,52,44,81,109,90,90,88,56,100,113,111,138,132,125,108,127,121,122,129,136,131,133,106,123,126,117,131,117,83,114,121,122,112,84,108,130,121,122,127,108,125,132,138,134,133,130,120,130,129,128,135,135,132,134,119,128,134,124,135,131,106,122,119,126,128,107,121,138,127,130,131,119,130,133,133,43,67,80,99,99,109,88,68,70,66,77,99,90,104,94,70,73,100,107,94,101,99,102,78,68,90,109,99,98,79,66,43,66,76,102,94,87,111,95,77,91,57,37,46,62,83,97,77,92,74,61,60,48,35,61,93,79,98,110,90,102,109,76,66,102,129,132,118,90,118,101,114,130,104,90,78,103,116,112,101,134,113,106,100,78,91,105,131,112,104,117,108,131,142,135,101,127,121,127,122,108,119,106,119,136,123,125,110,112,115,114,106,137,127,121,111,112,123,123,135,116,107,119,117,139,162,156,141,106,106,116,100,84,94,94,113,120,119,124,104,111,123,104,105,123,119,123,109,107,123,119,121,114,92,88,84,90,121,124,109,65,82,97,97,89,92,60,52,52,79,86,85,73,70,69,71,51,70,68,73,85,86,77,49,87,86,72,64,60,29,29,53,101,107,114,130,125,127,77,99,88,100,103,104,97,87,108,101,86,99,73,84,102,103,100,87,98,108,107,104,104,76,64,78,115,106,113,121,132,126,105,119,113,122,124,134,121,109,112,112,110,119,100,119,131,123,121,113,111,113,108,116,133,119,101,122,121,118,118,117,129,101,123,124,125,130,115,134,126,112,120,118,120,135,116,124,126,114,131,124,117,119,109,121,138,130,112,130,107,134,131,125,116,94,104,108,119,111,100,116,114,99,114,114,116,117,88,90,107,100,113,118,114,116,111,113,114,119,98,103,71,63,64,67,62,100,92,46,46,79,100,71,55,70,50,41,47,60,73,56,102,103,73,46,45,59,68,64,50,74,90,59,97,83,78,72,70,71,93,85,91,104,90,73,71,62,88,86,88,98,118,81,108,112,107,89,85,91,63,70,71,86,104,103,111,114,111,109,95,99,120,122,114,111,111,109,103,90,119,120,117,111,128,102,118,117,119,114,122,120,99,96,109,111,113,111,112,112,114,115,105,115,129,125,113,111,113,116,110,108,126,123,123,116,126,94,121,124,121,122,124,128,114,107,115,115,112,112,117,120,114,117,106,118,119,112,118,120,116,117,108,115,125,117,118,125,122,92,93,105,122,121,111,119,118,106,117,114,119,116,84,92,87,79,86,88,54,55,57,66,61,71,64,62,68,55,51,73,58,64,62,43,67,58,59,53,89,84,79,86,91,84,98,82,105,93,92,103,84,67,76,79,88,99,84,79,71,42,39,58,38,61,68,54,58,48,41,55,94,92,94,105,81,98,113,89,112,100,104,99,107,114,113,92,110,104,99,109,103,68,74,87,88,95,103,88,87,81,64,104,107,99,100,114,89,112,103,87,120,108,103,84,109,114,107,85,114,111,103,113,113,75,94,99,107,102,114,97,94,99,77,115,116,104,108,119,85,105,105,93,128,115,111,79,116,112,114,88,123,117,112,112,116,93,105,106,109,114,117,102,99,108,89,113,112,112,115,127,92,106,89,81,112,108,104,75,89,73,89,74,109,100,101,107,105,74,83,80,88,95,94,87,76,88,68,105,113,106,108,112,81,89,56,68,65,48,56,51,41,52,62,59,60,71,76,85,67,53,61,61,80,73,72,54,60,64,52,49,57,56,48,65,67,56,};
+static const PL_TEXEL building_01shingles_old_01texturedata[1024] = {
+G_(46),G_(41),G_(47),G_(76),G_(76),G_(66),G_(51),G_(45),G_(59),G_(44),G_(40),G_(42),G_(36),G_(33),G_(31),G_(35),G_(36),G_(41),G_(46),G_(47),G_(43),G_(41),G_(43),G_(37),G_(35),G_(31),G_(33),G_(34),G_(41),G_(43),G_(40),G_(58),G_(106),G_(99),G_(108),G_(133),G_(125),G_(129),G_(122),G_(103),G_(128),G_(98),G_(110),G_(111),G_(105),G_(98),G_(88),G_(100),G_(105),G_(111),G_(116),G_(117),G_(111),G_(95),G_(113),G_(106),G_(104),G_(89),G_(96),G_(103),G_(111),G_(113),G_(96),G_(124),G_(107),G_(102),G_(80),G_(77),G_(91),G_(78),G_(70),G_(95),G_(110),G_(84),G_(84),G_(99),G_(107),G_(107),G_(99),G_(104),G_(104),G_(106),G_(112),G_(112),G_(105),G_(89),G_(107),G_(106),G_(104),G_(101),G_(107),G_(104),G_(88),G_(78),G_(83),G_(100),G_(83),G_(94),G_(62),G_(53),G_(73),G_(86),G_(70),G_(70),G_(80),G_(93),G_(65),G_(68),G_(67),G_(72),G_(77),G_(67),G_(63),G_(78),G_(63),G_(45),G_(74),G_(91),G_(84),G_(66),G_(63),G_(79),G_(90),G_(71),G_(54),G_(49),G_(89),G_(85),G_(129),G_(121),G_(106),G_(127),G_(124),G_(133),G_(126),G_(126),G_(124),G_(130),G_(103),G_(124),G_(124),G_(127),G_(127),G_(124),G_(102),G_(120),G_(119),G_(85),G_(117),G_(121),G_(122),G_(102),G_(120),G_(127),G_(132),G_(124),G_(127),G_(107),G_(123),G_(128),G_(123),G_(118),G_(129),G_(139),G_(127),G_(121),G_(124),G_(125),G_(122),G_(124),G_(122),G_(142),G_(129),G_(123),G_(121),G_(129),G_(108),G_(129),G_(125),G_(102),G_(138),G_(136),G_(131),G_(109),G_(123),G_(125),G_(123),G_(127),G_(139),G_(128),G_(119),G_(123),G_(63),G_(92),G_(123),G_(106),G_(70),G_(57),G_(76),G_(83),G_(67),G_(74),G_(90),G_(101),G_(81),G_(56),G_(65),G_(85),G_(91),G_(85),G_(90),G_(84),G_(80),G_(76),G_(86),G_(90),G_(88),G_(74),G_(57),G_(71),G_(106),G_(123),G_(91),G_(64),G_(110),G_(113),G_(99),G_(57),G_(88),G_(89),G_(92),G_(108),G_(107),G_(103),G_(106),G_(55),G_(81),G_(93),G_(78),G_(101),G_(94),G_(44),G_(80),G_(97),G_(67),G_(52),G_(44),G_(81),G_(109),G_(90),G_(90),G_(88),G_(56),G_(100),G_(113),G_(111),G_(138),G_(132),G_(125),G_(108),G_(127),G_(121),G_(122),G_(129),G_(136),G_(131),G_(133),G_(106),G_(123),G_(126),G_(117),G_(131),G_(117),G_(83),G_(114),G_(121),G_(122),G_(112),G_(84),G_(108),G_(130),G_(121),G_(122),G_(127),G_(108),G_(125),G_(132),G_(138),G_(134),G_(133),G_(130),G_(120),G_(130),G_(129),G_(128),G_(135),G_(135),G_(132),G_(134),G_(119),G_(128),G_(134),G_(124),G_(135),G_(131),G_(106),G_(122),G_(119),G_(126),G_(128),G_(107),G_(121),G_(138),G_(127),G_(130),G_(131),G_(119),G_(130),G_(133),G_(133),G_(43),G_(67),G_(80),G_(99),G_(99),G_(109),G_(88),G_(68),G_(70),G_(66),G_(77),G_(99),G_(90),G_(104),G_(94),G_(70),G_(73),G_(100),G_(107),G_(94),G_(101),G_(99),G_(102),G_(78),G_(68),G_(90),G_(109),G_(99),G_(98),G_(79),G_(66),G_(43),G_(66),G_(76),G_(102),G_(94),G_(87),G_(111),G_(95),G_(77),G_(91),G_(57),G_(37),G_(46),G_(62),G_(83),G_(97),G_(77),G_(92),G_(74),G_(61),G_(60),G_(48),G_(35),G_(61),G_(93),G_(79),G_(98),G_(110),G_(90),G_(102),G_(109),G_(76),G_(66),G_(102),G_(129),G_(132),G_(118),G_(90),G_(118),G_(101),G_(114),G_(130),G_(104),G_(90),G_(78),G_(103),G_(116),G_(112),G_(101),G_(134),G_(113),G_(106),G_(100),G_(78),G_(91),G_(105),G_(131),G_(112),G_(104),G_(117),G_(108),G_(131),G_(142),G_(135),G_(101),G_(127),G_(121),G_(127),G_(122),G_(108),G_(119),G_(106),G_(119),G_(136),G_(123),G_(125),G_(110),G_(112),G_(115),G_(114),G_(106),G_(137),G_(127),G_(121),G_(111),G_(112),G_(123),G_(123),G_(135),G_(116),G_(107),G_(119),G_(117),G_(139),G_(162),G_(156),G_(141),G_(106),G_(106),G_(116),G_(100),G_(84),G_(94),G_(94),G_(113),G_(120),G_(119),G_(124),G_(104),G_(111),G_(123),G_(104),G_(105),G_(123),G_(119),G_(123),G_(109),G_(107),G_(123),G_(119),G_(121),G_(114),G_(92),G_(88),G_(84),G_(90),G_(121),G_(124),G_(109),G_(65),G_(82),G_(97),G_(97),G_(89),G_(92),G_(60),G_(52),G_(52),G_(79),G_(86),G_(85),G_(73),G_(70),G_(69),G_(71),G_(51),G_(70),G_(68),G_(73),G_(85),G_(86),G_(77),G_(49),G_(87),G_(86),G_(72),G_(64),G_(60),G_(29),G_(29),G_(53),G_(101),G_(107),G_(114),G_(130),G_(125),G_(127),G_(77),G_(99),G_(88),G_(100),G_(103),G_(104),G_(97),G_(87),G_(108),G_(101),G_(86),G_(99),G_(73),G_(84),G_(102),G_(103),G_(100),G_(87),G_(98),G_(108),G_(107),G_(104),G_(104),G_(76),G_(64),G_(78),G_(115),G_(106),G_(113),G_(121),G_(132),G_(126),G_(105),G_(119),G_(113),G_(122),G_(124),G_(134),G_(121),G_(109),G_(112),G_(112),G_(110),G_(119),G_(100),G_(119),G_(131),G_(123),G_(121),G_(113),G_(111),G_(113),G_(108),G_(116),G_(133),G_(119),G_(101),G_(122),G_(121),G_(118),G_(118),G_(117),G_(129),G_(101),G_(123),G_(124),G_(125),G_(130),G_(115),G_(134),G_(126),G_(112),G_(120),G_(118),G_(120),G_(135),G_(116),G_(124),G_(126),G_(114),G_(131),G_(124),G_(117),G_(119),G_(109),G_(121),G_(138),G_(130),G_(112),G_(130),G_(107),G_(134),G_(131),G_(125),G_(116),G_(94),G_(104),G_(108),G_(119),G_(111),G_(100),G_(116),G_(114),G_(99),G_(114),G_(114),G_(116),G_(117),G_(88),G_(90),G_(107),G_(100),G_(113),G_(118),G_(114),G_(116),G_(111),G_(113),G_(114),G_(119),G_(98),G_(103),G_(71),G_(63),G_(64),G_(67),G_(62),G_(100),G_(92),G_(46),G_(46),G_(79),G_(100),G_(71),G_(55),G_(70),G_(50),G_(41),G_(47),G_(60),G_(73),G_(56),G_(102),G_(103),G_(73),G_(46),G_(45),G_(59),G_(68),G_(64),G_(50),G_(74),G_(90),G_(59),G_(97),G_(83),G_(78),G_(72),G_(70),G_(71),G_(93),G_(85),G_(91),G_(104),G_(90),G_(73),G_(71),G_(62),G_(88),G_(86),G_(88),G_(98),G_(118),G_(81),G_(108),G_(112),G_(107),G_(89),G_(85),G_(91),G_(63),G_(70),G_(71),G_(86),G_(104),G_(103),G_(111),G_(114),G_(111),G_(109),G_(95),G_(99),G_(120),G_(122),G_(114),G_(111),G_(111),G_(109),G_(103),G_(90),G_(119),G_(120),G_(117),G_(111),G_(128),G_(102),G_(118),G_(117),G_(119),G_(114),G_(122),G_(120),G_(99),G_(96),G_(109),G_(111),G_(113),G_(111),G_(112),G_(112),G_(114),G_(115),G_(105),G_(115),G_(129),G_(125),G_(113),G_(111),G_(113),G_(116),G_(110),G_(108),G_(126),G_(123),G_(123),G_(116),G_(126),G_(94),G_(121),G_(124),G_(121),G_(122),G_(124),G_(128),G_(114),G_(107),G_(115),G_(115),G_(112),G_(112),G_(117),G_(120),G_(114),G_(117),G_(106),G_(118),G_(119),G_(112),G_(118),G_(120),G_(116),G_(117),G_(108),G_(115),G_(125),G_(117),G_(118),G_(125),G_(122),G_(92),G_(93),G_(105),G_(122),G_(121),G_(111),G_(119),G_(118),G_(106),G_(117),G_(114),G_(119),G_(116),G_(84),G_(92),G_(87),G_(79),G_(86),G_(88),G_(54),G_(55),G_(57),G_(66),G_(61),G_(71),G_(64),G_(62),G_(68),G_(55),G_(51),G_(73),G_(58),G_(64),G_(62),G_(43),G_(67),G_(58),G_(59),G_(53),G_(89),G_(84),G_(79),G_(86),G_(91),G_(84),G_(98),G_(82),G_(105),G_(93),G_(92),G_(103),G_(84),G_(67),G_(76),G_(79),G_(88),G_(99),G_(84),G_(79),G_(71),G_(42),G_(39),G_(58),G_(38),G_(61),G_(68),G_(54),G_(58),G_(48),G_(41),G_(55),G_(94),G_(92),G_(94),G_(105),G_(81),G_(98),G_(113),G_(89),G_(112),G_(100),G_(104),G_(99),G_(107),G_(114),G_(113),G_(92),G_(110),G_(104),G_(99),G_(109),G_(103),G_(68),G_(74),G_(87),G_(88),G_(95),G_(103),G_(88),G_(87),G_(81),G_(64),G_(104),G_(107),G_(99),G_(100),G_(114),G_(89),G_(112),G_(103),G_(87),G_(120),G_(108),G_(103),G_(84),G_(109),G_(114),G_(107),G_(85),G_(114),G_(111),G_(103),G_(113),G_(113),G_(75),G_(94),G_(99),G_(107),G_(102),G_(114),G_(97),G_(94),G_(99),G_(77),G_(115),G_(116),G_(104),G_(108),G_(119),G_(85),G_(105),G_(105),G_(93),G_(128),G_(115),G_(111),G_(79),G_(116),G_(112),G_(114),G_(88),G_(123),G_(117),G_(112),G_(112),G_(116),G_(93),G_(105),G_(106),G_(109),G_(114),G_(117),G_(102),G_(99),G_(108),G_(89),G_(113),G_(112),G_(112),G_(115),G_(127),G_(92),G_(106),G_(89),G_(81),G_(112),G_(108),G_(104),G_(75),G_(89),G_(73),G_(89),G_(74),G_(109),G_(100),G_(101),G_(107),G_(105),G_(74),G_(83),G_(80),G_(88),G_(95),G_(94),G_(87),G_(76),G_(88),G_(68),G_(105),G_(113),G_(106),G_(108),G_(112),G_(81),G_(89),G_(56),G_(68),G_(65),G_(48),G_(56),G_(51),G_(41),G_(52),G_(62),G_(59),G_(60),G_(71),G_(76),G_(85),G_(67),G_(53),G_(61),G_(61),G_(80),G_(73),G_(72),G_(54),G_(60),G_(64),G_(52),G_(49),G_(57),G_(56),G_(48),G_(65),G_(67),G_(56),};
 static const struct PL_TEX_CONST building_01shingles_old_01texture = {
 .data = building_01shingles_old_01texturedata ,
 };
-static const int building_01venttexturedata[1024] = {
-209,210,212,213,212,210,208,209,210,212,213,213,214,215,215,216,216,217,217,215,217,218,217,218,217,215,215,213,211,211,207,206,204,194,180,160,163,161,161,162,161,161,162,161,160,160,161,161,161,162,162,162,162,162,161,162,162,163,161,159,158,187,194,205,199,203,134,21,35,39,42,42,43,43,43,43,44,44,44,44,45,45,45,46,46,46,45,45,44,43,40,34,25,166,198,202,197,204,136,25,37,43,44,45,45,46,45,46,47,46,46,46,47,46,46,46,47,46,45,46,46,44,39,32,23,165,198,202,194,196,168,131,141,144,141,139,139,140,139,139,140,140,138,137,139,139,139,140,141,141,140,141,143,144,142,136,130,179,194,201,193,197,140,34,40,41,40,39,41,44,44,43,44,44,44,44,44,45,44,44,44,43,43,43,42,42,41,39,46,165,193,199,192,195,146,60,64,63,63,63,62,59,58,57,56,55,54,54,54,55,55,56,58,58,60,60,61,62,62,59,58,166,191,197,193,192,160,115,119,119,120,121,122,123,124,126,126,125,124,124,126,126,124,124,125,126,126,123,125,128,128,126,125,173,189,195,192,194,130,9,13,15,15,16,16,15,15,14,14,12,12,12,12,12,11,12,12,13,14,15,15,14,13,11,16,159,189,192,192,190,164,135,141,141,141,143,143,141,138,138,138,138,135,134,134,135,136,137,137,136,138,140,141,139,138,133,125,171,186,189,191,192,138,37,37,39,42,43,44,44,44,47,48,50,48,46,47,49,51,50,49,47,48,48,49,47,46,45,52,160,185,188,190,189,142,59,64,63,62,62,61,59,57,57,55,54,53,53,54,54,55,55,57,58,58,59,60,61,61,58,56,160,184,187,191,187,157,116,120,119,121,122,123,124,125,126,126,125,124,125,126,127,125,125,126,128,127,124,125,128,129,127,125,169,182,187,189,189,131,10,15,16,16,17,17,15,15,14,14,13,12,12,13,13,12,12,12,13,13,15,16,15,14,12,15,152,182,187,188,183,158,127,134,135,135,136,137,136,136,135,135,136,135,134,136,136,138,137,136,137,138,138,139,140,138,133,124,165,179,183,187,184,137,37,37,37,38,40,41,42,43,43,45,46,45,46,46,47,48,49,49,48,47,46,46,46,47,47,53,157,179,180,185,183,142,59,63,63,62,61,60,59,56,56,55,53,53,52,53,54,54,55,56,57,58,58,59,60,60,58,56,156,178,178,183,179,156,117,120,120,121,123,123,125,125,127,127,126,125,125,127,128,125,125,126,128,127,125,126,129,130,127,126,165,175,175,182,181,131,12,14,15,15,16,17,15,14,14,14,14,13,12,13,13,13,12,13,14,14,14,15,14,13,12,17,146,174,172,179,179,156,124,132,136,136,137,136,136,134,135,135,135,134,135,136,135,134,134,133,133,134,134,133,133,131,131,132,160,170,171,177,180,137,33,34,35,36,36,37,38,37,37,38,38,38,40,40,40,39,39,38,38,37,37,36,36,35,35,42,146,170,169,177,178,145,68,70,70,69,69,68,67,65,64,63,61,60,60,61,61,62,63,65,65,66,67,67,69,69,65,64,149,169,167,175,173,152,109,111,111,113,115,116,117,117,119,120,119,118,119,120,121,118,118,119,120,120,117,118,121,122,120,119,156,164,164,175,175,130,15,20,22,21,22,23,21,19,19,18,16,15,14,13,14,14,15,16,17,18,19,20,19,17,15,16,138,164,161,173,171,152,129,137,140,139,138,140,139,138,139,138,139,138,138,137,138,138,137,136,135,135,137,138,136,136,132,123,151,160,159,170,170,131,30,31,32,33,34,35,36,36,36,36,37,36,35,36,36,38,36,36,36,37,37,38,36,36,32,38,138,160,157,168,167,139,68,71,70,69,69,68,67,65,65,63,61,60,60,61,61,62,62,65,65,66,66,67,68,68,65,65,141,158,164,166,164,146,110,112,112,113,115,116,118,118,120,121,120,119,119,121,121,119,118,120,121,121,119,119,122,123,120,120,145,155,165,165,165,127,16,20,22,21,22,22,20,19,18,18,16,13,13,13,13,14,14,15,16,17,19,19,19,16,13,14,125,156,157,161,161,146,124,131,134,133,135,136,136,136,136,136,136,137,136,135,135,135,137,136,134,134,134,134,135,134,132,130,146,154,159,160,161,155,147,148,147,147,147,148,149,150,151,152,152,152,150,149,148,148,147,145,144,143,143,143,142,142,142,140,149,159,162,160,165,164,164,162,161,161,162,161,164,166,169,170,171,170,169,168,167,165,162,161,161,160,162,163,162,162,162,161,160,163,163,};
+static const PL_TEXEL building_01venttexturedata[1024] = {
+G_(209),G_(210),G_(212),G_(213),G_(212),G_(210),G_(208),G_(209),G_(210),G_(212),G_(213),G_(213),G_(214),G_(215),G_(215),G_(216),G_(216),G_(217),G_(217),G_(215),G_(217),G_(218),G_(217),G_(218),G_(217),G_(215),G_(215),G_(213),G_(211),G_(211),G_(207),G_(206),G_(204),G_(194),G_(180),G_(160),G_(163),G_(161),G_(161),G_(162),G_(161),G_(161),G_(162),G_(161),G_(160),G_(160),G_(161),G_(161),G_(161),G_(162),G_(162),G_(162),G_(162),G_(162),G_(161),G_(162),G_(162),G_(163),G_(161),G_(159),G_(158),G_(187),G_(194),G_(205),G_(199),G_(203),G_(134),G_(21),G_(35),G_(39),G_(42),G_(42),G_(43),G_(43),G_(43),G_(43),G_(44),G_(44),G_(44),G_(44),G_(45),G_(45),G_(45),G_(46),G_(46),G_(46),G_(45),G_(45),G_(44),G_(43),G_(40),G_(34),G_(25),G_(166),G_(198),G_(202),G_(197),G_(204),G_(136),G_(25),G_(37),G_(43),G_(44),G_(45),G_(45),G_(46),G_(45),G_(46),G_(47),G_(46),G_(46),G_(46),G_(47),G_(46),G_(46),G_(46),G_(47),G_(46),G_(45),G_(46),G_(46),G_(44),G_(39),G_(32),G_(23),G_(165),G_(198),G_(202),G_(194),G_(196),G_(168),G_(131),G_(141),G_(144),G_(141),G_(139),G_(139),G_(140),G_(139),G_(139),G_(140),G_(140),G_(138),G_(137),G_(139),G_(139),G_(139),G_(140),G_(141),G_(141),G_(140),G_(141),G_(143),G_(144),G_(142),G_(136),G_(130),G_(179),G_(194),G_(201),G_(193),G_(197),G_(140),G_(34),G_(40),G_(41),G_(40),G_(39),G_(41),G_(44),G_(44),G_(43),G_(44),G_(44),G_(44),G_(44),G_(44),G_(45),G_(44),G_(44),G_(44),G_(43),G_(43),G_(43),G_(42),G_(42),G_(41),G_(39),G_(46),G_(165),G_(193),G_(199),G_(192),G_(195),G_(146),G_(60),G_(64),G_(63),G_(63),G_(63),G_(62),G_(59),G_(58),G_(57),G_(56),G_(55),G_(54),G_(54),G_(54),G_(55),G_(55),G_(56),G_(58),G_(58),G_(60),G_(60),G_(61),G_(62),G_(62),G_(59),G_(58),G_(166),G_(191),G_(197),G_(193),G_(192),G_(160),G_(115),G_(119),G_(119),G_(120),G_(121),G_(122),G_(123),G_(124),G_(126),G_(126),G_(125),G_(124),G_(124),G_(126),G_(126),G_(124),G_(124),G_(125),G_(126),G_(126),G_(123),G_(125),G_(128),G_(128),G_(126),G_(125),G_(173),G_(189),G_(195),G_(192),G_(194),G_(130),G_(9),G_(13),G_(15),G_(15),G_(16),G_(16),G_(15),G_(15),G_(14),G_(14),G_(12),G_(12),G_(12),G_(12),G_(12),G_(11),G_(12),G_(12),G_(13),G_(14),G_(15),G_(15),G_(14),G_(13),G_(11),G_(16),G_(159),G_(189),G_(192),G_(192),G_(190),G_(164),G_(135),G_(141),G_(141),G_(141),G_(143),G_(143),G_(141),G_(138),G_(138),G_(138),G_(138),G_(135),G_(134),G_(134),G_(135),G_(136),G_(137),G_(137),G_(136),G_(138),G_(140),G_(141),G_(139),G_(138),G_(133),G_(125),G_(171),G_(186),G_(189),G_(191),G_(192),G_(138),G_(37),G_(37),G_(39),G_(42),G_(43),G_(44),G_(44),G_(44),G_(47),G_(48),G_(50),G_(48),G_(46),G_(47),G_(49),G_(51),G_(50),G_(49),G_(47),G_(48),G_(48),G_(49),G_(47),G_(46),G_(45),G_(52),G_(160),G_(185),G_(188),G_(190),G_(189),G_(142),G_(59),G_(64),G_(63),G_(62),G_(62),G_(61),G_(59),G_(57),G_(57),G_(55),G_(54),G_(53),G_(53),G_(54),G_(54),G_(55),G_(55),G_(57),G_(58),G_(58),G_(59),G_(60),G_(61),G_(61),G_(58),G_(56),G_(160),G_(184),G_(187),G_(191),G_(187),G_(157),G_(116),G_(120),G_(119),G_(121),G_(122),G_(123),G_(124),G_(125),G_(126),G_(126),G_(125),G_(124),G_(125),G_(126),G_(127),G_(125),G_(125),G_(126),G_(128),G_(127),G_(124),G_(125),G_(128),G_(129),G_(127),G_(125),G_(169),G_(182),G_(187),G_(189),G_(189),G_(131),G_(10),G_(15),G_(16),G_(16),G_(17),G_(17),G_(15),G_(15),G_(14),G_(14),G_(13),G_(12),G_(12),G_(13),G_(13),G_(12),G_(12),G_(12),G_(13),G_(13),G_(15),G_(16),G_(15),G_(14),G_(12),G_(15),G_(152),G_(182),G_(187),G_(188),G_(183),G_(158),G_(127),G_(134),G_(135),G_(135),G_(136),G_(137),G_(136),G_(136),G_(135),G_(135),G_(136),G_(135),G_(134),G_(136),G_(136),G_(138),G_(137),G_(136),G_(137),G_(138),G_(138),G_(139),G_(140),G_(138),G_(133),G_(124),G_(165),G_(179),G_(183),G_(187),G_(184),G_(137),G_(37),G_(37),G_(37),G_(38),G_(40),G_(41),G_(42),G_(43),G_(43),G_(45),G_(46),G_(45),G_(46),G_(46),G_(47),G_(48),G_(49),G_(49),G_(48),G_(47),G_(46),G_(46),G_(46),G_(47),G_(47),G_(53),G_(157),G_(179),G_(180),G_(185),G_(183),G_(142),G_(59),G_(63),G_(63),G_(62),G_(61),G_(60),G_(59),G_(56),G_(56),G_(55),G_(53),G_(53),G_(52),G_(53),G_(54),G_(54),G_(55),G_(56),G_(57),G_(58),G_(58),G_(59),G_(60),G_(60),G_(58),G_(56),G_(156),G_(178),G_(178),G_(183),G_(179),G_(156),G_(117),G_(120),G_(120),G_(121),G_(123),G_(123),G_(125),G_(125),G_(127),G_(127),G_(126),G_(125),G_(125),G_(127),G_(128),G_(125),G_(125),G_(126),G_(128),G_(127),G_(125),G_(126),G_(129),G_(130),G_(127),G_(126),G_(165),G_(175),G_(175),G_(182),G_(181),G_(131),G_(12),G_(14),G_(15),G_(15),G_(16),G_(17),G_(15),G_(14),G_(14),G_(14),G_(14),G_(13),G_(12),G_(13),G_(13),G_(13),G_(12),G_(13),G_(14),G_(14),G_(14),G_(15),G_(14),G_(13),G_(12),G_(17),G_(146),G_(174),G_(172),G_(179),G_(179),G_(156),G_(124),G_(132),G_(136),G_(136),G_(137),G_(136),G_(136),G_(134),G_(135),G_(135),G_(135),G_(134),G_(135),G_(136),G_(135),G_(134),G_(134),G_(133),G_(133),G_(134),G_(134),G_(133),G_(133),G_(131),G_(131),G_(132),G_(160),G_(170),G_(171),G_(177),G_(180),G_(137),G_(33),G_(34),G_(35),G_(36),G_(36),G_(37),G_(38),G_(37),G_(37),G_(38),G_(38),G_(38),G_(40),G_(40),G_(40),G_(39),G_(39),G_(38),G_(38),G_(37),G_(37),G_(36),G_(36),G_(35),G_(35),G_(42),G_(146),G_(170),G_(169),G_(177),G_(178),G_(145),G_(68),G_(70),G_(70),G_(69),G_(69),G_(68),G_(67),G_(65),G_(64),G_(63),G_(61),G_(60),G_(60),G_(61),G_(61),G_(62),G_(63),G_(65),G_(65),G_(66),G_(67),G_(67),G_(69),G_(69),G_(65),G_(64),G_(149),G_(169),G_(167),G_(175),G_(173),G_(152),G_(109),G_(111),G_(111),G_(113),G_(115),G_(116),G_(117),G_(117),G_(119),G_(120),G_(119),G_(118),G_(119),G_(120),G_(121),G_(118),G_(118),G_(119),G_(120),G_(120),G_(117),G_(118),G_(121),G_(122),G_(120),G_(119),G_(156),G_(164),G_(164),G_(175),G_(175),G_(130),G_(15),G_(20),G_(22),G_(21),G_(22),G_(23),G_(21),G_(19),G_(19),G_(18),G_(16),G_(15),G_(14),G_(13),G_(14),G_(14),G_(15),G_(16),G_(17),G_(18),G_(19),G_(20),G_(19),G_(17),G_(15),G_(16),G_(138),G_(164),G_(161),G_(173),G_(171),G_(152),G_(129),G_(137),G_(140),G_(139),G_(138),G_(140),G_(139),G_(138),G_(139),G_(138),G_(139),G_(138),G_(138),G_(137),G_(138),G_(138),G_(137),G_(136),G_(135),G_(135),G_(137),G_(138),G_(136),G_(136),G_(132),G_(123),G_(151),G_(160),G_(159),G_(170),G_(170),G_(131),G_(30),G_(31),G_(32),G_(33),G_(34),G_(35),G_(36),G_(36),G_(36),G_(36),G_(37),G_(36),G_(35),G_(36),G_(36),G_(38),G_(36),G_(36),G_(36),G_(37),G_(37),G_(38),G_(36),G_(36),G_(32),G_(38),G_(138),G_(160),G_(157),G_(168),G_(167),G_(139),G_(68),G_(71),G_(70),G_(69),G_(69),G_(68),G_(67),G_(65),G_(65),G_(63),G_(61),G_(60),G_(60),G_(61),G_(61),G_(62),G_(62),G_(65),G_(65),G_(66),G_(66),G_(67),G_(68),G_(68),G_(65),G_(65),G_(141),G_(158),G_(164),G_(166),G_(164),G_(146),G_(110),G_(112),G_(112),G_(113),G_(115),G_(116),G_(118),G_(118),G_(120),G_(121),G_(120),G_(119),G_(119),G_(121),G_(121),G_(119),G_(118),G_(120),G_(121),G_(121),G_(119),G_(119),G_(122),G_(123),G_(120),G_(120),G_(145),G_(155),G_(165),G_(165),G_(165),G_(127),G_(16),G_(20),G_(22),G_(21),G_(22),G_(22),G_(20),G_(19),G_(18),G_(18),G_(16),G_(13),G_(13),G_(13),G_(13),G_(14),G_(14),G_(15),G_(16),G_(17),G_(19),G_(19),G_(19),G_(16),G_(13),G_(14),G_(125),G_(156),G_(157),G_(161),G_(161),G_(146),G_(124),G_(131),G_(134),G_(133),G_(135),G_(136),G_(136),G_(136),G_(136),G_(136),G_(136),G_(137),G_(136),G_(135),G_(135),G_(135),G_(137),G_(136),G_(134),G_(134),G_(134),G_(134),G_(135),G_(134),G_(132),G_(130),G_(146),G_(154),G_(159),G_(160),G_(161),G_(155),G_(147),G_(148),G_(147),G_(147),G_(147),G_(148),G_(149),G_(150),G_(151),G_(152),G_(152),G_(152),G_(150),G_(149),G_(148),G_(148),G_(147),G_(145),G_(144),G_(143),G_(143),G_(143),G_(142),G_(142),G_(142),G_(140),G_(149),G_(159),G_(162),G_(160),G_(165),G_(164),G_(164),G_(162),G_(161),G_(161),G_(162),G_(161),G_(164),G_(166),G_(169),G_(170),G_(171),G_(170),G_(169),G_(168),G_(167),G_(165),G_(162),G_(161),G_(161),G_(160),G_(162),G_(163),G_(162),G_(162),G_(162),G_(161),G_(160),G_(163),G_(163),};
 static const struct PL_TEX_CONST building_01venttexture = {
 .data = building_01venttexturedata ,
 };
-static const int building_01window_moderntexturedata[1024] = {
-206,208,219,219,221,222,224,223,224,225,227,227,227,228,233,234,235,236,236,236,236,236,236,235,236,235,236,236,236,236,233,236,214,235,164,154,159,156,152,151,152,151,149,148,147,146,145,144,144,143,143,142,143,142,142,140,138,138,139,139,138,135,216,249,205,228,122,165,159,156,151,154,155,155,155,156,157,155,157,160,157,160,159,157,159,161,162,163,163,161,161,163,177,147,221,249,201,231,159,199,129,102,103,106,105,106,106,106,104,102,105,105,104,107,107,107,107,107,105,105,107,105,100,138,201,194,233,249,205,230,167,198,122,99,105,107,107,107,107,108,107,108,108,108,108,108,108,109,110,109,108,108,107,106,99,144,207,201,234,247,213,230,170,195,126,107,114,116,118,120,120,119,119,119,119,119,119,119,120,120,120,119,118,118,118,117,110,158,208,203,236,248,215,231,172,194,127,108,116,119,122,126,126,124,124,125,125,125,125,125,125,125,125,123,121,121,123,121,114,163,208,206,236,247,215,230,173,193,127,110,116,121,126,133,134,132,132,131,133,133,132,133,134,133,133,132,131,130,131,129,121,167,209,207,237,247,217,230,174,192,127,110,117,122,126,135,139,140,140,140,139,139,138,139,139,140,140,140,139,138,139,137,129,173,211,211,240,247,215,231,176,193,127,111,119,122,125,135,139,139,139,139,141,141,138,138,137,138,138,136,137,136,138,136,130,174,214,210,238,247,215,230,175,193,127,112,118,122,126,136,140,140,139,139,141,140,138,138,138,139,138,137,138,137,138,137,130,175,211,208,238,248,215,229,177,192,126,112,117,121,127,134,139,142,143,143,144,142,141,142,141,142,140,138,140,141,141,137,130,172,209,210,240,246,215,227,178,191,125,112,117,122,126,135,137,137,138,140,140,139,138,138,138,138,138,138,139,139,140,135,125,172,210,213,243,247,214,227,180,192,124,111,119,122,124,132,136,137,139,139,137,135,137,138,138,138,138,138,138,138,139,136,125,176,210,210,241,247,214,227,182,194,123,111,120,121,123,130,137,139,141,141,141,139,139,141,140,139,139,139,139,139,139,135,123,176,210,210,242,247,206,224,180,193,184,206,206,207,209,210,212,212,212,213,212,211,212,212,212,212,210,209,208,208,208,204,200,206,202,215,244,247,206,223,180,176,119,125,125,122,123,129,129,129,129,129,127,127,127,126,127,126,125,125,124,123,122,122,116,133,187,218,244,248,205,226,182,170,72,82,84,78,83,87,87,89,89,89,89,89,89,89,89,89,89,90,91,91,91,91,84,124,187,215,244,248,205,223,181,172,78,95,101,101,104,106,106,107,107,107,107,107,107,107,107,107,107,108,108,108,108,107,100,141,193,215,244,249,206,221,181,173,73,84,94,100,111,115,114,114,114,114,114,114,115,116,116,116,116,117,115,115,115,113,108,162,201,216,244,249,202,217,182,173,70,82,103,109,117,125,124,125,126,127,127,127,127,127,126,127,127,126,125,124,124,122,119,172,200,211,243,249,201,215,179,173,76,88,99,100,110,131,134,134,136,137,137,137,136,135,136,137,136,135,135,134,133,132,125,175,202,212,244,248,202,214,178,176,89,92,91,95,106,132,135,138,139,138,140,140,138,137,138,139,137,136,137,137,135,134,130,175,203,214,244,248,205,214,181,175,84,88,92,96,107,122,123,133,139,131,137,139,139,141,140,142,140,140,140,140,140,136,132,172,199,213,244,248,202,208,182,177,73,82,87,96,116,128,121,122,124,124,136,138,139,140,141,139,139,139,139,139,139,135,132,171,199,213,244,247,206,208,180,178,76,89,95,102,106,114,111,110,118,131,135,133,135,135,136,134,138,138,136,135,136,134,132,171,196,212,243,246,204,206,176,179,87,100,108,110,103,109,111,112,131,136,128,124,131,135,134,137,142,142,139,137,137,136,130,172,199,210,243,247,205,203,174,178,91,105,109,108,103,111,116,118,127,133,123,123,137,135,139,146,147,146,144,143,143,143,137,174,201,203,242,248,209,202,164,187,178,193,193,192,191,193,197,200,200,200,198,200,202,202,204,205,205,202,202,202,203,202,198,190,188,197,243,248,201,185,95,139,149,155,162,162,164,166,169,170,170,170,170,170,167,165,165,163,161,160,160,159,161,160,153,158,164,171,239,244,183,180,122,171,192,196,202,203,203,211,210,207,211,216,222,218,211,208,206,204,207,208,212,208,207,206,203,210,212,202,220,227,217,224,225,219,219,220,220,219,219,222,222,221,223,224,226,225,223,225,226,227,227,227,226,226,225,226,226,226,224,225,220,216,};
+static const PL_TEXEL building_01window_moderntexturedata[1024] = {
+G_(206),G_(208),G_(219),G_(219),G_(221),G_(222),G_(224),G_(223),G_(224),G_(225),G_(227),G_(227),G_(227),G_(228),G_(233),G_(234),G_(235),G_(236),G_(236),G_(236),G_(236),G_(236),G_(236),G_(235),G_(236),G_(235),G_(236),G_(236),G_(236),G_(236),G_(233),G_(236),G_(214),G_(235),G_(164),G_(154),G_(159),G_(156),G_(152),G_(151),G_(152),G_(151),G_(149),G_(148),G_(147),G_(146),G_(145),G_(144),G_(144),G_(143),G_(143),G_(142),G_(143),G_(142),G_(142),G_(140),G_(138),G_(138),G_(139),G_(139),G_(138),G_(135),G_(216),G_(249),G_(205),G_(228),G_(122),G_(165),G_(159),G_(156),G_(151),G_(154),G_(155),G_(155),G_(155),G_(156),G_(157),G_(155),G_(157),G_(160),G_(157),G_(160),G_(159),G_(157),G_(159),G_(161),G_(162),G_(163),G_(163),G_(161),G_(161),G_(163),G_(177),G_(147),G_(221),G_(249),G_(201),G_(231),G_(159),G_(199),G_(129),G_(102),G_(103),G_(106),G_(105),G_(106),G_(106),G_(106),G_(104),G_(102),G_(105),G_(105),G_(104),G_(107),G_(107),G_(107),G_(107),G_(107),G_(105),G_(105),G_(107),G_(105),G_(100),G_(138),G_(201),G_(194),G_(233),G_(249),G_(205),G_(230),G_(167),G_(198),G_(122),G_(99),G_(105),G_(107),G_(107),G_(107),G_(107),G_(108),G_(107),G_(108),G_(108),G_(108),G_(108),G_(108),G_(108),G_(109),G_(110),G_(109),G_(108),G_(108),G_(107),G_(106),G_(99),G_(144),G_(207),G_(201),G_(234),G_(247),G_(213),G_(230),G_(170),G_(195),G_(126),G_(107),G_(114),G_(116),G_(118),G_(120),G_(120),G_(119),G_(119),G_(119),G_(119),G_(119),G_(119),G_(119),G_(120),G_(120),G_(120),G_(119),G_(118),G_(118),G_(118),G_(117),G_(110),G_(158),G_(208),G_(203),G_(236),G_(248),G_(215),G_(231),G_(172),G_(194),G_(127),G_(108),G_(116),G_(119),G_(122),G_(126),G_(126),G_(124),G_(124),G_(125),G_(125),G_(125),G_(125),G_(125),G_(125),G_(125),G_(125),G_(123),G_(121),G_(121),G_(123),G_(121),G_(114),G_(163),G_(208),G_(206),G_(236),G_(247),G_(215),G_(230),G_(173),G_(193),G_(127),G_(110),G_(116),G_(121),G_(126),G_(133),G_(134),G_(132),G_(132),G_(131),G_(133),G_(133),G_(132),G_(133),G_(134),G_(133),G_(133),G_(132),G_(131),G_(130),G_(131),G_(129),G_(121),G_(167),G_(209),G_(207),G_(237),G_(247),G_(217),G_(230),G_(174),G_(192),G_(127),G_(110),G_(117),G_(122),G_(126),G_(135),G_(139),G_(140),G_(140),G_(140),G_(139),G_(139),G_(138),G_(139),G_(139),G_(140),G_(140),G_(140),G_(139),G_(138),G_(139),G_(137),G_(129),G_(173),G_(211),G_(211),G_(240),G_(247),G_(215),G_(231),G_(176),G_(193),G_(127),G_(111),G_(119),G_(122),G_(125),G_(135),G_(139),G_(139),G_(139),G_(139),G_(141),G_(141),G_(138),G_(138),G_(137),G_(138),G_(138),G_(136),G_(137),G_(136),G_(138),G_(136),G_(130),G_(174),G_(214),G_(210),G_(238),G_(247),G_(215),G_(230),G_(175),G_(193),G_(127),G_(112),G_(118),G_(122),G_(126),G_(136),G_(140),G_(140),G_(139),G_(139),G_(141),G_(140),G_(138),G_(138),G_(138),G_(139),G_(138),G_(137),G_(138),G_(137),G_(138),G_(137),G_(130),G_(175),G_(211),G_(208),G_(238),G_(248),G_(215),G_(229),G_(177),G_(192),G_(126),G_(112),G_(117),G_(121),G_(127),G_(134),G_(139),G_(142),G_(143),G_(143),G_(144),G_(142),G_(141),G_(142),G_(141),G_(142),G_(140),G_(138),G_(140),G_(141),G_(141),G_(137),G_(130),G_(172),G_(209),G_(210),G_(240),G_(246),G_(215),G_(227),G_(178),G_(191),G_(125),G_(112),G_(117),G_(122),G_(126),G_(135),G_(137),G_(137),G_(138),G_(140),G_(140),G_(139),G_(138),G_(138),G_(138),G_(138),G_(138),G_(138),G_(139),G_(139),G_(140),G_(135),G_(125),G_(172),G_(210),G_(213),G_(243),G_(247),G_(214),G_(227),G_(180),G_(192),G_(124),G_(111),G_(119),G_(122),G_(124),G_(132),G_(136),G_(137),G_(139),G_(139),G_(137),G_(135),G_(137),G_(138),G_(138),G_(138),G_(138),G_(138),G_(138),G_(138),G_(139),G_(136),G_(125),G_(176),G_(210),G_(210),G_(241),G_(247),G_(214),G_(227),G_(182),G_(194),G_(123),G_(111),G_(120),G_(121),G_(123),G_(130),G_(137),G_(139),G_(141),G_(141),G_(141),G_(139),G_(139),G_(141),G_(140),G_(139),G_(139),G_(139),G_(139),G_(139),G_(139),G_(135),G_(123),G_(176),G_(210),G_(210),G_(242),G_(247),G_(206),G_(224),G_(180),G_(193),G_(184),G_(206),G_(206),G_(207),G_(209),G_(210),G_(212),G_(212),G_(212),G_(213),G_(212),G_(211),G_(212),G_(212),G_(212),G_(212),G_(210),G_(209),G_(208),G_(208),G_(208),G_(204),G_(200),G_(206),G_(202),G_(215),G_(244),G_(247),G_(206),G_(223),G_(180),G_(176),G_(119),G_(125),G_(125),G_(122),G_(123),G_(129),G_(129),G_(129),G_(129),G_(129),G_(127),G_(127),G_(127),G_(126),G_(127),G_(126),G_(125),G_(125),G_(124),G_(123),G_(122),G_(122),G_(116),G_(133),G_(187),G_(218),G_(244),G_(248),G_(205),G_(226),G_(182),G_(170),G_(72),G_(82),G_(84),G_(78),G_(83),G_(87),G_(87),G_(89),G_(89),G_(89),G_(89),G_(89),G_(89),G_(89),G_(89),G_(89),G_(89),G_(90),G_(91),G_(91),G_(91),G_(91),G_(84),G_(124),G_(187),G_(215),G_(244),G_(248),G_(205),G_(223),G_(181),G_(172),G_(78),G_(95),G_(101),G_(101),G_(104),G_(106),G_(106),G_(107),G_(107),G_(107),G_(107),G_(107),G_(107),G_(107),G_(107),G_(107),G_(107),G_(108),G_(108),G_(108),G_(108),G_(107),G_(100),G_(141),G_(193),G_(215),G_(244),G_(249),G_(206),G_(221),G_(181),G_(173),G_(73),G_(84),G_(94),G_(100),G_(111),G_(115),G_(114),G_(114),G_(114),G_(114),G_(114),G_(114),G_(115),G_(116),G_(116),G_(116),G_(116),G_(117),G_(115),G_(115),G_(115),G_(113),G_(108),G_(162),G_(201),G_(216),G_(244),G_(249),G_(202),G_(217),G_(182),G_(173),G_(70),G_(82),G_(103),G_(109),G_(117),G_(125),G_(124),G_(125),G_(126),G_(127),G_(127),G_(127),G_(127),G_(127),G_(126),G_(127),G_(127),G_(126),G_(125),G_(124),G_(124),G_(122),G_(119),G_(172),G_(200),G_(211),G_(243),G_(249),G_(201),G_(215),G_(179),G_(173),G_(76),G_(88),G_(99),G_(100),G_(110),G_(131),G_(134),G_(134),G_(136),G_(137),G_(137),G_(137),G_(136),G_(135),G_(136),G_(137),G_(136),G_(135),G_(135),G_(134),G_(133),G_(132),G_(125),G_(175),G_(202),G_(212),G_(244),G_(248),G_(202),G_(214),G_(178),G_(176),G_(89),G_(92),G_(91),G_(95),G_(106),G_(132),G_(135),G_(138),G_(139),G_(138),G_(140),G_(140),G_(138),G_(137),G_(138),G_(139),G_(137),G_(136),G_(137),G_(137),G_(135),G_(134),G_(130),G_(175),G_(203),G_(214),G_(244),G_(248),G_(205),G_(214),G_(181),G_(175),G_(84),G_(88),G_(92),G_(96),G_(107),G_(122),G_(123),G_(133),G_(139),G_(131),G_(137),G_(139),G_(139),G_(141),G_(140),G_(142),G_(140),G_(140),G_(140),G_(140),G_(140),G_(136),G_(132),G_(172),G_(199),G_(213),G_(244),G_(248),G_(202),G_(208),G_(182),G_(177),G_(73),G_(82),G_(87),G_(96),G_(116),G_(128),G_(121),G_(122),G_(124),G_(124),G_(136),G_(138),G_(139),G_(140),G_(141),G_(139),G_(139),G_(139),G_(139),G_(139),G_(139),G_(135),G_(132),G_(171),G_(199),G_(213),G_(244),G_(247),G_(206),G_(208),G_(180),G_(178),G_(76),G_(89),G_(95),G_(102),G_(106),G_(114),G_(111),G_(110),G_(118),G_(131),G_(135),G_(133),G_(135),G_(135),G_(136),G_(134),G_(138),G_(138),G_(136),G_(135),G_(136),G_(134),G_(132),G_(171),G_(196),G_(212),G_(243),G_(246),G_(204),G_(206),G_(176),G_(179),G_(87),G_(100),G_(108),G_(110),G_(103),G_(109),G_(111),G_(112),G_(131),G_(136),G_(128),G_(124),G_(131),G_(135),G_(134),G_(137),G_(142),G_(142),G_(139),G_(137),G_(137),G_(136),G_(130),G_(172),G_(199),G_(210),G_(243),G_(247),G_(205),G_(203),G_(174),G_(178),G_(91),G_(105),G_(109),G_(108),G_(103),G_(111),G_(116),G_(118),G_(127),G_(133),G_(123),G_(123),G_(137),G_(135),G_(139),G_(146),G_(147),G_(146),G_(144),G_(143),G_(143),G_(143),G_(137),G_(174),G_(201),G_(203),G_(242),G_(248),G_(209),G_(202),G_(164),G_(187),G_(178),G_(193),G_(193),G_(192),G_(191),G_(193),G_(197),G_(200),G_(200),G_(200),G_(198),G_(200),G_(202),G_(202),G_(204),G_(205),G_(205),G_(202),G_(202),G_(202),G_(203),G_(202),G_(198),G_(190),G_(188),G_(197),G_(243),G_(248),G_(201),G_(185),G_(95),G_(139),G_(149),G_(155),G_(162),G_(162),G_(164),G_(166),G_(169),G_(170),G_(170),G_(170),G_(170),G_(170),G_(167),G_(165),G_(165),G_(163),G_(161),G_(160),G_(160),G_(159),G_(161),G_(160),G_(153),G_(158),G_(164),G_(171),G_(239),G_(244),G_(183),G_(180),G_(122),G_(171),G_(192),G_(196),G_(202),G_(203),G_(203),G_(211),G_(210),G_(207),G_(211),G_(216),G_(222),G_(218),G_(211),G_(208),G_(206),G_(204),G_(207),G_(208),G_(212),G_(208),G_(207),G_(206),G_(203),G_(210),G_(212),G_(202),G_(220),G_(227),G_(217),G_(224),G_(225),G_(219),G_(219),G_(220),G_(220),G_(219),G_(219),G_(222),G_(222),G_(221),G_(223),G_(224),G_(226),G_(225),G_(223),G_(225),G_(226),G_(227),G_(227),G_(227),G_(226),G_(226),G_(225),G_(226),G_(226),G_(226),G_(224),G_(225),G_(220),G_(216),};
 static const struct PL_TEX_CONST building_01window_moderntexture = {
 .data = building_01window_moderntexturedata ,
 };
@@ -4112,8 +4114,9 @@ static const struct PL_POLY_CONST building_01_polys[] = {
 .color = 255},
 };
 static const struct PL_OBJ_CONST building_01 = {
-.verts = building_01_vertices,
+.verts16 = building_01_vertices,
 .n_polys = 1551,
 .n_verts = 936,
 .polys = building_01_polys,
 };
+#undef G_
@@ -0,0 +1,188 @@
+#pragma once
+/* generated by tools/generate_trig_table.py */
+#if PL_TRIG_TABLE_BITS == 8
+const uint16_t PL_sin_q[65] = {
+0,804,1607,2410,3211,4011,4808,5602,6392,7179,7961,8739,
+9512,10278,11039,11793,12539,13278,14010,14732,15446,16151,16846,17530,
+18204,18868,19519,20159,20787,21403,22005,22594,23170,23732,24279,24812,
+25330,25832,26319,26790,27245,27684,28106,28511,28898,29269,29621,29956,
+30273,30572,30852,31114,31357,31581,31785,31971,32138,32285,32413,32521,
+32610,32679,32728,32758,32768,
+};
+#elif PL_TRIG_TABLE_BITS == 9
+const uint16_t PL_sin_q[129] = {
+0,402,804,1206,1607,2009,2410,2811,3211,3611,4011,4409,
+4808,5205,5602,5997,6392,6786,7179,7571,7961,8351,8739,9126,
+9512,9896,10278,10659,11039,11416,11793,12167,12539,12910,13278,13645,
+14010,14372,14732,15090,15446,15800,16151,16499,16846,17189,17530,17869,
+18204,18537,18868,19195,19519,19841,20159,20475,20787,21097,21403,21706,
+22005,22301,22594,22884,23170,23453,23732,24007,24279,24547,24812,25073,
+25330,25583,25832,26077,26319,26557,26790,27020,27245,27466,27684,27897,
+28106,28310,28511,28707,28898,29086,29269,29447,29621,29791,29956,30117,
+30273,30425,30572,30714,30852,30985,31114,31237,31357,31471,31581,31685,
+31785,31881,31971,32057,32138,32214,32285,32351,32413,32469,32521,32568,
+32610,32647,32679,32706,32728,32745,32758,32765,32768,
+};
+#elif PL_TRIG_TABLE_BITS == 10
+const uint16_t PL_sin_q[257] = {
+0,201,402,603,804,1005,1206,1407,1607,1808,2009,2210,
+2410,2611,2811,3011,3211,3411,3611,3811,4011,4210,4409,4609,
+4808,5006,5205,5403,5602,5800,5997,6195,6392,6589,6786,6983,
+7179,7375,7571,7766,7961,8156,8351,8545,8739,8933,9126,9319,
+9512,9704,9896,10087,10278,10469,10659,10849,11039,11228,11416,11605,
+11793,11980,12167,12353,12539,12725,12910,13094,13278,13462,13645,13828,
+14010,14191,14372,14552,14732,14912,15090,15269,15446,15623,15800,15976,
+16151,16325,16499,16673,16846,17018,17189,17360,17530,17700,17869,18037,
+18204,18371,18537,18703,18868,19032,19195,19358,19519,19681,19841,20001,
+20159,20318,20475,20631,20787,20942,21097,21250,21403,21555,21706,21856,
+22005,22154,22301,22448,22594,22740,22884,23027,23170,23312,23453,23593,
+23732,23870,24007,24144,24279,24414,24547,24680,24812,24943,25073,25201,
+25330,25457,25583,25708,25832,25955,26077,26199,26319,26438,26557,26674,
+26790,26905,27020,27133,27245,27356,27466,27576,27684,27791,27897,28002,
+28106,28208,28310,28411,28511,28609,28707,28803,28898,28993,29086,29178,
+29269,29359,29447,29535,29621,29707,29791,29874,29956,30037,30117,30196,
+30273,30350,30425,30499,30572,30644,30714,30784,30852,30919,30985,31050,
+31114,31176,31237,31298,31357,31414,31471,31526,31581,31634,31685,31736,
+31785,31834,31881,31927,31971,32015,32057,32098,32138,32176,32214,32250,
+32285,32319,32351,32383,32413,32442,32469,32496,32521,32545,32568,32589,
+32610,32629,32647,32663,32679,32693,32706,32718,32728,32737,32745,32752,
+32758,32762,32765,32767,32768,
+};
+#elif PL_TRIG_TABLE_BITS == 11
+const uint16_t PL_sin_q[513] = {
+0,100,201,301,402,502,603,703,804,904,1005,1105,
+1206,1306,1407,1507,1607,1708,1808,1909,2009,2109,2210,2310,
+2410,2510,2611,2711,2811,2911,3011,3111,3211,3311,3411,3511,
+3611,3711,3811,3911,4011,4110,4210,4310,4409,4509,4609,4708,
+4808,4907,5006,5106,5205,5304,5403,5503,5602,5701,5800,5898,
+5997,6096,6195,6294,6392,6491,6589,6688,6786,6884,6983,7081,
+7179,7277,7375,7473,7571,7669,7766,7864,7961,8059,8156,8254,
+8351,8448,8545,8642,8739,8836,8933,9029,9126,9223,9319,9415,
+9512,9608,9704,9800,9896,9991,10087,10183,10278,10374,10469,10564,
+10659,10754,10849,10944,11039,11133,11228,11322,11416,11511,11605,11699,
+11793,11886,11980,12073,12167,12260,12353,12446,12539,12632,12725,12817,
+12910,13002,13094,13186,13278,13370,13462,13554,13645,13736,13828,13919,
+14010,14100,14191,14282,14372,14462,14552,14642,14732,14822,14912,15001,
+15090,15180,15269,15357,15446,15535,15623,15712,15800,15888,15976,16063,
+16151,16238,16325,16413,16499,16586,16673,16759,16846,16932,17018,17104,
+17189,17275,17360,17445,17530,17615,17700,17784,17869,17953,18037,18121,
+18204,18288,18371,18454,18537,18620,18703,18785,18868,18950,19032,19113,
+19195,19276,19358,19439,19519,19600,19681,19761,19841,19921,20001,20080,
+20159,20239,20318,20396,20475,20553,20631,20709,20787,20865,20942,21020,
+21097,21173,21250,21326,21403,21479,21555,21630,21706,21781,21856,21931,
+22005,22080,22154,22228,22301,22375,22448,22521,22594,22667,22740,22812,
+22884,22956,23027,23099,23170,23241,23312,23382,23453,23523,23593,23662,
+23732,23801,23870,23939,24007,24075,24144,24211,24279,24346,24414,24480,
+24547,24614,24680,24746,24812,24877,24943,25008,25073,25137,25201,25266,
+25330,25393,25457,25520,25583,25645,25708,25770,25832,25894,25955,26016,
+26077,26138,26199,26259,26319,26379,26438,26498,26557,26615,26674,26732,
+26790,26848,26905,26963,27020,27076,27133,27189,27245,27301,27356,27411,
+27466,27521,27576,27630,27684,27737,27791,27844,27897,27949,28002,28054,
+28106,28157,28208,28259,28310,28361,28411,28461,28511,28560,28609,28658,
+28707,28755,28803,28851,28898,28946,28993,29039,29086,29132,29178,29223,
+29269,29314,29359,29403,29447,29491,29535,29578,29621,29664,29707,29749,
+29791,29833,29874,29915,29956,29997,30037,30077,30117,30156,30196,30235,
+30273,30312,30350,30387,30425,30462,30499,30535,30572,30608,30644,30679,
+30714,30749,30784,30818,30852,30886,30919,30952,30985,31018,31050,31082,
+31114,31145,31176,31207,31237,31268,31298,31327,31357,31386,31414,31443,
+31471,31499,31526,31554,31581,31607,31634,31660,31685,31711,31736,31761,
+31785,31810,31834,31857,31881,31904,31927,31949,31971,31993,32015,32036,
+32057,32078,32098,32118,32138,32157,32176,32195,32214,32232,32250,32268,
+32285,32302,32319,32335,32351,32367,32383,32398,32413,32427,32442,32456,
+32469,32483,32496,32509,32521,32533,32545,32557,32568,32579,32589,32600,
+32610,32619,32629,32638,32647,32655,32663,32671,32679,32686,32693,32700,
+32706,32712,32718,32723,32728,32733,32737,32741,32745,32749,32752,32755,
+32758,32760,32762,32764,32765,32766,32767,32767,32768,
+};
+#elif PL_TRIG_TABLE_BITS == 12
+const uint16_t PL_sin_q[1025] = {
+0,50,100,150,201,251,301,351,402,452,502,552,
+603,653,703,753,804,854,904,954,1005,1055,1105,1155,
+1206,1256,1306,1356,1407,1457,1507,1557,1607,1658,1708,1758,
+1808,1858,1909,1959,2009,2059,2109,2159,2210,2260,2310,2360,
+2410,2460,2510,2560,2611,2661,2711,2761,2811,2861,2911,2961,
+3011,3061,3111,3161,3211,3261,3311,3361,3411,3461,3511,3561,
+3611,3661,3711,3761,3811,3861,3911,3961,4011,4061,4110,4160,
+4210,4260,4310,4360,4409,4459,4509,4559,4609,4658,4708,4758,
+4808,4857,4907,4957,5006,5056,5106,5155,5205,5255,5304,5354,
+5403,5453,5503,5552,5602,5651,5701,5750,5800,5849,5898,5948,
+5997,6047,6096,6146,6195,6244,6294,6343,6392,6442,6491,6540,
+6589,6639,6688,6737,6786,6835,6884,6934,6983,7032,7081,7130,
+7179,7228,7277,7326,7375,7424,7473,7522,7571,7620,7669,7717,
+7766,7815,7864,7913,7961,8010,8059,8108,8156,8205,8254,8302,
+8351,8400,8448,8497,8545,8594,8642,8691,8739,8788,8836,8884,
+8933,8981,9029,9078,9126,9174,9223,9271,9319,9367,9415,9463,
+9512,9560,9608,9656,9704,9752,9800,9848,9896,9944,9991,10039,
+10087,10135,10183,10230,10278,10326,10374,10421,10469,10517,10564,10612,
+10659,10707,10754,10802,10849,10897,10944,10991,11039,11086,11133,11181,
+11228,11275,11322,11369,11416,11464,11511,11558,11605,11652,11699,11746,
+11793,11839,11886,11933,11980,12027,12073,12120,12167,12213,12260,12307,
+12353,12400,12446,12493,12539,12586,12632,12678,12725,12771,12817,12864,
+12910,12956,13002,13048,13094,13140,13186,13232,13278,13324,13370,13416,
+13462,13508,13554,13599,13645,13691,13736,13782,13828,13873,13919,13964,
+14010,14055,14100,14146,14191,14236,14282,14327,14372,14417,14462,14507,
+14552,14598,14642,14687,14732,14777,14822,14867,14912,14956,15001,15046,
+15090,15135,15180,15224,15269,15313,15357,15402,15446,15491,15535,15579,
+15623,15667,15712,15756,15800,15844,15888,15932,15976,16019,16063,16107,
+16151,16195,16238,16282,16325,16369,16413,16456,16499,16543,16586,16630,
+16673,16716,16759,16802,16846,16889,16932,16975,17018,17061,17104,17146,
+17189,17232,17275,17317,17360,17403,17445,17488,17530,17573,17615,17658,
+17700,17742,17784,17827,17869,17911,17953,17995,18037,18079,18121,18163,
+18204,18246,18288,18330,18371,18413,18454,18496,18537,18579,18620,18662,
+18703,18744,18785,18826,18868,18909,18950,18991,19032,19073,19113,19154,
+19195,19236,19276,19317,19358,19398,19439,19479,19519,19560,19600,19640,
+19681,19721,19761,19801,19841,19881,19921,19961,20001,20040,20080,20120,
+20159,20199,20239,20278,20318,20357,20396,20436,20475,20514,20553,20592,
+20631,20671,20709,20748,20787,20826,20865,20904,20942,20981,21020,21058,
+21097,21135,21173,21212,21250,21288,21326,21365,21403,21441,21479,21517,
+21555,21592,21630,21668,21706,21743,21781,21818,21856,21893,21931,21968,
+22005,22042,22080,22117,22154,22191,22228,22265,22301,22338,22375,22412,
+22448,22485,22521,22558,22594,22631,22667,22703,22740,22776,22812,22848,
+22884,22920,22956,22992,23027,23063,23099,23134,23170,23205,23241,23276,
+23312,23347,23382,23417,23453,23488,23523,23558,23593,23627,23662,23697,
+23732,23766,23801,23835,23870,23904,23939,23973,24007,24041,24075,24109,
+24144,24177,24211,24245,24279,24313,24346,24380,24414,24447,24480,24514,
+24547,24580,24614,24647,24680,24713,24746,24779,24812,24845,24877,24910,
+24943,24975,25008,25040,25073,25105,25137,25169,25201,25234,25266,25298,
+25330,25361,25393,25425,25457,25488,25520,25551,25583,25614,25645,25677,
+25708,25739,25770,25801,25832,25863,25894,25925,25955,25986,26016,26047,
+26077,26108,26138,26169,26199,26229,26259,26289,26319,26349,26379,26409,
+26438,26468,26498,26527,26557,26586,26615,26645,26674,26703,26732,26761,
+26790,26819,26848,26877,26905,26934,26963,26991,27020,27048,27076,27105,
+27133,27161,27189,27217,27245,27273,27301,27329,27356,27384,27411,27439,
+27466,27494,27521,27548,27576,27603,27630,27657,27684,27711,27737,27764,
+27791,27817,27844,27870,27897,27923,27949,27976,28002,28028,28054,28080,
+28106,28131,28157,28183,28208,28234,28259,28285,28310,28335,28361,28386,
+28411,28436,28461,28486,28511,28535,28560,28585,28609,28634,28658,28682,
+28707,28731,28755,28779,28803,28827,28851,28875,28898,28922,28946,28969,
+28993,29016,29039,29062,29086,29109,29132,29155,29178,29201,29223,29246,
+29269,29291,29314,29336,29359,29381,29403,29425,29447,29469,29491,29513,
+29535,29557,29578,29600,29621,29643,29664,29686,29707,29728,29749,29770,
+29791,29812,29833,29854,29874,29895,29915,29936,29956,29977,29997,30017,
+30037,30057,30077,30097,30117,30137,30156,30176,30196,30215,30235,30254,
+30273,30292,30312,30331,30350,30368,30387,30406,30425,30443,30462,30480,
+30499,30517,30535,30554,30572,30590,30608,30626,30644,30661,30679,30697,
+30714,30732,30749,30766,30784,30801,30818,30835,30852,30869,30886,30902,
+30919,30936,30952,30969,30985,31001,31018,31034,31050,31066,31082,31098,
+31114,31129,31145,31161,31176,31192,31207,31222,31237,31253,31268,31283,
+31298,31312,31327,31342,31357,31371,31386,31400,31414,31429,31443,31457,
+31471,31485,31499,31513,31526,31540,31554,31567,31581,31594,31607,31620,
+31634,31647,31660,31673,31685,31698,31711,31723,31736,31749,31761,31773,
+31785,31798,31810,31822,31834,31846,31857,31869,31881,31892,31904,31915,
+31927,31938,31949,31960,31971,31982,31993,32004,32015,32025,32036,32047,
+32057,32067,32078,32088,32098,32108,32118,32128,32138,32148,32157,32167,
+32176,32186,32195,32205,32214,32223,32232,32241,32250,32259,32268,32276,
+32285,32294,32302,32311,32319,32327,32335,32343,32351,32359,32367,32375,
+32383,32390,32398,32405,32413,32420,32427,32435,32442,32449,32456,32463,
+32469,32476,32483,32489,32496,32502,32509,32515,32521,32527,32533,32539,
+32545,32551,32557,32562,32568,32573,32579,32584,32589,32595,32600,32605,
+32610,32615,32619,32624,32629,32633,32638,32642,32647,32651,32655,32659,
+32663,32667,32671,32675,32679,32682,32686,32689,32693,32696,32700,32703,
+32706,32709,32712,32715,32718,32720,32723,32726,32728,32730,32733,32735,
+32737,32739,32741,32743,32745,32747,32749,32750,32752,32754,32755,32756,
+32758,32759,32760,32761,32762,32763,32764,32764,32765,32766,32766,32767,
+32767,32767,32767,32767,32768,
+};
+#else
+#error "no trig table for PL_TRIG_TABLE_BITS, extend tools/generate_trig_table.py"
+#endif
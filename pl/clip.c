@@ -34,6 +34,7 @@ int PL_vp_min_y;
 int PL_vp_max_y;
 int PL_vp_cen_x;
 int PL_vp_cen_y;
+int PL_vp_scale = PL_VP_SCALE_ONE;
 
 extern void
 PL_set_viewport(int minx, int miny, int maxx, int maxy, int update_center)
@@ -60,6 +61,23 @@ PL_set_viewport(int minx, int miny, int maxx, int maxy, int update_center)
 	}
 }
 
+extern void
+PL_set_render_scale(int scale)
+{
+	int w, h;
+
+	if (scale < 1) {
+		scale = 1;
+	}
+	if (scale > PL_VP_SCALE_ONE) {
+		scale = PL_VP_SCALE_ONE;
+	}
+	w = (PL_hres * scale + (PL_VP_SCALE_ONE >> 1)) >> 8;
+	h = (PL_vres * scale + (PL_VP_SCALE_ONE >> 1)) >> 8;
+	PL_vp_scale = scale;
+	PL_set_viewport(0, 0, (w > 0 ? w : 1) - 1, (h > 0 ? h : 1) - 1, 1);
+}
+
 static void
 doclip(int *L, int *R, int *out, int len, int bound, int comp, int ocomp)
 {
@@ -11,8 +11,11 @@
 
 #define PL_MAX_VERTICES_PER_OBJECT 4096
 #define PL_MAX_VERTICES_PER_OBJECT_IMODE 256
+/* imported models, bounds what a bad count can allocate */
+#define PL_MAX_POLYS_PER_OBJECT 8192
 
-/* texture side size is one, shifted by this number must be >= 2 */
+/* side of textures that don't set their own size, one shifted by this
+ * number must be >= 2 */
 #define PL_TEXTURE_SIZE_SHIFT 5 // 5 = 32x32, 4 = 16x16, 6 = 64x64
 
 // 16-bits instead of 32-bits
@@ -21,6 +24,7 @@
 //#define PL_COLOR_DEPTH_32 // default
 #define PL_COLOR_DEPTH_8 // L8
 //#define PL_COLOR_DEPTH_16 // RGB565
+//#define PL_COLOR_DEPTH_4 // L4 packed, two pixels per byte, widened to L8 for the panel
 
 #define PL_GFX_ATTRIBUTE __attribute__((optimize(3))) inline
 
@@ -29,4 +33,71 @@
 // Enable precalculated mul8 for speed, cancel reduces ram space.
 //#define PL_PRECALCULATED_MUL8_CONST
 
+// Matrix stack depth, each level is 48 bytes (32 with PL_MST_ROT16)
+#define PL_MAX_MST_DEPTH 16
+// Keep rotation/scale on the stack as 16-bit Q14, loses one bit of
+// precision on push and limits scale factors to under 2. Larger ones are
+// reported through EXT_error and saturate (in PL_mst_scale or on push).
+//#define PL_MST_ROT16
+
+// Farthest offset from the camera PL_mst_translate_world places an object
+// at. Translation * Q(PL_P) matrix products must fit 32 bits, which allows
+// 65535 units: 655 m with the 1 cm units of the obj2c tools (MUL_FLOAT
+// 100). Export coarser units for larger views, objects past the range are
+// skipped and counted in PL_STATS.world_skipped.
+#define PL_WORLD_RANGE ((1 << (31 - PL_P)) - 1)
+
+// Angle units per turn = 1 << PL_TRIG_BITS. sin/cos come from a quarter
+// wave table in flash with 1 << PL_TRIG_TABLE_BITS steps per turn (8..12,
+// tools/generate_trig_table.py), angles finer than the table are either
+// truncated or linearly interpolated with PL_TRIG_LERP. 8 / 8 without
+// PL_TRIG_LERP is the original 256 step table. The default 12 / 10 with
+// PL_TRIG_LERP keeps the same values at every 256th of a turn (PL_A256)
+// and costs 514 bytes of flash.
+#define PL_TRIG_BITS 12
+#define PL_TRIG_TABLE_BITS 10
+#define PL_TRIG_LERP
+
+// Transform 16 and 8-bit vertices (PL_OBJ_CONST.verts16 / verts8) with SMLAD on
+// Cortex-M4/M33 or SSE2 on x86 hosts and native_sim, plain C otherwise.
+#define PL_SIMD
+
+// Projection without a divide: 1/z from a table over the normalized z
+// mantissa, refined by PL_RECIP_NEWTON Newton steps (0 or 1). For cores
+// without a hardware divider (rpi_pico). pl_bench -a reports the error.
+//#define PL_RECIP_PROJECT
+#define PL_RECIP_LUT_BITS 8 // table entries = 1 << bits, 2 bytes each
+#define PL_RECIP_NEWTON 1
+
+// Fill polygons on a second thread while the next ones are calculated.
+// Stages only overlap on SMP targets or when the fill thread gets cpu time
+// the render thread would otherwise spend waiting.
+//#define PL_PIPELINE
+#define PL_PIPELINE_QUEUE_LEN 32 // polygons in flight, power of two
+#define PL_PIPELINE_STACK_SIZE 2048
+#define PL_PIPELINE_PRIORITY 5
+
+// Clear the depth buffer only every PL_ZBANDS frames (2, 4, 8 or 16).
+// Each frame tests and stores depth in its own band of the buffer's range
+// above those of the frames before it, so their values can stay. 2 bands
+// keep full precision and match the goldens (ctest runs them that way too),
+// every doubling after that costs a bit of depth: with 4 to 16 most golden
+// depth images are off by one and near ties flip single pixels.
+//#define PL_ZBANDS 2
+
+// Track the bounds of everything rasterized (PL_damage_get) so the demo
+// clears and sends only the changed part of the frame.
+#define PL_DAMAGE
+
+// The demo renders at a scale its frame time controller picks and scales
+// that up to fill the panel (src/dynres.c). Sends whole frames, the demo
+// ignores PL_DAMAGE then.
+//#define PL_DYNRES
+
+// PL_OVERDRAW counts only fragments passing the depth test instead of every
+// fragment a polygon covers (overdraw instead of depth complexity).
+//#define PL_OVERDRAW_DEPTH_TESTED
+#define PL_OVERDRAW_SCALE 32 // heat map grey levels per layer
+
+// Per frame render counters and stage timings in PL_stats
 #define PERFORMANCE_MEASURE
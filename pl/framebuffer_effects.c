@@ -1,4 +1,4 @@
-#include "config.h"
+#include "pl.h"
 #include <stdint.h>
 
 int delta_eq(int a, int b, int delta)
@@ -9,6 +9,7 @@ int delta_eq(int a, int b, int delta)
 
 void simple_edge(int *in, int *out, int len, int delta, int edgeColor)
 {
+	PL_TRACE_BEGIN(PL_TRACE_POST);
 	for(int i = 1; i < len; i++)
 	{
 		if (delta_eq(in[i], in[i - 1], delta) == 0)
@@ -16,23 +17,32 @@ void simple_edge(int *in, int *out, int len, int delta, int edgeColor)
 			out[i] = edgeColor;
 		}
 	}
+	PL_TRACE_END(PL_TRACE_POST);
 }
 
 #if defined(PL_COLOR_DEPTH_32)
 void simple_edge_2(int16_t *in, int *out, int len, int width, int delta, int edgeColor)
 #elif defined(PL_COLOR_DEPTH_16)
 void simple_edge_2(int16_t *in, uint16_t *out, int len, int width, int delta, uint16_t edgeColor)
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 void simple_edge_2(int16_t *in, uint8_t *out, int len, int width, int delta, uint8_t edgeColor)
 #endif
 {
+	PL_TRACE_BEGIN(PL_TRACE_POST);
 	for(int i = 1; i < len - width; i++)
 	{
 		if (delta_eq(in[i], in[i - 1], delta) == 0 || delta_eq(in[i], in[i + width], delta) == 0 )
 		{
+#if defined(PL_COLOR_DEPTH_4)
+			/* packed pixels, the left one in the high nibble */
+			int sh = (~i & 1) << 2;
+			out[i >> 1] = (out[i >> 1] & ~(0xf << sh)) | ((edgeColor >> 4) << sh);
+#else
 			out[i] = edgeColor;
+#endif
 		}
 	}
+	PL_TRACE_END(PL_TRACE_POST);
 }
 
 
@@ -8,6 +8,6 @@ void simple_edge(int *in, int *out, int len, int delta, int edgeColor);
 void simple_edge_2(int16_t *in, int *out, int len, int width, int delta, int edgeColor);
 #elif defined(PL_COLOR_DEPTH_16)
 void simple_edge_2(int16_t *in, uint16_t *out, int len, int width, int delta, uint16_t edgeColor);
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 void simple_edge_2(int16_t *in, uint8_t *out, int len, int width, int delta, uint8_t edgeColor);
 #endif
@@ -37,6 +37,29 @@ uint16_t *PL_video_buffer = NULL;
 #elif defined(PL_COLOR_DEPTH_8)
 uint8_t *PL_video_buffer = NULL;
 #define PL_VBUFFER_TYPE uint8_t*
+#elif defined(PL_COLOR_DEPTH_4)
+uint8_t *PL_video_buffer = NULL;
+#define PL_VBUFFER_TYPE int
+#endif
+
+/* Video buffer access from the kernels. With PL_COLOR_DEPTH_4 two pixels
+ * share a byte, the left one in the high nibble, so vbuf is a pixel offset
+ * instead of a pointer and VB_PUT keeps the top 4 bits of an 8-bit grey.
+ * VB_GET / VB_SET access the stored value as is. */
+#if defined(PL_COLOR_DEPTH_4)
+#define VB_AT(p)   (p)
+#define VB_NIB(vb) ((~(vb) & 1) << 2)
+#define VB_GET(vb) ((PL_video_buffer[(vb) >> 1] >> VB_NIB(vb)) & 0xf)
+#define VB_SET(vb, n)                                                         \
+	(PL_video_buffer[(vb) >> 1] =                                             \
+		 (PL_video_buffer[(vb) >> 1] & ~(0xf << VB_NIB(vb))) |                \
+		 ((n) << VB_NIB(vb)))
+#define VB_PUT(vb, c) VB_SET(vb, ((c) & 0xff) >> 4)
+#else
+#define VB_AT(p)      (PL_video_buffer + (p))
+#define VB_GET(vb)    (*(vb))
+#define VB_SET(vb, n) (*(vb) = (n))
+#define VB_PUT(vb, c) (*(vb) = (c))
 #endif
 
 #ifdef PL_REDUCED_DEPTH_PRECISION
@@ -45,11 +68,42 @@ int16_t *PL_depth_buffer = NULL;
 int *PL_depth_buffer = NULL;
 #endif
 
+/* Depth test from the kernels, sz is 1/Z interpolated with ZP bits.
+ * With PL_ZBANDS every frame stores its depth in its own band of the
+ * buffer's range, above the bands of the frames before it since the last
+ * clear, so their values lose against any of the current frame. */
+#ifdef PL_ZBANDS
+#if PL_ZBANDS == 2
+#define ZB_LOG 1
+#elif PL_ZBANDS == 4
+#define ZB_LOG 2
+#elif PL_ZBANDS == 8
+#define ZB_LOG 3
+#elif PL_ZBANDS == 16
+#define ZB_LOG 4
+#else
+#error "PL_ZBANDS must be 2, 4, 8 or 16"
+#endif
+#define ZB_SHIFT (ZB_LOG - 1) /* bits of depth given up, none for 2 */
+#define ZB_SPAN  ((int64_t)1 << (ZBUF_BITS - ZB_LOG))
+
+static int zband = PL_ZBANDS - 1; /* first PL_depth_frame clears */
+static int zbias;
+
+#define ZB_S (ZBUF_SHIFT + ZB_SHIFT)
+/* rounding sz up keeps the test (stored << ZBUF_SHIFT) < sz exactly */
+#define Z_PASS(zb, sz)  (*(zb) < zbias - (-(sz) >> ZB_S))
+#define Z_STORE(zb, sz) (*(zb) = ((sz) >> ZB_S) + zbias)
+#define Z_CLEAR         ZBUF_MIN
+#else
+#define Z_PASS(zb, sz)  ((*(zb) << ZBUF_SHIFT) < (sz))
+#define Z_STORE(zb, sz) (*(zb) = (sz) >> ZBUF_SHIFT)
+#define Z_CLEAR         0
+#endif
+
 #define ZP 15 /* z precision */
 
-#define TXSH   PL_REQ_TEX_LOG_DIM
-#define TXMSK  ((1 << (TXSH + PL_TP)) - 1)
-#define TXVMSK (TXMSK & (~((1 << PL_TP) - 1)))
+#define TXFRAC ((1 << PL_TP) - 1)
 
 #define ATTRIBS     8
 #define ATTRIB_BITS 3
@@ -64,11 +118,34 @@ int *PL_depth_buffer = NULL;
 #define UR(ytb) ((ytb) + 3)
 #define VR(ytb) ((ytb) + 5)
 
+#ifdef PERFORMANCE_MEASURE
+#define STAT_WRITE() (nwritten++)
+#else
+#define STAT_WRITE() ((void)0)
+#endif
+
+/* PL_OVERDRAW counters saturate at the largest video buffer value */
+#if defined(PL_COLOR_DEPTH_32)
+#define OVERDRAW_MAX INT_MAX
+#elif defined(PL_COLOR_DEPTH_16)
+#define OVERDRAW_MAX UINT16_MAX
+#elif defined(PL_COLOR_DEPTH_8)
+#define OVERDRAW_MAX UINT8_MAX
+#elif defined(PL_COLOR_DEPTH_4)
+#define OVERDRAW_MAX 0xf
+#endif
+
 #define SCANP       18
 #define SCANP_ROUND (1 << (SCANP - 1))
 
 static int scan_miny;
 static int scan_maxy;
+#ifdef PL_DAMAGE
+static int scan_minx;
+static int scan_maxx;
+/* bounds of what the kernels rasterized since PL_damage_reset */
+static struct PL_RECT damage = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+#endif
 
 /* integer reserve for data locality */
 static int g3dresv[PL_MAX_SCREENSIZE               /* x_L */
@@ -107,7 +184,7 @@ PL_init(int *video, int16_t *depth, int hres, int vres)
 #elif defined(PL_COLOR_DEPTH_16)
 extern void
 PL_init(uint16_t *video, int16_t *depth, int hres, int vres)
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 extern void
 PL_init(uint8_t *video, int16_t *depth, int hres, int vres)
 #endif
@@ -118,7 +195,7 @@ PL_init(int *video, int *depth, int hres, int vres)
 #elif defined(PL_COLOR_DEPTH_16)
 extern void
 PL_init(uint16_t *video, int *depth, int hres, int vres)
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 extern void
 PL_init(uint8_t *video, int *depth, int hres, int vres)
 #endif
@@ -142,6 +219,15 @@ PL_init(uint8_t *video, int *depth, int hres, int vres)
 	if (PL_video_buffer == NULL) {
 		EXT_error(PL_ERR_NO_MEM, "gfx", "no video buffer");
 	}
+#if defined(PL_COLOR_DEPTH_4)
+	if (hres & 1) {
+		EXT_error(PL_ERR_MISC, "gfx", "rows must be whole bytes");
+	}
+#endif
+
+#ifdef PL_RECIP_PROJECT
+	PL_recip_init();
+#endif
 
 #if defined(PL_PRECALCULATED_MUL8) && !defined(PL_PRECALCULATED_MUL8_CONST)
 	/* 8-bit * 8-bit number multiplication table */
@@ -162,17 +248,21 @@ PL_init(uint8_t *video, int *depth, int hres, int vres)
 		xLc[i] = INT_MAX;
 		xRc[i] = INT_MIN;
 	}
+#ifdef PL_ZBANDS
+	/* the new buffer holds anything, clear it on the first frame */
+	zband = PL_ZBANDS - 1;
+#endif
+}
 
-	/* sine is mirrored over X after PI */
-	for (i = 0; i < (PL_TRIGMAX >> 1); i++) {
-		PL_sin[(PL_TRIGMAX >> 1) + i] = -PL_sin[i];
-	}
-	/* construct cosine table by copying sine table */
-	for (i = 0; i < ((PL_TRIGMAX >> 1) + (PL_TRIGMAX >> 2)); i++) {
-		PL_cos[i] = PL_sin[i + (PL_TRIGMAX >> 2)];
-	}
-	for (i = 0; i < (PL_TRIGMAX >> 2); i++) {
-		PL_cos[i + ((PL_TRIGMAX >> 1) + (PL_TRIGMAX >> 2))] = PL_sin[i];
+/* the clears fill the first viewport row, the others are copies of it */
+static void
+repeat_row(void *row, int pitch)
+{
+	int y, n;
+
+	n = (PL_vp_max_x - PL_vp_min_x + 1) * pitch / PL_hres;
+	for (y = 1; y <= PL_vp_max_y - PL_vp_min_y; y++) {
+		memcpy((uint8_t *)row + y * pitch, row, n);
 	}
 }
 
@@ -191,16 +281,16 @@ packrgb(int r, int g, int b)
 extern void
 PL_clear_color_vp(int r, int g, int b)
 {
-	int hc, x, y, yoff;
+	int hc, x;
+	int *row;
 
 	hc = packrgb(r, g, b);
 
-	for (y = PL_vp_min_y; y <= PL_vp_max_y; y++) {
-		yoff = y * PL_hres;
-		for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
-			PL_video_buffer[x + yoff] = hc;
-		}
+	row = PL_video_buffer + PL_vp_min_y * PL_hres;
+	for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
+		row[x] = hc;
 	}
+	repeat_row(row + PL_vp_min_x, PL_hres * sizeof(*row));
 }
 
 #elif defined(PL_COLOR_DEPTH_16)
@@ -213,28 +303,54 @@ packrgb(uint8_t r, uint8_t g, uint8_t b)
 extern void
 PL_clear_color_vp(uint8_t r, uint8_t g, uint8_t b)
 {
-	int x, y, yoff;
+	int x;
 	uint16_t hc;
+	uint16_t *row;
 
 	hc = packrgb(r, g, b);
 
-	for (y = PL_vp_min_y; y <= PL_vp_max_y; y++) {
-		yoff = y * PL_hres;
-		for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
-			PL_video_buffer[x + yoff] = hc;
-		}
+	row = PL_video_buffer + PL_vp_min_y * PL_hres;
+	for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
+		row[x] = hc;
 	}
+	repeat_row(row + PL_vp_min_x, PL_hres * sizeof(*row));
 }
 #elif defined(PL_COLOR_DEPTH_8)
 extern void
 PL_clear_color_vp(uint8_t r, uint8_t g, uint8_t b)
 {
-	int x, y, yoff;
+	int y, n;
 
+	n = PL_vp_max_x - PL_vp_min_x + 1;
+	if (n == PL_hres) {
+		/* whole rows are one block */
+		memset(PL_video_buffer + PL_vp_min_y * PL_hres, r,
+			   n * (PL_vp_max_y - PL_vp_min_y + 1));
+		return;
+	}
 	for (y = PL_vp_min_y; y <= PL_vp_max_y; y++) {
-		yoff = y * PL_hres;
-		for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
-			PL_video_buffer[x + yoff] = r;
+		memset(PL_video_buffer + y * PL_hres + PL_vp_min_x, r, n);
+	}
+}
+#elif defined(PL_COLOR_DEPTH_4)
+extern void
+PL_clear_color_vp(uint8_t r, uint8_t g, uint8_t b)
+{
+	int y, p, n;
+
+	r >>= 4;
+	for (y = PL_vp_min_y; y <= PL_vp_max_y; y++) {
+		p = y * PL_hres + PL_vp_min_x;
+		n = PL_vp_max_x - PL_vp_min_x + 1;
+		/* odd ends share their byte with a pixel outside the viewport */
+		if (p & 1) {
+			VB_SET(p, r);
+			p++;
+			n--;
+		}
+		memset(PL_video_buffer + (p >> 1), r * 0x11, n >> 1);
+		if (n & 1) {
+			VB_SET(p + n - 1, r);
 		}
 	}
 }
@@ -243,21 +359,193 @@ PL_clear_color_vp(uint8_t r, uint8_t g, uint8_t b)
 extern void
 PL_clear_vp(int r, int g, int b)
 {
+#ifdef PERFORMANCE_MEASURE
+	uint32_t start_time = EXT_cycles();
+#endif
+
 	PL_clear_color_vp(r, g, b);
-	PL_clear_depth_vp();
+	PL_depth_frame();
+	PL_STAT_TIME(PL_STAGE_CLEAR, start_time);
 }
 
 extern void
 PL_clear_depth_vp(void)
 {
+	int x;
+	ZBUF_TYPE *row;
+
+	row = PL_depth_buffer + PL_vp_min_y * PL_hres;
+	for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
+		row[x] = Z_CLEAR;
+	}
+	repeat_row(row + PL_vp_min_x, PL_hres * sizeof(*row));
+}
+
+extern void
+PL_depth_frame(void)
+{
+#ifdef PL_ZBANDS
+	int i, n, c;
+
+	if (++zband == PL_ZBANDS) {
+		/* out of bands, anything drawn since the last clear goes.
+		 * One row by element, then doubling copies of what is set */
+		n = PL_hres * PL_vres;
+		for (i = 0; i < PL_hres; i++) {
+			PL_depth_buffer[i] = Z_CLEAR;
+		}
+		for (i = PL_hres; i < n; i += c) {
+			c = (i < n - i) ? i : n - i;
+			memcpy(PL_depth_buffer + i, PL_depth_buffer,
+				   c * sizeof(*PL_depth_buffer));
+		}
+		zband = 0;
+	}
+	zbias = (int)(ZBUF_MIN + zband * ZB_SPAN);
+#else
+	PL_clear_depth_vp();
+#endif
+}
+
+extern int
+PL_depth_at(int x, int y)
+{
+	int z = PL_depth_buffer[x + y * PL_hres];
+#ifdef PL_ZBANDS
+	int64_t d = (int64_t)z - zbias;
+
+	/* earlier frames' bands and the clear value are as far as it gets */
+	return d < 0 ? 0 : (int)(d << ZB_SHIFT);
+#else
+	return z;
+#endif
+}
+
+extern void
+PL_overdraw_resolve(struct PL_OVERDRAW_SUMMARY *out)
+{
+	struct PL_OVERDRAW_SUMMARY sum;
 	int x, y, yoff;
+	uint32_t c, g;
 
+	memset(&sum, 0, sizeof(sum));
 	for (y = PL_vp_min_y; y <= PL_vp_max_y; y++) {
 		yoff = y * PL_hres;
 		for (x = PL_vp_min_x; x <= PL_vp_max_x; x++) {
-			PL_depth_buffer[x + yoff] = 0;
+			c = VB_GET(VB_AT(x + yoff));
+			sum.pixels++;
+			sum.fragments += c;
+			if (c > sum.max) {
+				sum.max = c;
+			}
+			if (c > 0) {
+				sum.covered++;
+			}
+			if (c > 1) {
+				sum.overdrawn++;
+			}
+			g = c * PL_OVERDRAW_SCALE;
+			if (g > 255) {
+				g = 255;
+			}
+#if defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
+			VB_PUT(VB_AT(x + yoff), g);
+#else
+			PL_video_buffer[x + yoff] = packrgb(g, g, g);
+#endif
 		}
 	}
+	if (sum.pixels) {
+		sum.mean_q8 = (uint32_t)(((uint64_t)sum.fragments << 8) / sum.pixels);
+	}
+	if (out) {
+		*out = sum;
+	}
+}
+
+extern void
+PL_rect_union(struct PL_RECT *dst, const struct PL_RECT *src)
+{
+	if (PL_RECT_EMPTY(src)) {
+		return;
+	}
+	if (PL_RECT_EMPTY(dst)) {
+		*dst = *src;
+		return;
+	}
+	dst->x0 = src->x0 < dst->x0 ? src->x0 : dst->x0;
+	dst->y0 = src->y0 < dst->y0 ? src->y0 : dst->y0;
+	dst->x1 = src->x1 > dst->x1 ? src->x1 : dst->x1;
+	dst->y1 = src->y1 > dst->y1 ? src->y1 : dst->y1;
+}
+
+extern void
+PL_clear_rect(const struct PL_RECT *rc, int r, int g, int b)
+{
+	int x0 = PL_vp_min_x, y0 = PL_vp_min_y;
+	int x1 = PL_vp_max_x, y1 = PL_vp_max_y;
+
+	/* the viewport clears do the work on the overlap */
+	PL_vp_min_x = rc->x0 > x0 ? rc->x0 : x0;
+	PL_vp_min_y = rc->y0 > y0 ? rc->y0 : y0;
+	PL_vp_max_x = rc->x1 < x1 ? rc->x1 : x1;
+	PL_vp_max_y = rc->y1 < y1 ? rc->y1 : y1;
+	if (PL_vp_min_x <= PL_vp_max_x && PL_vp_min_y <= PL_vp_max_y) {
+		PL_clear_color_vp(r, g, b);
+#ifndef PL_ZBANDS
+		PL_clear_depth_vp();
+#endif
+	}
+	PL_vp_min_x = x0;
+	PL_vp_min_y = y0;
+	PL_vp_max_x = x1;
+	PL_vp_max_y = y1;
+#ifdef PL_ZBANDS
+	/* older depth is in lower bands wherever it is */
+	PL_depth_frame();
+#endif
+}
+
+#ifdef PL_DAMAGE
+static void
+damage_add(int x0, int y0, int x1, int y1)
+{
+	if (x0 < damage.x0) {
+		damage.x0 = x0;
+	}
+	if (y0 < damage.y0) {
+		damage.y0 = y0;
+	}
+	if (x1 > damage.x1) {
+		damage.x1 = x1;
+	}
+	if (y1 > damage.y1) {
+		damage.y1 = y1;
+	}
+}
+#endif
+
+extern void
+PL_damage_reset(void)
+{
+#ifdef PL_DAMAGE
+	damage.x0 = damage.y0 = INT_MAX;
+	damage.x1 = damage.y1 = INT_MIN;
+#endif
+}
+
+extern void
+PL_damage_get(struct PL_RECT *r)
+{
+#ifdef PL_DAMAGE
+	*r = damage;
+#else
+	/* untracked, everything may have changed */
+	r->x0 = PL_vp_min_x;
+	r->y0 = PL_vp_min_y;
+	r->x1 = PL_vp_max_x;
+	r->y1 = PL_vp_max_y;
+#endif
 }
 
 static int resv[PL_VDIM + PL_VDIM + (PL_MAX_POLY_VERTS * PL_STREAM_TEX)];
@@ -281,6 +569,10 @@ pscan(int *stream, int dim, int len)
 	rdim = dim - 2;
 	scan_miny = INT_MAX;
 	scan_maxy = INT_MIN;
+#ifdef PL_DAMAGE
+	scan_minx = INT_MAX;
+	scan_maxx = INT_MIN;
+#endif
 	/* clean scan tables */
 	memcpy(x_L, xLc, 2 * PL_vres * sizeof(int));
 
@@ -307,6 +599,21 @@ pscan(int *stream, int dim, int len)
 		if (dy > scan_maxy) {
 			scan_maxy = dy;
 		}
+#ifdef PL_DAMAGE
+		/* x is already clipped, the edge ends bound the spans */
+		if (x < scan_minx) {
+			scan_minx = x;
+		}
+		if (x > scan_maxx) {
+			scan_maxx = x;
+		}
+		if (dx < scan_minx) {
+			scan_minx = dx;
+		}
+		if (dx > scan_maxx) {
+			scan_maxx = dx;
+		}
+#endif
 		dx -= x;
 		dy -= y;
 		mjr = dx;
@@ -360,6 +667,11 @@ pscan(int *stream, int dim, int len)
 			}
 		} while (mjr--);
 	}
+#ifdef PL_DAMAGE
+	if (scan_miny < scan_maxy) {
+		damage_add(scan_minx, scan_miny, scan_maxx, scan_maxy);
+	}
+#endif
 	return (scan_miny >= scan_maxy);
 }
 
@@ -370,6 +682,9 @@ PL_flat_poly(int *stream, int len, int rgb)
 	int pos, beg, pbg;
 	register PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
 	int d, yt, dz, sz, dlen;
 	int r8 = rgb >> 16 & 0xff;
 	int g8 = rgb >> 8 & 0xff;
@@ -380,29 +695,32 @@ PL_flat_poly(int *stream, int len, int rgb)
 	}
 	miny = scan_miny;
 	maxy = scan_maxy;
+	PL_STAT_ADD(spans, maxy - miny + 1);
 	pos = miny * PL_hres;
 	while (miny <= maxy) {
 		beg = x_L[miny];
 		pbg = pos + beg;
-		vbuf = PL_video_buffer + pbg;
+		vbuf = VB_AT(pbg);
 		zbuf = PL_depth_buffer + pbg;
 		len = x_R[miny] - beg;
+		PL_STAT_ADD(pixels_tested, len + 1);
 		dlen = len + (len == 0);
 		yt = YT(miny);
 		sz = attrbuf[ZL(yt)];
 		dz = (attrbuf[ZR(yt)] - sz) / dlen;
 
 		do {
-			if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
+			if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
 				d = (sz >> 20) * 3 / 2;
 				if (d >= 256) {
-					*vbuf = rgb;
+					VB_PUT(vbuf, rgb);
 				} else {
 					#if defined(PL_PRECALCULATED_MUL8)
-					*vbuf = mul8[d][r8] << 16 | mul8[d][g8] << 8 | mul8[d][b8];
+					VB_PUT(vbuf, mul8[d][r8] << 16 | mul8[d][g8] << 8 | mul8[d][b8]);
 					#else
-					*vbuf = (d * r8 >> 8) << 16 | (d * g8 >> 8) << 8 | d * b8 >> 8;
+					VB_PUT(vbuf, (d * r8 >> 8) << 16 | (d * g8 >> 8) << 8 | d * b8 >> 8);
 					#endif
 				}
 			}
@@ -414,6 +732,8 @@ PL_flat_poly(int *stream, int len, int rgb)
 		miny++;
 		pos += PL_hres;
 	}
+	PL_STAT_ADD(pixels_written, nwritten);
+	PL_STAT_ADD(polys_rasterized, 1);
 	PL_polygon_count++;
 }
 
@@ -424,6 +744,9 @@ PL_flat_poly_nolight(int *stream, int len, int rgb)
     int pos, beg, pbg;
     register PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
     int yt, dz, sz, dlen;
 
     if (pscan(stream, PL_STREAM_FLAT, len)) {
@@ -431,22 +754,25 @@ PL_flat_poly_nolight(int *stream, int len, int rgb)
     }
     miny = scan_miny;
     maxy = scan_maxy;
+    PL_STAT_ADD(spans, maxy - miny + 1);
     pos = miny * PL_hres;
     while (miny <= maxy) {
         beg  = x_L[miny];
         pbg  = pos + beg;
-        vbuf = PL_video_buffer + pbg;
+        vbuf = VB_AT(pbg);
         zbuf = PL_depth_buffer + pbg;
         len  = x_R[miny] - beg;
+        PL_STAT_ADD(pixels_tested, len + 1);
         dlen = len + (len == 0);
         yt   = YT(miny);
         sz   =  attrbuf[ZL(yt)];
         dz   = (attrbuf[ZR(yt)] - sz) / dlen;
 
         do {
-            if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
-                *vbuf = rgb;
+            if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
+                VB_PUT(vbuf, rgb);
             }
             sz += dz;
             vbuf++;
@@ -456,6 +782,8 @@ PL_flat_poly_nolight(int *stream, int len, int rgb)
         miny++;
         pos += PL_hres;
     }
+    PL_STAT_ADD(pixels_written, nwritten);
+    PL_STAT_ADD(polys_rasterized, 1);
     PL_polygon_count++;
 }
 
@@ -466,6 +794,9 @@ PL_nodraw_poly(int *stream, int len, int rgb)
     int pos, beg, pbg;
     register PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
     int yt, dz, sz, dlen;
 
     if (pscan(stream, PL_STREAM_FLAT, len)) {
@@ -473,21 +804,24 @@ PL_nodraw_poly(int *stream, int len, int rgb)
     }
     miny = scan_miny;
     maxy = scan_maxy;
+    PL_STAT_ADD(spans, maxy - miny + 1);
     pos = miny * PL_hres;
     while (miny <= maxy) {
         beg  = x_L[miny];
         pbg  = pos + beg;
-        vbuf = PL_video_buffer + pbg;
+        vbuf = VB_AT(pbg);
         zbuf = PL_depth_buffer + pbg;
         len  = x_R[miny] - beg;
+        PL_STAT_ADD(pixels_tested, len + 1);
         dlen = len + (len == 0);
         yt   = YT(miny);
         sz   =  attrbuf[ZL(yt)];
         dz   = (attrbuf[ZR(yt)] - sz) / dlen;
 
         do {
-            if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
+            if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
             }
             sz += dz;
             vbuf++;
@@ -497,9 +831,71 @@ PL_nodraw_poly(int *stream, int len, int rgb)
         miny++;
         pos += PL_hres;
     }
+    PL_STAT_ADD(pixels_written, nwritten);
+    PL_STAT_ADD(polys_rasterized, 1);
     PL_polygon_count++;
 }
 
+PL_GFX_ATTRIBUTE extern void
+PL_overdraw_poly(int *stream, int len, int rgb)
+{
+	int miny, maxy;
+	int pos, beg, pbg;
+	register PL_VBUFFER_TYPE vbuf;
+	ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+	uint32_t nwritten = 0;
+#endif
+	int yt, dz, sz, dlen;
+
+	(void)rgb;
+	if (pscan(stream, PL_STREAM_FLAT, len)) {
+		return;
+	}
+	miny = scan_miny;
+	maxy = scan_maxy;
+	PL_STAT_ADD(spans, maxy - miny + 1);
+	pos = miny * PL_hres;
+	while (miny <= maxy) {
+		beg = x_L[miny];
+		pbg = pos + beg;
+		vbuf = VB_AT(pbg);
+		zbuf = PL_depth_buffer + pbg;
+		len = x_R[miny] - beg;
+		PL_STAT_ADD(pixels_tested, len + 1);
+		dlen = len + (len == 0);
+		yt = YT(miny);
+		sz = attrbuf[ZL(yt)];
+		dz = (attrbuf[ZR(yt)] - sz) / dlen;
+
+		do {
+#ifdef PL_OVERDRAW_DEPTH_TESTED
+			if (Z_PASS(zbuf, sz)) {
+				Z_STORE(zbuf, sz);
+				STAT_WRITE();
+				if (VB_GET(vbuf) != OVERDRAW_MAX) {
+					VB_SET(vbuf, VB_GET(vbuf) + 1);
+				}
+			}
+#else
+			STAT_WRITE();
+			if (VB_GET(vbuf) != OVERDRAW_MAX) {
+				VB_SET(vbuf, VB_GET(vbuf) + 1);
+			}
+#endif
+			sz += dz;
+			vbuf++;
+			zbuf++;
+		} while (len--);
+		/* next scanline */
+		miny++;
+		pos += PL_hres;
+	}
+	PL_STAT_ADD(pixels_written, nwritten);
+	PL_STAT_ADD(polys_rasterized, 1);
+	PL_polygon_count++;
+}
+
 PL_GFX_ATTRIBUTE extern void
 PL_edge_wireframe_poly(int *stream, int len, int rgb)
 {
@@ -507,6 +903,9 @@ PL_edge_wireframe_poly(int *stream, int len, int rgb)
     int pos, beg, pbg;
     register PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
     int yt, dz, sz, dlen;
 
 
@@ -515,25 +914,28 @@ PL_edge_wireframe_poly(int *stream, int len, int rgb)
     }
     miny = scan_miny;
     maxy = scan_maxy;
+    PL_STAT_ADD(spans, maxy - miny + 1);
     pos = miny * PL_hres;
     while (miny <= maxy) {
         beg  = x_L[miny];
         pbg  = pos + beg;
-        vbuf = PL_video_buffer + pbg;
+        vbuf = VB_AT(pbg);
         zbuf = PL_depth_buffer + pbg;
         len  = x_R[miny] - beg;
+        PL_STAT_ADD(pixels_tested, len + 1);
         dlen = len + (len == 0);
         yt   = YT(miny);
         sz   =  attrbuf[ZL(yt)];
         dz   = (attrbuf[ZR(yt)] - sz) / dlen;
 
         do {
-            if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
+            if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
 				if(len == 0 || len == x_R[miny] - beg || miny <= scan_miny + 1 || miny >= scan_maxy
 - 1)
 				{
-					*vbuf = rgb;
+					VB_PUT(vbuf, rgb);
 				}
             }
             sz += dz;
@@ -544,11 +946,13 @@ PL_edge_wireframe_poly(int *stream, int len, int rgb)
         miny++;
         pos += PL_hres;
     }
+    PL_STAT_ADD(pixels_written, nwritten);
+    PL_STAT_ADD(polys_rasterized, 1);
     PL_polygon_count++;
 }
 
 static void
-plot_line (PL_VBUFFER_TYPE vbuf, int color, int x0, int y0, int x1, int y1)
+plot_line(int color, int x0, int y0, int x1, int y1)
 {
 	int dx =  abs (x1 - x0), sx = x0 < x1 ? 1 : -1;
 	int dy = -abs (y1 - y0), sy = y0 < y1 ? 1 : -1;
@@ -556,7 +960,7 @@ plot_line (PL_VBUFFER_TYPE vbuf, int color, int x0, int y0, int x1, int y1)
 
 	for (;;){  /* loop */
 		if (PL_vp_min_x < x0 && PL_vp_max_x > x0 && PL_vp_min_y < y0 && PL_vp_max_y > y0)
-			vbuf[x0 + y0 * PL_hres] = color;
+			VB_PUT(VB_AT(x0 + y0 * PL_hres), color);
 		if (x0 == x1 && y0 == y1) break;
 		e2 = 2 * err;
 		if (e2 >= dy) { err += dy; x0 += sx; } /* e_xy+e_x > 0 */
@@ -571,42 +975,226 @@ PL_wireframe_poly(int *stream, int len, int rgb)
 
 	zbuf = PL_depth_buffer;
 
+#ifdef PL_DAMAGE
+	{
+		int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+
+		for (int i = 0; i < len * PL_STREAM_FLAT; i += PL_STREAM_FLAT) {
+			x0 = stream[i] < x0 ? stream[i] : x0;
+			x1 = stream[i] > x1 ? stream[i] : x1;
+			y0 = stream[i + 1] < y0 ? stream[i + 1] : y0;
+			y1 = stream[i + 1] > y1 ? stream[i + 1] : y1;
+		}
+		x0 = x0 < PL_vp_min_x ? PL_vp_min_x : x0;
+		y0 = y0 < PL_vp_min_y ? PL_vp_min_y : y0;
+		x1 = x1 > PL_vp_max_x ? PL_vp_max_x : x1;
+		y1 = y1 > PL_vp_max_y ? PL_vp_max_y : y1;
+		if (x0 <= x1 && y0 <= y1) {
+			damage_add(x0, y0, x1, y1);
+		}
+	}
+#endif
 	for (int i = 0; i < len * PL_STREAM_FLAT; i += PL_STREAM_FLAT) {
 		if (i < (len * PL_STREAM_FLAT - PL_STREAM_FLAT)) {
-			plot_line(PL_video_buffer, rgb, stream[i], stream[i+1], stream[i+PL_STREAM_FLAT], stream[i+PL_STREAM_FLAT+1]);
+			plot_line(rgb, stream[i], stream[i+1], stream[i+PL_STREAM_FLAT], stream[i+PL_STREAM_FLAT+1]);
 		}
 		else {
-			plot_line(PL_video_buffer, rgb, stream[i], stream[i+1], stream[0], stream[1]);
+			plot_line(rgb, stream[i], stream[i+1], stream[0], stream[1]);
 		}
 	}
 
+    PL_STAT_ADD(polys_rasterized, 1);
     PL_polygon_count++;
 }
 
+/* texel t darkened by depth light d, 0..255 */
+static inline int
+shade_texel(int d, int t)
+{
+#if defined(PL_COLOR_DEPTH_8)
+#if defined(PL_PRECALCULATED_MUL8)
+	return mul8[d][t];
+#else
+	return (d * t) >> 8;
+#endif
+#elif defined(PL_COLOR_DEPTH_16)
+	return ((d * (t >> 11)) >> 8) << 11 | ((d * ((t >> 5) & 0x3f)) >> 8) << 5 |
+		   ((d * (t & 0x1f)) >> 8);
+#elif defined(PL_PRECALCULATED_MUL8)
+	return mul8[d][(t >> 16) & 0xff] << 16 | mul8[d][(t >> 8) & 0xff] << 8 |
+		   mul8[d][t & 0xff];
+#else
+	return (d * ((t >> 16) & 0xff) >> 8) << 16 |
+		   (d * ((t >> 8) & 0xff) >> 8) << 8 | (d * (t & 0xff) >> 8);
+#endif
+}
+
+/* Texture coordinates step in the bit layout of the texel index: the
+ * integer bits of u and v sit where the texture's layout puts them, above
+ * PL_TP fraction bits, and the index is (su | sv) >> PL_TP. Steps are masked
+ * adds, the other coordinate's bits are set so carries run through them and
+ * coordinates past the edge wrap. Row-major and PL_TEX_MORTON textures take
+ * the same kernels. */
+struct tex_walk {
+	int mu, mv; /* fraction and integer bits of u and v */
+	int morton;
+	int level;  /* mip level the walk is set up for */
+	int um, vm; /* texel coordinate masks of the level */
+	int vsh;    /* row shift of the level's texel array, row-major */
+	int base;   /* index of the level's first texel */
+};
+
+#define WALK(s, d, m) ((s) = (((s) | ~(m)) + (d)) & (m))
+
+/* spreads the low 8 bits of x to the even bits */
+static inline int
+dilate(int x)
+{
+	x = (x | (x << 4)) & 0x0f0f;
+	x = (x | (x << 2)) & 0x3333;
+	return (x | (x << 1)) & 0x5555;
+}
+
+/* texels before mip level of a 1 << alw by 1 << alh texel array */
+static inline int
+level_offset(int alw, int alh, int level)
+{
+	int i, n = 0;
+
+	for (i = 0; i < level; i++) {
+		n += 1 << (alw + alh - 2 * i);
+	}
+	return n;
+}
+
+static inline int
+texel_at(int morton, int vsh, int u, int v)
+{
+	return morton ? dilate(u) | dilate(v) << 1 : u | v << vsh;
+}
+
+static inline void
+walk_level(struct tex_walk *w, const struct PL_TEX_CONST *tex, int level)
+{
+	w->um = (1 << (PL_TEX_LW(tex) - level)) - 1;
+	w->vm = (1 << (PL_TEX_LH(tex) - level)) - 1;
+	w->vsh = PL_TEX_ALW(tex) - level;
+	if (w->morton) {
+		w->mu = TXFRAC | dilate(w->um) << PL_TP;
+		w->mv = TXFRAC | dilate(w->vm) << (PL_TP + 1);
+	} else {
+		w->mu = TXFRAC | w->um << PL_TP;
+		w->mv = TXFRAC | w->vm << (PL_TP + w->vsh);
+	}
+	w->level = level;
+	w->base = level_offset(PL_TEX_ALW(tex), PL_TEX_ALH(tex), level) +
+			  texel_at(w->morton, w->vsh, tex->ax >> level, tex->ay >> level);
+}
+
+static inline void
+walk_init(struct tex_walk *w, const struct PL_TEX_CONST *tex)
+{
+	w->morton = tex->layout == PL_TEX_MORTON;
+	walk_level(w, tex, 0);
+}
+
+/* a u or v coordinate or step of level 0 in the walk's layout and level */
+static inline int
+walk_u(const struct tex_walk *w, int s)
+{
+	int i;
+
+	s >>= w->level;
+	i = (s >> PL_TP) & w->um;
+	return (w->morton ? dilate(i) : i) << PL_TP | (s & TXFRAC);
+}
+
+static inline int
+walk_v(const struct tex_walk *w, int s)
+{
+	int i;
+
+	s >>= w->level;
+	i = (s >> PL_TP) & w->vm;
+	return (w->morton ? dilate(i) << 1 : i << w->vsh) << PL_TP |
+		   (s & TXFRAC);
+}
+
+/* Mip level of the span on row y: log2 of the largest texel step per
+ * pixel, along the span (du, dv) or down to the neighbouring row with the
+ * step along the span taken out. */
+static inline int
+span_level(const struct PL_TEX_CONST *tex, int y, int du, int dv)
+{
+	int yn, yt, ytn, dx, r, level;
+
+	r = abs(du) | abs(dv);
+	yn = y < scan_maxy ? y + 1 : y - 1;
+	if (yn >= scan_miny) {
+		yt = YT(y);
+		ytn = YT(yn);
+		dx = x_L[yn] - x_L[y];
+		r |= abs(attrbuf[UL(ytn)] - attrbuf[UL(yt)] - du * dx);
+		r |= abs(attrbuf[VL(ytn)] - attrbuf[VL(yt)] - dv * dx);
+	}
+	/* the top bit of the OR is the top bit of the largest */
+	r >>= PL_TP + 1;
+	for (level = 0; r && level < tex->levels - 1; level++) {
+		r >>= 1;
+	}
+	return level;
+}
+
+extern int
+PL_tex_mip_offset(const struct PL_TEX *tex, int level)
+{
+	return level_offset(PL_TEX_ALW(tex), PL_TEX_ALH(tex), level);
+}
+
+extern int
+PL_tex_index(const struct PL_TEX *tex, int level, int u, int v)
+{
+	u &= (1 << (PL_TEX_LW(tex) - level)) - 1;
+	v &= (1 << (PL_TEX_LH(tex) - level)) - 1;
+	return PL_tex_mip_offset(tex, level) +
+		   texel_at(tex->layout == PL_TEX_MORTON, PL_TEX_ALW(tex) - level,
+					(tex->ax >> level) + u, (tex->ay >> level) + v);
+}
+
 PL_GFX_ATTRIBUTE extern void
-PL_lintx_poly(int *stream, int len, const int *texels)
+PL_lintx_poly(int *stream, int len, const struct PL_TEX_CONST *tex)
 {
 	int miny, maxy;
 	int pos, beg, pbg;
 	PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
+	const PL_TEXEL *texels;
+	struct tex_walk w;
+	int mip;
 	int yt;
 	int du = 0, dv = 0, dz;
 	int su = 0, sv = 0, sz;
-	int r, d, dlen;
+	int d, dlen;
 
 	if (pscan(stream, PL_STREAM_TEX, len)) {
 		return;
 	}
+	walk_init(&w, tex);
+	texels = tex->data + w.base;
 	miny = scan_miny;
 	maxy = scan_maxy;
+	PL_STAT_ADD(spans, maxy - miny + 1);
 	pos = miny * PL_hres;
 	while (miny <= maxy) {
 		beg = x_L[miny];
 		pbg = pos + beg;
-		vbuf = PL_video_buffer + pbg;
+		vbuf = VB_AT(pbg);
 		zbuf = PL_depth_buffer + pbg;
 		len = x_R[miny] - beg;
+		PL_STAT_ADD(pixels_tested, len + 1);
 		dlen = len + (len == 0);
 		yt = YT(miny);
 		sz = attrbuf[ZL(yt)];
@@ -615,35 +1203,32 @@ PL_lintx_poly(int *stream, int len, const int *texels)
 		du = (attrbuf[UR(yt)] - su) / dlen;
 		sv = attrbuf[VL(yt)];
 		dv = (attrbuf[VR(yt)] - sv) / dlen;
+		if (tex->levels > 1) {
+			mip = span_level(tex, miny, du, dv);
+			if (mip != w.level) {
+				walk_level(&w, tex, mip);
+				texels = tex->data + w.base;
+			}
+		}
+		su = walk_u(&w, su);
+		du = walk_u(&w, du);
+		sv = walk_v(&w, sv);
+		dv = walk_v(&w, dv);
 
 		while (len >= 0) {
-			if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
-				su &= TXMSK;
-				sv &= TXMSK;
-				/* we can bitwise OR the x and y coordinates together
-				* because the texture is guaranteed to be square.
-				*/
-				yt = texels[(su >> PL_TP) | (sv >> PL_TP << TXSH)];
+			if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
+				yt = texels[(su | sv) >> PL_TP];
 				d = (sz >> 20) * 3 / 2;
 				if (d >= 256) {
-					*vbuf = yt;
+					VB_PUT(vbuf, yt);
 				} else {
-					#if defined(PL_PRECALCULATED_MUL8)
-					r = mul8[d][(yt >> 16) & 0xff] << 16;
-					r |= mul8[d][(yt >> 8) & 0xff] << 8;
-					r |= mul8[d][(yt >> 0) & 0xff] << 0;
-					*vbuf = r;
-					#else
-					/*r  = (d * ((yt >> 16) & 0xff) >> 8) << 16;
-					r |= (d * ((yt >> 8) & 0xff) >> 8) <<  8;
-					r |= (d * ((yt >> 0) & 0xff) >> 8) <<  0;*/
-					*vbuf = ((d * yt) >> 8);
-					#endif
+					VB_PUT(vbuf, shade_texel(d, yt));
 				}
 			}
-			su += du;
-			sv += dv;
+			WALK(su, du, w.mu);
+			WALK(sv, dv, w.mv);
 			sz += dz;
 			vbuf++;
 			zbuf++;
@@ -653,16 +1238,24 @@ PL_lintx_poly(int *stream, int len, const int *texels)
 		miny++;
 		pos += PL_hres;
 	}
+	PL_STAT_ADD(pixels_written, nwritten);
+	PL_STAT_ADD(polys_rasterized, 1);
 	PL_polygon_count++;
 }
 
 PL_GFX_ATTRIBUTE extern void
-PL_lintx_poly_nolight(int *stream, int len, const int *texels)
+PL_lintx_poly_nolight(int *stream, int len, const struct PL_TEX_CONST *tex)
 {
     int miny, maxy;
     int pos, beg, pbg;
     PL_VBUFFER_TYPE vbuf;
     ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+    uint32_t nwritten = 0;
+#endif
+    const PL_TEXEL *texels;
+    struct tex_walk w;
+    int mip;
     int yt;
     int du = 0, dv = 0, dz;
     register int su = 0, sv = 0, sz;
@@ -671,15 +1264,19 @@ PL_lintx_poly_nolight(int *stream, int len, const int *texels)
     if (pscan(stream, PL_STREAM_TEX, len)) {
         return;
     }
+    walk_init(&w, tex);
+    texels = tex->data + w.base;
     miny = scan_miny;
     maxy = scan_maxy;
+    PL_STAT_ADD(spans, maxy - miny + 1);
     pos = miny * PL_hres;
     while (miny <= maxy) {
         beg  = x_L[miny];
         pbg  = pos + beg;
-        vbuf = PL_video_buffer + pbg;
+        vbuf = VB_AT(pbg);
         zbuf = PL_depth_buffer + pbg;
         len  = x_R[miny] - beg;
+        PL_STAT_ADD(pixels_tested, len + 1);
         dlen = len + (len == 0);
         yt   = YT(miny);
         sz   =  attrbuf[ZL(yt)];
@@ -688,20 +1285,27 @@ PL_lintx_poly_nolight(int *stream, int len, const int *texels)
         du   = (attrbuf[UR(yt)] - su) / dlen;
         sv   =  attrbuf[VL(yt)];
         dv   = (attrbuf[VR(yt)] - sv) / dlen;
+        if (tex->levels > 1) {
+            mip = span_level(tex, miny, du, dv);
+            if (mip != w.level) {
+                walk_level(&w, tex, mip);
+                texels = tex->data + w.base;
+            }
+        }
+        su = walk_u(&w, su);
+        du = walk_u(&w, du);
+        sv = walk_v(&w, sv);
+        dv = walk_v(&w, dv);
 
         while (len >= 0) {
-            if ((*zbuf << ZBUF_SHIFT) < sz) {
-                *zbuf = sz >> ZBUF_SHIFT;
-                su &= TXMSK;
-                sv &= TXMSK;
-                /* we can bitwise OR the x and y coordinates together
-                 * because the texture is guaranteed to be square.
-                 */
-                yt = texels[(su >> PL_TP) | (sv >> PL_TP << TXSH)];
-				*vbuf = yt;
+            if (Z_PASS(zbuf, sz)) {
+                Z_STORE(zbuf, sz);
+                STAT_WRITE();
+                yt = texels[(su | sv) >> PL_TP];
+				VB_PUT(vbuf, yt);
             }
-            su += du;
-            sv += dv;
+            WALK(su, du, w.mu);
+            WALK(sv, dv, w.mv);
             sz += dz;
             vbuf++;
             zbuf++;
@@ -711,5 +1315,192 @@ PL_lintx_poly_nolight(int *stream, int len, const int *texels)
         miny++;
         pos += PL_hres;
     }
+    PL_STAT_ADD(pixels_written, nwritten);
+    PL_STAT_ADD(polys_rasterized, 1);
     PL_polygon_count++;
 }
+
+/* palette lookup of PL_TEX_I4 / PL_TEX_I2 texels.
+ * ppb - log2 of texels per byte, bsh - log2 of bits per texel */
+#define IDX_TEXEL(n)                                                          \
+	pal[(idx[(n) >> ppb] >> (((n) & ((1 << ppb) - 1)) << bsh)) &            \
+		((1 << (1 << bsh)) - 1)]
+
+static void
+idx_layout(const struct PL_TEX_CONST *tex, int *ppb, int *bsh)
+{
+	if (tex->fmt == PL_TEX_I4) {
+		*ppb = 1;
+		*bsh = 2;
+	} else {
+		*ppb = 2;
+		*bsh = 1;
+	}
+}
+
+PL_GFX_ATTRIBUTE extern void
+PL_lintx_idx_poly(int *stream, int len, const struct PL_TEX_CONST *tex)
+{
+	int miny, maxy;
+	int pos, beg, pbg;
+	PL_VBUFFER_TYPE vbuf;
+	ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+	uint32_t nwritten = 0;
+#endif
+	const uint8_t *idx;
+	const PL_TEXEL *pal = tex->pal;
+	int ppb, bsh;
+	struct tex_walk w;
+	int mip;
+	int yt, n;
+	int du = 0, dv = 0, dz;
+	int su = 0, sv = 0, sz;
+	int d, dlen;
+
+	if (pscan(stream, PL_STREAM_TEX, len)) {
+		return;
+	}
+	idx_layout(tex, &ppb, &bsh);
+	walk_init(&w, tex);
+	idx = tex->idx + (w.base >> ppb);
+	miny = scan_miny;
+	maxy = scan_maxy;
+	PL_STAT_ADD(spans, maxy - miny + 1);
+	pos = miny * PL_hres;
+	while (miny <= maxy) {
+		beg = x_L[miny];
+		pbg = pos + beg;
+		vbuf = VB_AT(pbg);
+		zbuf = PL_depth_buffer + pbg;
+		len = x_R[miny] - beg;
+		PL_STAT_ADD(pixels_tested, len + 1);
+		dlen = len + (len == 0);
+		yt = YT(miny);
+		sz = attrbuf[ZL(yt)];
+		dz = (attrbuf[ZR(yt)] - sz) / dlen;
+		su = attrbuf[UL(yt)];
+		du = (attrbuf[UR(yt)] - su) / dlen;
+		sv = attrbuf[VL(yt)];
+		dv = (attrbuf[VR(yt)] - sv) / dlen;
+		if (tex->levels > 1) {
+			mip = span_level(tex, miny, du, dv);
+			if (mip != w.level) {
+				walk_level(&w, tex, mip);
+				idx = tex->idx + (w.base >> ppb);
+			}
+		}
+		su = walk_u(&w, su);
+		du = walk_u(&w, du);
+		sv = walk_v(&w, sv);
+		dv = walk_v(&w, dv);
+
+		while (len >= 0) {
+			if (Z_PASS(zbuf, sz)) {
+				Z_STORE(zbuf, sz);
+				STAT_WRITE();
+				n = (su | sv) >> PL_TP;
+				yt = IDX_TEXEL(n);
+				d = (sz >> 20) * 3 / 2;
+				if (d >= 256) {
+					VB_PUT(vbuf, yt);
+				} else {
+					VB_PUT(vbuf, shade_texel(d, yt));
+				}
+			}
+			WALK(su, du, w.mu);
+			WALK(sv, dv, w.mv);
+			sz += dz;
+			vbuf++;
+			zbuf++;
+			len--;
+		}
+		/* next scanline */
+		miny++;
+		pos += PL_hres;
+	}
+	PL_STAT_ADD(pixels_written, nwritten);
+	PL_STAT_ADD(polys_rasterized, 1);
+	PL_polygon_count++;
+}
+
+PL_GFX_ATTRIBUTE extern void
+PL_lintx_idx_poly_nolight(int *stream, int len,
+						  const struct PL_TEX_CONST *tex)
+{
+	int miny, maxy;
+	int pos, beg, pbg;
+	PL_VBUFFER_TYPE vbuf;
+	ZBUF_TYPE *zbuf;
+#ifdef PERFORMANCE_MEASURE
+	uint32_t nwritten = 0;
+#endif
+	const uint8_t *idx;
+	const PL_TEXEL *pal = tex->pal;
+	int ppb, bsh;
+	struct tex_walk w;
+	int mip;
+	int yt, n;
+	int du = 0, dv = 0, dz;
+	int su = 0, sv = 0, sz;
+	int dlen;
+
+	if (pscan(stream, PL_STREAM_TEX, len)) {
+		return;
+	}
+	idx_layout(tex, &ppb, &bsh);
+	walk_init(&w, tex);
+	idx = tex->idx + (w.base >> ppb);
+	miny = scan_miny;
+	maxy = scan_maxy;
+	PL_STAT_ADD(spans, maxy - miny + 1);
+	pos = miny * PL_hres;
+	while (miny <= maxy) {
+		beg = x_L[miny];
+		pbg = pos + beg;
+		vbuf = VB_AT(pbg);
+		zbuf = PL_depth_buffer + pbg;
+		len = x_R[miny] - beg;
+		PL_STAT_ADD(pixels_tested, len + 1);
+		dlen = len + (len == 0);
+		yt = YT(miny);
+		sz = attrbuf[ZL(yt)];
+		dz = (attrbuf[ZR(yt)] - sz) / dlen;
+		su = attrbuf[UL(yt)];
+		du = (attrbuf[UR(yt)] - su) / dlen;
+		sv = attrbuf[VL(yt)];
+		dv = (attrbuf[VR(yt)] - sv) / dlen;
+		if (tex->levels > 1) {
+			mip = span_level(tex, miny, du, dv);
+			if (mip != w.level) {
+				walk_level(&w, tex, mip);
+				idx = tex->idx + (w.base >> ppb);
+			}
+		}
+		su = walk_u(&w, su);
+		du = walk_u(&w, du);
+		sv = walk_v(&w, sv);
+		dv = walk_v(&w, dv);
+
+		while (len >= 0) {
+			if (Z_PASS(zbuf, sz)) {
+				Z_STORE(zbuf, sz);
+				STAT_WRITE();
+				n = (su | sv) >> PL_TP;
+				VB_PUT(vbuf, IDX_TEXEL(n));
+			}
+			WALK(su, du, w.mu);
+			WALK(sv, dv, w.mv);
+			sz += dz;
+			vbuf++;
+			zbuf++;
+			len--;
+		}
+		/* next scanline */
+		miny++;
+		pos += PL_hres;
+	}
+	PL_STAT_ADD(pixels_written, nwritten);
+	PL_STAT_ADD(polys_rasterized, 1);
+	PL_polygon_count++;
+}
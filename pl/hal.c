@@ -1,5 +1,11 @@
+#include "pl.h"
+
 #include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
 #include <zephyr/logging/log.h>
+#ifdef PL_TRACING
+#include <zephyr/tracing/tracing.h>
+#endif
 LOG_MODULE_REGISTER(PL3D);
 
 extern void *
@@ -19,3 +25,30 @@ EXT_error(int err_id, char *modname, char *msg)
 {
     LOG_ERR("vx error 0x%x in %s: %s\n", err_id, modname, msg);
 }
+
+/* timing_init() and timing_start() must have been called by the application */
+extern uint32_t
+EXT_cycles(void)
+{
+    return (uint32_t)timing_counter_get();
+}
+
+extern uint64_t
+EXT_cycles_to_ns(uint32_t cycles)
+{
+    return timing_cycles_to_ns(cycles);
+}
+
+#ifdef PL_TRACING
+/* indexed by PL_TRACE_*, CTF named events hold at most 20 characters */
+static const char *const trace_names[PL_TRACE_COUNT] = {
+    "pl_frame", "pl_object", "pl_transform", "pl_poly", "pl_fill",
+    "pl_post", "pl_display"
+};
+
+extern void
+EXT_trace(int event, int begin)
+{
+    sys_trace_named_event(trace_names[event], event, begin);
+}
+#endif
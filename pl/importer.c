@@ -18,99 +18,310 @@
 * DMDL files can be generated by making models in the
 * Freeform Model Editor (mdlrfree)
 *
+* Text DMDL is one value per line (vertices are one line each), it is
+* read through a buffered tokenizer that parses the integers in place.
+* Binary DMDL (tools/dmdl2bin.py) is a header followed by the arrays,
+* read in a few large blocks.
+*
 */
 
 #include <stdio.h>
-#include <stdlib.h>
+#include <string.h>
 
-static char *cur_fn = NULL;
+#define TOK_BUF 4096
 
-static char g_buf[1024];
+struct tok {
+	FILE *f;
+	int pos, len;
+	char buf[TOK_BUF];
+};
 
-static void
-read_line(FILE *out, char *buf, int len)
+static int
+tok_getc(struct tok *t)
 {
-	if (!fgets(buf, len, out)) {
-		fprintf(stderr, "invalid dmdl file: %s\n", cur_fn);
-		fclose(out);
-		getchar();
-		exit(0);
+	if (t->pos == t->len) {
+		t->len = (int)fread(t->buf, 1, sizeof(t->buf), t->f);
+		t->pos = 0;
+		if (t->len <= 0) {
+			t->len = 0;
+			return EOF;
+		}
 	}
+	return (unsigned char)t->buf[t->pos++];
+}
+
+/* next integer of the current or following lines */
+static int
+tok_int(struct tok *t, int *out)
+{
+	int c, neg = 0, any = 0;
+	unsigned v = 0;
+
+	do {
+		c = tok_getc(t);
+	} while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+	if (c == '-' || c == '+') {
+		neg = (c == '-');
+		c = tok_getc(t);
+	}
+	while (c >= '0' && c <= '9') {
+		v = v * 10 + (c - '0');
+		any = 1;
+		c = tok_getc(t);
+	}
+	if (c != EOF) {
+		t->pos--; /* leave the delimiter for tok_line */
+	}
+	*out = neg ? -(int)v : (int)v;
+	return any;
+}
+
+/* skips the rest of the current line */
+static int
+tok_line(struct tok *t)
+{
+	int c;
+
+	do {
+		c = tok_getc(t);
+	} while (c != '\n' && c != EOF);
+	return c != EOF;
+}
+
+/* integer alone on its line, anything after it is ignored */
+static int
+tok_field(struct tok *t, int *out)
+{
+	if (!tok_int(t, out)) {
+		return 0;
+	}
+	tok_line(t);
+	return 1;
+}
+
+static int
+import_fail(struct PL_OBJ **o, FILE *f, char *msg)
+{
+	if (f) {
+		fclose(f);
+	}
+	if (*o) {
+		PL_delete_object(*o);
+		EXT_free(*o);
+		*o = NULL;
+	}
+	EXT_error(PL_ERR_MISC, "importer", msg);
+	return 0;
+}
+
+/* the first vertex is repeated after the last */
+static int
+poly_ok(const struct PL_POLY *p, int n_verts)
+{
+	int i;
+
+	if (p->n_verts < 3 || p->n_verts + 1 > 6) {
+		return 0;
+	}
+	for (i = 0; i <= p->n_verts; i++) {
+		if ((unsigned)p->verts[i * PL_POLY_VLEN] >= (unsigned)n_verts) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* arrays for the counts set so far */
+static int
+alloc_obj(struct PL_OBJ *dst)
+{
+	if (dst->n_verts > 0 && dst->verts == NULL) {
+		dst->verts = EXT_calloc(dst->n_verts * PL_VLEN, sizeof(int));
+		if (dst->verts == NULL) {
+			return 0;
+		}
+	}
+	if (dst->n_polys > 0 && dst->polys == NULL) {
+		dst->polys = EXT_calloc(dst->n_polys, sizeof(struct PL_POLY));
+		if (dst->polys == NULL) {
+			return 0;
+		}
+	}
+	return 1;
 }
 
-static void
-read_polygon(FILE *out, struct PL_POLY *dst)
+static int
+read_polygon(struct tok *t, struct PL_POLY *dst)
 {
 	int tmp; /* texture ID (ignored for this simple importer) */
 	int i, nv;
 	int ctr = 0;
 
-	read_line(out, g_buf, 16);
-	sscanf(g_buf, "%d", &tmp);
 	dst->tex = NULL;
-	read_line(out, g_buf, 16);
-	sscanf(g_buf, "%d", &dst->color);
-	read_line(out, g_buf, 16);
-	read_line(out, g_buf, 16);
-	sscanf(g_buf, "%d", &dst->n_verts);
+	if (!tok_field(t, &tmp) || !tok_field(t, &dst->color) ||
+		!tok_line(t) || !tok_field(t, &dst->n_verts)) {
+		return 0;
+	}
 	dst->n_verts &= 0xf;
-	nv = ((dst->n_verts & 0xf) + 1) * 4;
+	if (dst->n_verts + 1 > 6) {
+		return 0;
+	}
+	/* [index, unused, U, V] per vertex */
+	nv = (dst->n_verts + 1) * 4;
 	for (i = 0; i < nv; i++) {
-		read_line(out, g_buf, 16);
-		if ((i % 4) != 1) {
-			sscanf(g_buf, "%d\n", &dst->verts[ctr]);
-			ctr++;
+		if ((i % 4) == 1) {
+			if (!tok_line(t)) {
+				return 0;
+			}
+		} else if (!tok_field(t, &dst->verts[ctr++])) {
+			return 0;
 		}
 	}
+	return 1;
 }
 
 extern int
 import_dmdl(char *name, struct PL_OBJ **o)
 {
+	static struct tok t;
 	struct PL_OBJ *dst;
-	FILE *out;
 	int i, tmp;
-	int x, y, z;
 	int *dv;
+	char fn[256];
 
-	snprintf(g_buf, sizeof(g_buf), "%s.dmdl", name);
-	cur_fn = name;
-	if (!(out = fopen(g_buf, "rb"))) {
-		fprintf(stderr, "failed to read dmdl file: %s\n", g_buf);
-		return 0;
+	*o = NULL;
+	snprintf(fn, sizeof(fn), "%s.dmdl", name);
+	if (!(t.f = fopen(fn, "rb"))) {
+		return import_fail(o, NULL, "cannot open dmdl file");
 	}
+	t.pos = t.len = 0;
 	*o = EXT_calloc(1, sizeof(struct PL_OBJ));
 	dst = *o;
-	read_line(out, g_buf, 256);
-	sscanf(g_buf, "%d", &dst->n_verts);
-
-	dst->verts = EXT_calloc(1, dst->n_verts * PL_VLEN * sizeof(int));
-	if (dst->verts == NULL) {
-		EXT_error(PL_ERR_NO_MEM, "importer", "no memory");
-		return 0;
+	if (dst == NULL) {
+		return import_fail(o, t.f, "no memory");
+	}
+	if (!tok_field(&t, &dst->n_verts) || dst->n_verts < 0 ||
+		dst->n_verts >= PL_MAX_OBJ_V) {
+		return import_fail(o, t.f, "invalid dmdl vertex count");
+	}
+	if (!alloc_obj(dst)) {
+		return import_fail(o, t.f, "no memory");
 	}
-	for (i = 0; i < dst->n_verts; i++) {
-		read_line(out, g_buf, 256);
-		dv = dst->verts;
-		x = i * PL_VLEN + 0;
-		y = i * PL_VLEN + 1;
-		z = i * PL_VLEN + 2;
+	dv = dst->verts;
+	for (i = 0; i < dst->n_verts; i++, dv += PL_VLEN) {
 		/* w coord is really unused */
-		sscanf(g_buf, "%d %d %d %d", &dv[x], &dv[y], &dv[z], &tmp);
+		if (!tok_int(&t, &dv[0]) || !tok_int(&t, &dv[1]) ||
+			!tok_int(&t, &dv[2]) || !tok_field(&t, &tmp)) {
+			return import_fail(o, t.f, "invalid dmdl vertex");
+		}
 	}
-
-	read_line(out, g_buf, 256);
-	sscanf(g_buf, "%d", &dst->n_polys);
-
-	dst->polys = EXT_calloc(1, dst->n_polys * sizeof(struct PL_POLY));
-	if (dst->polys == NULL) {
-		EXT_error(PL_ERR_NO_MEM, "importer", "no memory");
-		return 0;
+	if (!tok_field(&t, &dst->n_polys) || dst->n_polys < 0 ||
+		dst->n_polys > PL_MAX_OBJ_P) {
+		return import_fail(o, t.f, "invalid dmdl polygon count");
+	}
+	if (!alloc_obj(dst)) {
+		return import_fail(o, t.f, "no memory");
 	}
 	for (i = 0; i < dst->n_polys; i++) {
-		read_polygon(out, &dst->polys[i]);
+		if (!read_polygon(&t, &dst->polys[i]) ||
+			!poly_ok(&dst->polys[i], dst->n_verts)) {
+			return import_fail(o, t.f, "invalid dmdl polygon");
+		}
 	}
-	fclose(out);
+	fclose(t.f);
+	return 1;
+}
+
+/* Binary DMDL, little-endian:
+ *   header   "DMDB", uint16 version, uint16 0, uint32 n_verts, n_polys
+ *   vertices int32 [x, y, z, 0] * n_verts
+ *   polygons int32 [tex, color, n_verts, verts[18]] * n_polys
+ * polygon verts are [index, U, V] with the first vertex repeated. */
+
+#define DMDB_VERSION 1
+#define DMDB_POLY_INTS (3 + 6 * PL_POLY_VLEN)
+#define DMDB_CHUNK 64 /* polygons per read */
 
+struct dmdb_header {
+	char magic[4];
+	uint16_t version;
+	uint16_t reserved;
+	uint32_t n_verts;
+	uint32_t n_polys;
+};
+
+extern int
+import_dmdl_bin(char *name, struct PL_OBJ **o)
+{
+	static int32_t rec[DMDB_CHUNK][DMDB_POLY_INTS];
+	struct dmdb_header hdr;
+	struct PL_OBJ *dst;
+	struct PL_POLY *p;
+	FILE *f;
+	long fsize;
+	int i, j, n;
+	char fn[256];
+
+	*o = NULL;
+	snprintf(fn, sizeof(fn), "%s.bdmdl", name);
+	if (!(f = fopen(fn, "rb"))) {
+		return import_fail(o, NULL, "cannot open binary dmdl file");
+	}
+	if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+		memcmp(hdr.magic, "DMDB", 4) != 0) {
+		return import_fail(o, f, "not a binary dmdl file");
+	}
+	if (hdr.version != DMDB_VERSION) {
+		return import_fail(o, f, "unsupported binary dmdl version");
+	}
+	if (hdr.n_verts >= PL_MAX_OBJ_V) {
+		return import_fail(o, f, "too many dmdl vertices");
+	}
+	if (hdr.n_polys > PL_MAX_OBJ_P) {
+		return import_fail(o, f, "too many dmdl polygons");
+	}
+	/* the counts must match the file before anything is allocated */
+	if (fseek(f, 0, SEEK_END) != 0 || (fsize = ftell(f)) < 0 ||
+		(uint64_t)fsize != sizeof(hdr) +
+		(uint64_t)hdr.n_verts * PL_VLEN * sizeof(int32_t) +
+		(uint64_t)hdr.n_polys * sizeof(rec[0]) ||
+		fseek(f, sizeof(hdr), SEEK_SET) != 0) {
+		return import_fail(o, f, "binary dmdl size mismatch");
+	}
+	*o = EXT_calloc(1, sizeof(struct PL_OBJ));
+	dst = *o;
+	if (dst == NULL) {
+		return import_fail(o, f, "no memory");
+	}
+	dst->n_verts = hdr.n_verts;
+	dst->n_polys = hdr.n_polys;
+	if (!alloc_obj(dst)) {
+		return import_fail(o, f, "no memory");
+	}
+	if (dst->n_verts &&
+		fread(dst->verts, PL_VLEN * sizeof(int), dst->n_verts, f) !=
+		(size_t)dst->n_verts) {
+		return import_fail(o, f, "binary dmdl truncated");
+	}
+	p = dst->polys;
+	for (i = 0; i < dst->n_polys; i += n) {
+		n = dst->n_polys - i;
+		if (n > DMDB_CHUNK) {
+			n = DMDB_CHUNK;
+		}
+		if (fread(rec, sizeof(rec[0]), n, f) != (size_t)n) {
+			return import_fail(o, f, "binary dmdl truncated");
+		}
+		for (j = 0; j < n; j++, p++) {
+			p->tex = NULL;
+			p->color = rec[j][1];
+			p->n_verts = rec[j][2];
+			memcpy(p->verts, &rec[j][3], sizeof(p->verts));
+			if (!poly_ok(p, dst->n_verts)) {
+				return import_fail(o, f, "invalid dmdl polygon");
+			}
+		}
+	}
+	fclose(f);
 	return 1;
 }
@@ -22,234 +22,834 @@
 #include <string.h>
 
 
-/* sin(pi/128) * 32768
- * sin(pi/256) * 65536
- * It is repeating over pi instead of not over 0.5pi,
- * maybe add code for 128 entries to reduce size or 256 entries for more precision?
- */
-int PL_sin[PL_TRIGMAX] = {
-	0x0000, 0x0324, 0x0647, 0x096a, 0x0c8b, 0x0fab, 0x12c8, 0x15e2, 0x18f8,
-	0x1c0b, 0x1f19, 0x2223, 0x2528, 0x2826, 0x2b1f, 0x2e11, 0x30fb, 0x33de,
-	0x36ba, 0x398c, 0x3c56, 0x3f17, 0x41ce, 0x447a, 0x471c, 0x49b4, 0x4c3f,
-	0x4ebf, 0x5133, 0x539b, 0x55f5, 0x5842, 0x5a82, 0x5cb4, 0x5ed7, 0x60ec,
-	0x62f2, 0x64e8, 0x66cf, 0x68a6, 0x6a6d, 0x6c24, 0x6dca, 0x6f5f, 0x70e2,
-	0x7255, 0x73b5, 0x7504, 0x7641, 0x776c, 0x7884, 0x798a, 0x7a7d, 0x7b5d,
-	0x7c29, 0x7ce3, 0x7d8a, 0x7e1d, 0x7e9d, 0x7f09, 0x7f62, 0x7fa7, 0x7fd8,
-	0x7ff6, 0x8000, 0x7ff6, 0x7fd8, 0x7fa7, 0x7f62, 0x7f09, 0x7e9d, 0x7e1d,
-	0x7d8a, 0x7ce3, 0x7c29, 0x7b5d, 0x7a7d, 0x798a, 0x7884, 0x776c, 0x7641,
-	0x7504, 0x73b5, 0x7255, 0x70e2, 0x6f5f, 0x6dca, 0x6c24, 0x6a6d, 0x68a6,
-	0x66cf, 0x64e8, 0x62f2, 0x60ec, 0x5ed7, 0x5cb4, 0x5a82, 0x5842, 0x55f5,
-	0x539b, 0x5133, 0x4ebf, 0x4c3f, 0x49b4, 0x471c, 0x447a, 0x41ce, 0x3f17,
-	0x3c56, 0x398c, 0x36ba, 0x33de, 0x30fb, 0x2e11, 0x2b1f, 0x2826, 0x2528,
-	0x2223, 0x1f19, 0x1c0b, 0x18f8, 0x15e2, 0x12c8, 0x0fab, 0x0c8b, 0x096a,
-	0x0647, 0x0324};
-
-int PL_cos[PL_TRIGMAX];
-
-PL_viewtransform xf_vw; /* view transform */
+/* quarter wave, PL_sin() and PL_cos() in pl.h fold the rest onto it */
+#include "trig_table.h"
+
+/* the model matrix is affine, kept as 3x4: rows x, y, z and translation,
+ * the same elements as [0..2], [4..6], [8..10], [12..14] of a 4x4 */
+#define AR(i, j) ((i) * 3 + (j))
+#define AT(j)    (9 + (j))
+
+struct mst_entry {
+#ifdef PL_MST_ROT16
+	int16_t r[9]; /* rotation/scale in Q14 */
+#else
+	int r[9];
+#endif
+	int t[3];
+};
 
 static int mat_idt[16] = PL_IDT_MAT;
-static int mat_model[16] = PL_IDT_MAT;
-static int mst_stack[PL_MAX_MST_DEPTH * 16];
+static int mat_model[12] = {
+	PL_P_ONE, 0, 0, 0, PL_P_ONE, 0, 0, 0, PL_P_ONE, 0, 0, 0
+};
+static int mat_view[16] = PL_IDT_MAT;
+static int64_t world_org[3]; /* world position the camera space is rebased to */
+static struct mst_entry mst_stack[PL_MAX_MST_DEPTH];
 static int mst_top = 0;
 
+extern void
+PL_set_view(int *m)
+{
+	PL_mat_cpy(mat_view, m);
+}
+
+extern void
+PL_get_view(int *m)
+{
+	PL_mat_cpy(m, mat_view);
+}
+
+extern void
+PL_set_camera_matrix(int *m)
+{
+	int i, j;
+
+	/* inverse of a rigid transform: transposed rotation, and the position
+	 * moved into camera space and negated */
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			mat_view[(i << 2) + j] = m[(j << 2) + i];
+		}
+		mat_view[(i << 2) + 3] = 0;
+	}
+	for (j = 0; j < 3; j++) {
+		mat_view[12 + j] = -(int)(((int64_t)m[12] * m[(j << 2) + 0] +
+								   (int64_t)m[13] * m[(j << 2) + 1] +
+								   (int64_t)m[14] * m[(j << 2) + 2]) >> PL_P);
+	}
+	mat_view[15] = PL_P_ONE;
+	/* camera space is left handed, the world right handed like the Euler
+	 * camera's, so culling sees the same winding with either camera */
+	for (i = 0; i < 4; i++) {
+		mat_view[(i << 2) + 0] = -mat_view[(i << 2) + 0];
+	}
+}
+
+static unsigned int
+isqrt(uint64_t n)
+{
+	uint64_t r = 0, b = (uint64_t)1 << 62;
+
+	while (b > n) {
+		b >>= 2;
+	}
+	while (b) {
+		if (n >= r + b) {
+			n -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+	return (unsigned int)r;
+}
+
+/* scale to unit length in PL_P fixed point, returns 0 for a null vector */
+static int
+unit(int *dst, int64_t x, int64_t y, int64_t z)
+{
+	unsigned int len;
+
+	len = isqrt((uint64_t)(x * x + y * y + z * z));
+	if (len == 0) {
+		return 0;
+	}
+	dst[0] = (int)((x << PL_P) / len);
+	dst[1] = (int)((y << PL_P) / len);
+	dst[2] = (int)((z << PL_P) / len);
+	return 1;
+}
+
+/* unit cross product, returns 0 for parallel vectors */
+static int
+cross(int *dst, int *a, int *b)
+{
+	return unit(dst, (int64_t)a[1] * b[2] - (int64_t)a[2] * b[1],
+		 (int64_t)a[2] * b[0] - (int64_t)a[0] * b[2],
+		 (int64_t)a[0] * b[1] - (int64_t)a[1] * b[0]);
+}
+
+extern void
+PL_look_at(int *eye, int *at, int *up)
+{
+	static int alt_up[2][3] = {
+		{ 0, 0, PL_P_ONE },
+		{ PL_P_ONE, 0, 0 }
+	};
+	int fwd[3], side[3], upc[3];
+	int cam[16];
+	int i;
+
+	if (!unit(fwd, at[0] - eye[0], at[1] - eye[1], at[2] - eye[2])) {
+		return;
+	}
+	/* camera's own x = up x fwd, which ends up on the left of the screen */
+	if (!cross(side, up, fwd)) {
+		/* looking along up, any other axis that is not parallel will do */
+		for (i = 0; i < 2; i++) {
+			if (cross(side, alt_up[i], fwd)) {
+				break;
+			}
+		}
+		if (i == 2) {
+			return;
+		}
+	}
+	if (!cross(upc, fwd, side)) {
+		return;
+	}
+
+	for (i = 0; i < 3; i++) {
+		cam[0 + i] = side[i];
+		cam[4 + i] = upc[i];
+		cam[8 + i] = fwd[i];
+		cam[12 + i] = eye[i];
+	}
+	cam[3] = cam[7] = cam[11] = 0;
+	cam[15] = PL_P_ONE;
+	PL_set_camera_matrix(cam);
+}
+
 extern void
 PL_set_camera(int x, int y, int z, int rx, int ry, int rz)
 {
-	xf_vw.tx = -x;
-	xf_vw.ty = -y;
-	xf_vw.tz = -z;
+	int mat[16];
+	int c, s;
+
+	/* roll, this one also trades x and y at rz = 0 */
+	memcpy(mat_view, mat_idt, sizeof(mat));
+	c = PL_cos(-rz);
+	s = PL_sin(-rz);
+	mat_view[0] = s;
+	mat_view[1] = c;
+	mat_view[4] = c;
+	mat_view[5] = -s;
+
+	/* pitch */
+	memcpy(mat, mat_idt, sizeof(mat));
+	c = PL_cos(-rx);
+	s = PL_sin(-rx);
+	mat[5] = c;
+	mat[6] = s;
+	mat[9] = -s;
+	mat[10] = c;
+	PL_mat_mul(mat_view, mat);
+
+	/* yaw */
+	memcpy(mat, mat_idt, sizeof(mat));
+	c = PL_cos(-ry);
+	s = PL_sin(-ry);
+	mat[0] = c;
+	mat[2] = -s;
+	mat[8] = s;
+	mat[10] = c;
+	PL_mat_mul(mat_view, mat);
+
+	memcpy(mat, mat_idt, sizeof(mat));
+	mat[12] = -x;
+	mat[13] = -y;
+	mat[14] = -z;
+	PL_mat_mul(mat_view, mat);
+}
+
+extern void
+PL_world_origin(const int64_t *o)
+{
+	world_org[0] = o[0];
+	world_org[1] = o[1];
+	world_org[2] = o[2];
+}
+
+extern void
+PL_world_get_origin(int64_t *o)
+{
+	o[0] = world_org[0];
+	o[1] = world_org[1];
+	o[2] = world_org[2];
+}
+
+extern int
+PL_world_rel(const int64_t *pos, int *out)
+{
+	int64_t d;
+	int i, in = 1;
+
+	for (i = 0; i < 3; i++) {
+		d = pos[i] - world_org[i];
+		if (d > PL_WORLD_RANGE) {
+			d = PL_WORLD_RANGE;
+			in = 0;
+		} else if (d < -PL_WORLD_RANGE) {
+			d = -PL_WORLD_RANGE;
+			in = 0;
+		}
+		out[i] = (int)d;
+	}
+	return in;
+}
+
+extern int
+PL_mst_translate_world(const int64_t *pos)
+{
+	int rel[3];
+
+	if (!PL_world_rel(pos, rel)) {
+		PL_STAT_ADD(world_skipped, 1);
+		return 0;
+	}
+	PL_mst_translate(rel[0], rel[1], rel[2]);
+	return 1;
+}
+
+extern void
+PL_world_camera(const int64_t *pos, int rx, int ry, int rz)
+{
+	PL_world_origin(pos);
+	PL_set_camera(0, 0, 0, rx, ry, rz);
+}
+
+extern void
+PL_world_look_at(const int64_t *eye, const int64_t *at, int *up)
+{
+	int64_t d[3];
+	int rel[3], org[3] = { 0, 0, 0 };
+	int i;
+
+	PL_world_origin(eye);
+	/* only the direction matters, keep it small enough for unit() */
+	for (i = 0; i < 3; i++) {
+		d[i] = at[i] - eye[i];
+	}
+	while (d[0] >= (1 << 24) || d[0] <= -(1 << 24) || d[1] >= (1 << 24) ||
+		   d[1] <= -(1 << 24) || d[2] >= (1 << 24) || d[2] <= -(1 << 24)) {
+		d[0] /= 2;
+		d[1] /= 2;
+		d[2] /= 2;
+	}
+	for (i = 0; i < 3; i++) {
+		rel[i] = (int)d[i];
+	}
+	PL_look_at(org, rel, up);
+}
+
+static void
+aff_to_mat(int *m, const int *a)
+{
+	int i, j;
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			m[(i << 2) + j] = a[AR(i, j)];
+		}
+		m[(i << 2) + 3] = 0;
+		m[12 + i] = a[AT(i)];
+	}
+	m[15] = PL_P_ONE;
+}
+
+static void
+mat_to_aff(int *a, const int *m)
+{
+	int i, j;
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			a[AR(i, j)] = m[(i << 2) + j];
+		}
+		a[AT(i)] = m[12 + i];
+	}
+}
 
-	xf_vw.rx = (unsigned int)((PL_TRIGMAX - rx) & PL_TRIGMSK);
-	xf_vw.ry = (unsigned int)((PL_TRIGMAX - ry) & PL_TRIGMSK);
-	xf_vw.rz = (unsigned int)((PL_TRIGMAX - rz) & PL_TRIGMSK);
+/* model x view as a 4x4, what the vertex transforms use */
+static void
+modelview(int *mv)
+{
+	int m[16];
+
+	aff_to_mat(m, mat_model);
+	PL_mat_cpy(mv, mat_view);
+	PL_mat_mul(mv, m);
 }
 
 extern void
 PL_mst_get(int *out)
 {
-	PL_mat_cpy(out, mat_model);
+	aff_to_mat(out, mat_model);
+}
+
+#ifdef PL_MST_ROT16
+#define ROT16_MAX (INT16_MAX * 2) /* largest coefficient the stack holds */
+#define ROT16_MIN (INT16_MIN * 2)
+
+/* Q15 to the stack's Q14, coefficients of 2 and up saturate */
+static int16_t
+rot16(int v)
+{
+	if (v > ROT16_MAX || v < ROT16_MIN) {
+		EXT_error(PL_ERR_MISC, "math", "mst coefficient out of Q14 range");
+		return (v > 0) ? INT16_MAX : INT16_MIN;
+	}
+	return (int16_t)(v >> 1);
 }
+#endif
 
 extern void
 PL_mst_push(void)
 {
+	struct mst_entry *e;
+	int i;
+
 	if ((mst_top + 1) >= PL_MAX_MST_DEPTH) {
 		EXT_error(PL_ERR_MISC, "math", "stack overflow");
 	}
-	PL_mat_cpy(&mst_stack[(mst_top + 1) * 16], mat_model);
-	mst_top++;
+	e = &mst_stack[++mst_top];
+	for (i = 0; i < 9; i++) {
+#ifdef PL_MST_ROT16
+		e->r[i] = rot16(mat_model[i]);
+#else
+		e->r[i] = mat_model[i];
+#endif
+	}
+	e->t[0] = mat_model[AT(0)];
+	e->t[1] = mat_model[AT(1)];
+	e->t[2] = mat_model[AT(2)];
 }
 
 extern void
 PL_mst_pop(void)
 {
+	struct mst_entry *e;
+	int i;
+
 	if ((mst_top - 1) < 0) {
 		EXT_error(PL_ERR_MISC, "math", "stack underflow");
 	}
-	PL_mat_cpy(mat_model, &mst_stack[(mst_top--) * 16]);
+	e = &mst_stack[mst_top--];
+	for (i = 0; i < 9; i++) {
+#ifdef PL_MST_ROT16
+		mat_model[i] = e->r[i] * 2;
+#else
+		mat_model[i] = e->r[i];
+#endif
+	}
+	mat_model[AT(0)] = e->t[0];
+	mat_model[AT(1)] = e->t[1];
+	mat_model[AT(2)] = e->t[2];
 }
 
 extern void
 PL_mst_load_idt(void)
 {
-	PL_mat_cpy(mat_model, mat_idt);
+	mat_to_aff(mat_model, mat_idt);
 }
 
 extern void
 PL_mst_load(int *m)
 {
-	PL_mat_cpy(mat_model, m);
+	mat_to_aff(mat_model, m);
 }
 
 extern void
 PL_mst_mul(int *m)
 {
-	PL_mat_mul(mat_model, m);
+	int t[16];
+
+	aff_to_mat(t, mat_model);
+	PL_mat_mul(t, m);
+	mat_to_aff(mat_model, t);
 }
 
-extern void
-PL_mst_scale(int x, int y, int z)
+#define _M_(x, y) (((x) * (y)) >> PL_P)
+
+/* The in-place ops below give the same result as building the 4x4 and
+ * calling PL_mst_mul, products are shifted one by one like PL_mat_mul. */
+
+static int
+scale_elem(int s, int v)
 {
-	int mat[16];
+	int64_t r = ((int64_t)s * v) >> PL_P;
 
-	memcpy(mat, mat_idt, sizeof(mat));
+#ifdef PL_MST_ROT16
+	/* would not survive a push, saturate here where it is caused */
+	if (r > ROT16_MAX || r < ROT16_MIN) {
+		EXT_error(PL_ERR_MISC, "math", "mst scale of 2 or more with ROT16");
+		return (r > 0) ? ROT16_MAX : ROT16_MIN;
+	}
+#endif
+	return (int)r;
+}
 
-	mat[0] = x;
-	mat[5] = y;
-	mat[10] = z;
-	PL_mst_mul(mat);
+extern void
+PL_mst_scale(int x, int y, int z)
+{
+	int *m = mat_model;
+	int s[3];
+	int i, j;
+
+	s[0] = x;
+	s[1] = y;
+	s[2] = z;
+	/* 64-bit products, scales of 2 and up would wrap the 32-bit ones */
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			m[AR(i, j)] = scale_elem(s[i], m[AR(i, j)]);
+		}
+	}
 }
 
 extern void
 PL_mst_translate(int x, int y, int z)
 {
-	int mat[16];
+	int *m = mat_model;
+	int j;
 
-	memcpy(mat, mat_idt, sizeof(mat));
-
-	mat[12] = x;
-	mat[13] = y;
-	mat[14] = z;
-	PL_mst_mul(mat);
+	for (j = 0; j < 3; j++) {
+		m[AT(j)] += _M_(x, m[AR(0, j)]) + _M_(y, m[AR(1, j)]) +
+					_M_(z, m[AR(2, j)]);
+	}
 }
 
-#define _M_(x, y)  (((x) * (y)) >> PL_P)
-#define _MI_(i, j) (((i) << 2) + (j))
+/* rows a and b become c*a + s*b and c*b - s*a */
+static void
+rotate_rows(int a, int b, int c, int s)
+{
+	int *m = mat_model;
+	int j, ra, rb;
+
+	for (j = 0; j < 3; j++) {
+		ra = m[AR(a, j)];
+		rb = m[AR(b, j)];
+		m[AR(a, j)] = _M_(c, ra) + _M_(s, rb);
+		m[AR(b, j)] = _M_(-s, ra) + _M_(c, rb);
+	}
+}
 
 extern void
 PL_mst_rotatex(int rx)
 {
-	int cx, sx;
-	int mat[16];
-
-	memcpy(mat, mat_idt, sizeof(mat));
-
-	cx = PL_cos[rx & PL_TRIGMSK];
-	sx = PL_sin[rx & PL_TRIGMSK];
-
-	mat[_MI_(1, 1)] = cx;
-	mat[_MI_(2, 1)] = -sx;
-	mat[_MI_(1, 2)] = sx;
-	mat[_MI_(2, 2)] = cx;
-
-	PL_mst_mul(mat);
+	rotate_rows(1, 2, PL_cos(rx), PL_sin(rx));
 }
 
 extern void
 PL_mst_rotatey(int ry)
 {
-	int cy, sy;
-	int mat[16];
+	rotate_rows(2, 0, PL_cos(ry), PL_sin(ry));
+}
 
-	memcpy(mat, mat_idt, sizeof(mat));
+extern void
+PL_mst_rotatez(int rz)
+{
+	rotate_rows(1, 0, PL_cos(rz), PL_sin(rz));
+}
 
-	cy = PL_cos[ry & PL_TRIGMSK];
-	sy = PL_sin[ry & PL_TRIGMSK];
+PL_GFX_ATTRIBUTE extern void
+PL_mst_xf_modelview_vec(const int *v, int *out, int len)
+{
+	register int x, y, z;
+	int m00, m01, m02, m03;
+	int m10, m11, m12, m13;
+	int m20, m21, m22, m23;
+	int mv[16];
+
+	/* model then view, once per call instead of per vertex */
+	modelview(mv);
+
+	m00 = mv[0];
+	m01 = mv[4];
+	m02 = mv[8];
+	m03 = mv[12];
+	m10 = mv[1];
+	m11 = mv[5];
+	m12 = mv[9];
+	m13 = mv[13];
+	m20 = mv[2];
+	m21 = mv[6];
+	m22 = mv[10];
+	m23 = mv[14];
 
-	mat[_MI_(0, 0)] = cy;
-	mat[_MI_(2, 0)] = sy;
-	mat[_MI_(0, 2)] = -sy;
-	mat[_MI_(2, 2)] = cy;
+	while ((len--) > 0) {
+		x = v[0];
+		y = v[1];
+		z = v[2];
 
-	PL_mst_mul(mat);
+		out[0] = ((x * m00 + y * m01 + z * m02) >> PL_P) + m03;
+		out[1] = ((x * m10 + y * m11 + z * m12) >> PL_P) + m13;
+		out[2] = ((x * m20 + y * m21 + z * m22) >> PL_P) + m23;
+		v += PL_VLEN;
+		out += PL_VLEN;
+	}
 }
 
-extern void
-PL_mst_rotatez(int rz)
+/* 16-bit kernels take the fused matrix with int16 coefficients and the
+ * shift back to units, Q14 for plain vertices */
+#define XF16_P (PL_P - 1)
+
+/* Any int16 vertex is safe when each output's sum of |coefficients| times
+ * 32768 fits an int32 (the sum is below 65536) and so does the shifted sum
+ * plus the translation. Matrices that fail go to the wide path. */
+static int
+xf16_fits(const int *q, int sh)
 {
-	int cz, sz;
-	int mat[16];
+	int64_t s, t;
+	int i, j;
+
+	for (j = 0; j < 3; j++) {
+		s = 0;
+		for (i = 0; i < 3; i++) {
+			t = q[(i << 2) + j];
+			s += t < 0 ? -t : t;
+		}
+		t = q[12 + j];
+		t = t < 0 ? -t : t;
+		if ((s << 15) > INT32_MAX || ((s << 15) >> sh) + t > INT32_MAX) {
+			return 0;
+		}
+	}
+	return 1;
+}
 
-	memcpy(mat, mat_idt, sizeof(mat));
+#if defined(PL_SIMD) && defined(__ARM_FEATURE_DSP)
 
-	cz = PL_cos[rz & PL_TRIGMSK];
-	sz = PL_sin[rz & PL_TRIGMSK];
+/* Cortex-M4/M33 dual 16x16 multiply-accumulate */
+static inline int32_t
+smuad(uint32_t a, uint32_t b)
+{
+	int32_t r;
 
-	mat[_MI_(0, 0)] = cz;
-	mat[_MI_(1, 0)] = sz;
-	mat[_MI_(0, 1)] = -sz;
-	mat[_MI_(1, 1)] = cz;
+	__asm__("smuad %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+	return r;
+}
 
-	PL_mst_mul(mat);
+static inline int32_t
+smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+	int32_t r;
+
+	__asm__("smlad %0, %1, %2, %3" : "=r"(r) : "r"(a), "r"(b), "r"(acc));
+	return r;
 }
 
-#undef _MI_
+#define PACK16(lo, hi) (((uint32_t)(hi) << 16) | ((uint32_t)(lo) & 0xffff))
 
-PL_GFX_ATTRIBUTE extern void
-PL_mst_xf_modelview_vec(const int *v, int *out, int len)
+static void
+xf16(const int16_t *v, int *out, int len, const int *q, int sh)
 {
-	register int sx, sy, cx, cy, cz, sz;
-	register int x, y, z, w;
-	int xx, yy, zz;
+	uint32_t cx_xy, cy_xy, cz_xy, cx_z, cy_z, cz_z;
+	uint32_t xy0, zw0, xy1, zw1;
 	int tx, ty, tz;
-	int *m;
 
-	cx = PL_cos[xf_vw.rx];
-	sx = PL_sin[xf_vw.rx];
-	cy = PL_cos[xf_vw.ry];
-	sy = PL_sin[xf_vw.ry];
-	cz = PL_cos[xf_vw.rz];
-	sz = PL_sin[xf_vw.rz];
+	/* [x, y] and [z, 0] of a vertex are one word each */
+	cx_xy = PACK16(q[0], q[4]);
+	cx_z = PACK16(q[8], 0);
+	cy_xy = PACK16(q[1], q[5]);
+	cy_z = PACK16(q[9], 0);
+	cz_xy = PACK16(q[2], q[6]);
+	cz_z = PACK16(q[10], 0);
+	tx = q[12];
+	ty = q[13];
+	tz = q[14];
+
+	for (; len >= 2; len -= 2) {
+		memcpy(&xy0, v + 0, 4);
+		memcpy(&zw0, v + 2, 4);
+		memcpy(&xy1, v + 4, 4);
+		memcpy(&zw1, v + 6, 4);
+		out[0] = (smlad(xy0, cx_xy, smuad(zw0, cx_z)) >> sh) + tx;
+		out[1] = (smlad(xy0, cy_xy, smuad(zw0, cy_z)) >> sh) + ty;
+		out[2] = (smlad(xy0, cz_xy, smuad(zw0, cz_z)) >> sh) + tz;
+		out[4] = (smlad(xy1, cx_xy, smuad(zw1, cx_z)) >> sh) + tx;
+		out[5] = (smlad(xy1, cy_xy, smuad(zw1, cy_z)) >> sh) + ty;
+		out[6] = (smlad(xy1, cz_xy, smuad(zw1, cz_z)) >> sh) + tz;
+		v += 2 * PL_VLEN;
+		out += 2 * PL_VLEN;
+	}
+	if (len) {
+		memcpy(&xy0, v + 0, 4);
+		memcpy(&zw0, v + 2, 4);
+		out[0] = (smlad(xy0, cx_xy, smuad(zw0, cx_z)) >> sh) + tx;
+		out[1] = (smlad(xy0, cy_xy, smuad(zw0, cy_z)) >> sh) + ty;
+		out[2] = (smlad(xy0, cz_xy, smuad(zw0, cz_z)) >> sh) + tz;
+	}
+}
 
-	m = mat_model;
+#elif defined(PL_SIMD) && defined(__SSE2__)
 
-	tx = xf_vw.tx + m[12];
-	ty = xf_vw.ty + m[13];
-	tz = xf_vw.tz + m[14];
+#include <emmintrin.h>
+
+/* two [x, y, z, 0] vertices per 128-bit load */
+static void
+xf16(const int16_t *v, int *out, int len, const int *q, int sh)
+{
+	__m128i cx, cy, cz, t, zero, n, vv, sx, sy, sz, xy;
+
+	cx = _mm_setr_epi16(q[0], q[4], q[8], 0, q[0], q[4], q[8], 0);
+	cy = _mm_setr_epi16(q[1], q[5], q[9], 0, q[1], q[5], q[9], 0);
+	cz = _mm_setr_epi16(q[2], q[6], q[10], 0, q[2], q[6], q[10], 0);
+	t = _mm_setr_epi32(q[12], q[13], q[14], 0);
+	zero = _mm_setzero_si128();
+	n = _mm_cvtsi32_si128(sh);
+
+	for (; len >= 2; len -= 2) {
+		vv = _mm_loadu_si128((const __m128i *)v);
+		/* [x*m0 + y*m1, z*m2] per vertex, then fold the pairs */
+		sx = _mm_madd_epi16(vv, cx);
+		sy = _mm_madd_epi16(vv, cy);
+		sz = _mm_madd_epi16(vv, cz);
+		sx = _mm_add_epi32(sx, _mm_shuffle_epi32(sx, _MM_SHUFFLE(2, 3, 0, 1)));
+		sy = _mm_add_epi32(sy, _mm_shuffle_epi32(sy, _MM_SHUFFLE(2, 3, 0, 1)));
+		sz = _mm_add_epi32(sz, _mm_shuffle_epi32(sz, _MM_SHUFFLE(2, 3, 0, 1)));
+		sx = _mm_sra_epi32(sx, n);
+		sy = _mm_sra_epi32(sy, n);
+		sz = _mm_sra_epi32(sz, n);
+		/* sx = [X0, X0, X1, X1] etc, regroup into [X, Y, Z, 0] */
+		xy = _mm_unpacklo_epi32(sx, sy);
+		_mm_storeu_si128((__m128i *)out,
+						 _mm_add_epi32(_mm_unpacklo_epi64(xy,
+							 _mm_unpacklo_epi32(sz, zero)), t));
+		xy = _mm_unpackhi_epi32(sx, sy);
+		_mm_storeu_si128((__m128i *)(out + PL_VLEN),
+						 _mm_add_epi32(_mm_unpacklo_epi64(xy,
+							 _mm_unpackhi_epi32(sz, zero)), t));
+		v += 2 * PL_VLEN;
+		out += 2 * PL_VLEN;
+	}
+	if (len) {
+		out[0] = ((v[0] * q[0] + v[1] * q[4] + v[2] * q[8]) >> sh) + q[12];
+		out[1] = ((v[0] * q[1] + v[1] * q[5] + v[2] * q[9]) >> sh) + q[13];
+		out[2] = ((v[0] * q[2] + v[1] * q[6] + v[2] * q[10]) >> sh) + q[14];
+	}
+}
+
+#else
+
+static void
+xf16(const int16_t *v, int *out, int len, const int *q, int sh)
+{
+	register int x, y, z;
 
 	while ((len--) > 0) {
 		x = v[0];
 		y = v[1];
 		z = v[2];
 
-		xx = ((x * m[0] + y * m[4] + z * m[8]) >> PL_P) + tx;
-		yy = ((x * m[1] + y * m[5] + z * m[9]) >> PL_P) + ty;
-		zz = ((x * m[2] + y * m[6] + z * m[10]) >> PL_P) + tz;
+		out[0] = ((x * q[0] + y * q[4] + z * q[8]) >> sh) + q[12];
+		out[1] = ((x * q[1] + y * q[5] + z * q[9]) >> sh) + q[13];
+		out[2] = ((x * q[2] + y * q[6] + z * q[10]) >> sh) + q[14];
+		v += PL_VLEN;
+		out += PL_VLEN;
+	}
+}
 
-		/* yaw */
-		w = (zz * sy + xx * cy) >> PL_P;
-		zz = (zz * cy - xx * sy) >> PL_P;
-		xx = w;
+#endif
+
+PL_GFX_ATTRIBUTE extern void
+PL_mst_xf_modelview_vec16(const int16_t *v, int *out, int len)
+{
+	int mv[16];
+	int i, j, c;
+
+	modelview(mv);
+
+	/* Q14 holds coefficients in [-2, 2), scale further on the wide path */
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			c = mv[(i << 2) + j] >> 1;
+			if (c < INT16_MIN || c > INT16_MAX) {
+				goto wide;
+			}
+			mv[(i << 2) + j] = c;
+		}
+	}
+	if (!xf16_fits(mv, XF16_P)) {
+		goto wide;
+	}
+	xf16(v, out, len, mv, XF16_P);
+	return;
 
-		/* pitch */
-		w = (yy * cx - zz * sx) >> PL_P;
-		zz = (yy * sx + zz * cx) >> PL_P;
-		yy = w;
+wide:
+	modelview(mv);
+	while ((len--) > 0) {
+		for (j = 0; j < 3; j++) {
+			out[j] = (int)(((int64_t)v[0] * mv[j] + (int64_t)v[1] * mv[4 + j] +
+							(int64_t)v[2] * mv[8 + j]) >> PL_P) + mv[12 + j];
+		}
+		v += PL_VLEN;
+		out += PL_VLEN;
+	}
+}
 
-		/* roll */
-		w = (xx * cz - yy * sz) >> PL_P;
-		xx = (xx * sz + yy * cz) >> PL_P;
-		yy = w;
+/* 64-bit fallback for quantized meshes, c is Q(2 * PL_P) */
+static void
+xf_wide(const int16_t *v, int *out, int len, const int64_t *c, const int *t)
+{
+	int j;
 
-		out[0] = xx;
-		out[1] = yy;
-		out[2] = zz;
+	while ((len--) > 0) {
+		for (j = 0; j < 3; j++) {
+			out[j] = (int)((v[0] * c[j] + v[1] * c[3 + j] + v[2] * c[6 + j]) >>
+						   (2 * PL_P)) + t[12 + j];
+		}
 		v += PL_VLEN;
 		out += PL_VLEN;
 	}
 }
 
+/* Fused model+view with a quantized mesh's scale and offset folded in.
+ * The offset moves the translation, the scaled coefficients c are narrowed
+ * to at most 1 << 14 so three int16 products still sum in 32 bits.
+ * Returns the shift from q's coefficients back to units, or -1 if the
+ * 16-bit kernel would overflow and xf_wide has to use c instead. */
+static int
+quant_modelview(const struct PL_QUANT *qt, int *q, int64_t *c)
+{
+	int mv[16];
+	int64_t max = 0;
+	int i, j, sh;
+
+	modelview(mv);
+	for (j = 0; j < 3; j++) {
+		q[12 + j] = mv[12 + j] + (int)(((int64_t)qt->off[0] * mv[j] +
+										(int64_t)qt->off[1] * mv[4 + j] +
+										(int64_t)qt->off[2] * mv[8 + j] +
+										(1 << (PL_P - 1))) >> PL_P);
+	}
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			c[i * 3 + j] = (int64_t)mv[(i << 2) + j] * PL_QUANT_SCALE(qt, i);
+			if (c[i * 3 + j] > max) {
+				max = c[i * 3 + j];
+			} else if (-c[i * 3 + j] > max) {
+				max = -c[i * 3 + j];
+			}
+		}
+	}
+	/* c is in Q(2 * PL_P) */
+	sh = 2 * PL_P;
+	while (sh > 0 && (max >> (2 * PL_P - sh)) > (1 << 14)) {
+		sh--;
+	}
+	/* too wide for int16 products even at units */
+	if ((max >> (2 * PL_P - sh)) > (1 << 14)) {
+		return -1;
+	}
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 3; j++) {
+			q[(i << 2) + j] = (int)(c[i * 3 + j] >> (2 * PL_P - sh));
+		}
+	}
+	return xf16_fits(q, sh) ? sh : -1;
+}
+
+PL_GFX_ATTRIBUTE extern void
+PL_mst_xf_modelview_q16(const int16_t *v, int *out, int len,
+						const struct PL_QUANT *q)
+{
+	int64_t c[9];
+	int m[16];
+	int sh;
+
+	sh = quant_modelview(q, m, c);
+	if (sh < 0) {
+		xf_wide(v, out, len, c, m);
+		return;
+	}
+	xf16(v, out, len, m, sh);
+}
+
+#define XF8_CHUNK 32 /* vertices widened per xf16 call */
+
+/* three bytes a vertex, widened a chunk at a time on the stack so the
+ * int16 kernel does the math */
+PL_GFX_ATTRIBUTE extern void
+PL_mst_xf_modelview_q8(const int8_t *v, int *out, int len,
+					   const struct PL_QUANT *q)
+{
+	int16_t w[XF8_CHUNK * PL_VLEN];
+	int64_t c[9];
+	int m[16];
+	int i, n, sh;
+
+	sh = quant_modelview(q, m, c);
+	for (; len > 0; len -= n) {
+		n = len < XF8_CHUNK ? len : XF8_CHUNK;
+		for (i = 0; i < n; i++) {
+			w[i * PL_VLEN + 0] = v[0];
+			w[i * PL_VLEN + 1] = v[1];
+			w[i * PL_VLEN + 2] = v[2];
+			w[i * PL_VLEN + 3] = 0;
+			v += 3;
+		}
+		if (sh < 0) {
+			xf_wide(w, out, n, c, m);
+		} else {
+			xf16(w, out, n, m, sh);
+		}
+		out += n * PL_VLEN;
+	}
+}
+
 PL_GFX_ATTRIBUTE extern void
 PL_mat_mul(int *a, int *b)
 {
@@ -317,24 +917,90 @@ PL_vec_shorten(int *v)
 	}
 }
 
+#ifdef PL_RECIP_PROJECT
+
+#define RECIP_MASK ((1 << PL_RECIP_LUT_BITS) - 1)
+
+/* 1 / m in Q16 for m in [1, 2), sampled at the middle of each interval */
+static uint16_t recip_lut[1 << PL_RECIP_LUT_BITS];
+
+extern void
+PL_recip_init(void)
+{
+	uint32_t i, den;
+
+	for (i = 0; i <= RECIP_MASK; i++) {
+		den = (1u << (PL_RECIP_LUT_BITS + 1)) + 2 * i + 1;
+		recip_lut[i] =
+			(uint16_t)(((1u << (PL_RECIP_LUT_BITS + 17)) + (den >> 1)) / den);
+	}
+}
+
+PL_GFX_ATTRIBUTE extern int
+PL_recip(int lg, int z)
+{
+	uint32_t m, r;
+	int n, s;
+
+	/* z = m * 2^n with m in [1, 2) as Q31 */
+	n = 31 - __builtin_clz((uint32_t)z);
+	m = (uint32_t)z << (31 - n);
+	r = recip_lut[(m >> (31 - PL_RECIP_LUT_BITS)) & RECIP_MASK];
+#if PL_RECIP_NEWTON
+	/* r = r * (2 - m * r), the Q31 product wraps 2.0 to zero */
+	m = 0u - (uint32_t)(((uint64_t)m * r) >> 16);
+	r = (uint32_t)(((uint64_t)r * m) >> 17); /* now Q30 */
+	s = 30 + n - lg;
+#else
+	s = 16 + n - lg;
+#endif
+	if (s >= 32) {
+		return 0;
+	}
+	if (s >= 0) {
+		return (int)(r >> s);
+	}
+	/* quotients past an int saturate */
+	if (s <= -31 || r > ((uint32_t)INT32_MAX >> -s)) {
+		return INT32_MAX;
+	}
+	return (int)(r << -s);
+}
+
+#endif
+
 PL_GFX_ATTRIBUTE extern void
 PL_psp_project(int *src, int *dst, int len, int num, int fov)
 {
-	int z, ffac;
+	int z, fs;
 	int nbytes;
 	int shift = 0;
+#ifdef PL_RECIP_PROJECT
+	int lg = fov + 12;
+#else
+	int ffac = (1 << (fov + 12));
+#endif
 
-	ffac = (1 << (fov + 12));
 	shift = fov - 8;
 
 	len -= 3;
 	nbytes = len * sizeof(int);
 	while (num--) {
 		z = src[2];
+#ifdef PL_RECIP_PROJECT
+		fov = PL_recip(lg, z);
+#else
 		fov = ffac / z;
+#endif
+#ifdef PL_DYNRES
+		/* x/y follow the render size, 1/Z does not */
+		fs = (fov * PL_vp_scale) >> 8;
+#else
+		fs = fov;
+#endif
 		/* rounding is necessary */
-		*dst++ = ((src[0] * fov + (1 << 11)) >> 12) + PL_vp_cen_x;
-		*dst++ = PL_vp_cen_y - ((src[1] * fov + (1 << 11)) >> 12);
+		*dst++ = ((src[0] * fs + (1 << 11)) >> 12) + PL_vp_cen_x;
+		*dst++ = PL_vp_cen_y - ((src[1] * fs + (1 << 11)) >> 12);
 		*dst++ = fov >> shift; /* 1/Z in 12.20 */
 		memcpy(dst, src += 3, nbytes);
 		src += len;
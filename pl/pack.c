@@ -0,0 +1,290 @@
+/*****************************************************************************/
+/*
+* PiSHi LE (Lite edition) - Fundamentals of the King's Crook graphics engine.
+*
+*   by EMMIR 2018-2022
+*
+*   YouTube: https://www.youtube.com/c/LMP88
+*
+* This software is released into the public domain.
+*/
+/*****************************************************************************/
+
+#include "pl.h"
+
+/*  pack.c
+*
+* Asset packs, see the ASSET PACK section of pl.h.
+* Opening one checks that every table and array lies within the image and
+* points small descriptors at them, the meshes and texels themselves are
+* rendered from the image where it is.
+*
+*/
+
+#include <string.h>
+
+static int
+pack_fail(char *msg)
+{
+	EXT_error(PL_ERR_MISC, "pack", msg);
+	return 0;
+}
+
+/* n elements of esz bytes at off, aligned to align, within the image */
+static int
+in_image(const struct PL_PACK_HEADER *hdr, uint32_t off, uint32_t n,
+		 uint32_t esz, uint32_t align)
+{
+	if (off & (align - 1)) {
+		return 0;
+	}
+	return (uint64_t)off + (uint64_t)n * esz <= hdr->size;
+}
+
+static int
+name_ok(const char *name)
+{
+	return memchr(name, '\0', 16) != NULL;
+}
+
+/* bytes of the texels or indices of a texture's mip chain */
+static uint32_t
+tex_bytes(const struct PL_PACK_TEX *t)
+{
+	uint32_t n = 0;
+	int i;
+
+	for (i = 0; i < (t->levels ? t->levels : 1); i++) {
+		n += (uint32_t)1 << (t->alw + t->alh - 2 * i);
+	}
+	if (t->fmt == PL_TEX_I4) {
+		return (n + 1) >> 1;
+	}
+	if (t->fmt == PL_TEX_I2) {
+		return (n + 3) >> 2;
+	}
+	return n * sizeof(PL_TEXEL);
+}
+
+static int
+open_texture(const uint8_t *base, const struct PL_PACK_TEX *t,
+			 struct PL_TEX_CONST *dst)
+{
+	int min;
+
+	if (!name_ok(t->name) || t->fmt > PL_TEX_I2 || t->layout > PL_TEX_MORTON) {
+		return pack_fail("bad texture entry");
+	}
+	min = t->lw < t->lh ? t->lw : t->lh;
+	if (t->lw < 1 || t->lh < 1 || t->alw > 8 || t->alh > 8 ||
+		t->lw > t->alw || t->lh > t->alh || t->levels > min + 1 ||
+		(t->ax + (1 << t->lw)) > (1 << t->alw) ||
+		(t->ay + (1 << t->lh)) > (1 << t->alh) ||
+		(t->ax & ((1 << t->lw) - 1)) || (t->ay & ((1 << t->lh) - 1))) {
+		return pack_fail("bad texture size");
+	}
+	if (t->data_size < tex_bytes(t)) {
+		return pack_fail("texture data too short");
+	}
+	dst->fmt = t->fmt;
+	dst->layout = t->layout;
+	dst->levels = t->levels;
+	dst->lw = t->lw;
+	dst->lh = t->lh;
+	dst->ax = t->ax;
+	dst->ay = t->ay;
+	dst->alw = t->alw;
+	dst->alh = t->alh;
+	if (t->fmt == PL_TEX_DIRECT) {
+		dst->data = (const PL_TEXEL *)(base + t->data_off);
+	} else {
+		dst->idx = base + t->data_off;
+		dst->pal = (const PL_TEXEL *)(base + t->pal_off);
+	}
+	return 1;
+}
+
+static int
+open_mesh(const uint8_t *base, const struct PL_PACK_MESH *m,
+		  const struct PL_TEX_CONST *textures, struct PL_OBJ_CONST *dst)
+{
+	const struct PL_PACK_HEADER *hdr = (const struct PL_PACK_HEADER *)base;
+	uint32_t vsz = sizeof(int), vlen = PL_VLEN;
+
+	if (m->flags & PL_PACK_VERTS16) {
+		vsz = sizeof(int16_t);
+	} else if (m->flags & PL_PACK_VERTS8) {
+		vsz = sizeof(int8_t);
+		vlen = 3;
+	}
+	if (!name_ok(m->name) || m->n_verts >= PL_MAX_OBJ_V ||
+		((m->flags & PL_PACK_VERTS16) && (m->flags & PL_PACK_VERTS8))) {
+		return pack_fail("bad mesh entry");
+	}
+	if (!in_image(hdr, m->verts_off, m->n_verts, vlen * vsz, vsz) ||
+		!in_image(hdr, m->polys_off, m->n_polys, sizeof(struct PL_PACK_POLY),
+				  sizeof(int))) {
+		return pack_fail("mesh data out of the image");
+	}
+	if (m->flags & PL_PACK_VERTS16) {
+		dst->verts16 = (const int16_t *)(base + m->verts_off);
+	} else if (m->flags & PL_PACK_VERTS8) {
+		dst->verts8 = (const int8_t *)(base + m->verts_off);
+	} else {
+		dst->verts = (const int *)(base + m->verts_off);
+	}
+	dst->quant = m->quant;
+	dst->n_verts = m->n_verts;
+	dst->n_polys = m->n_polys;
+	dst->pack_polys = (const struct PL_PACK_POLY *)(base + m->polys_off);
+	dst->pack_tex = textures;
+	return 1;
+}
+
+extern int
+PL_pack_open(struct PL_PACK *pack, const void *image, uint32_t size)
+{
+	const uint8_t *base = image;
+	const struct PL_PACK_HEADER *hdr = image;
+	const struct PL_PACK_TEX *t;
+	uint32_t i;
+
+	memset(pack, 0, sizeof(*pack));
+	if (image == NULL || ((uintptr_t)image & (PL_PACK_ALIGN - 1))) {
+		return pack_fail("image missing or misaligned");
+	}
+	if (size < sizeof(*hdr) || memcmp(hdr->magic, "PLPK", 4) != 0) {
+		return pack_fail("not an asset pack");
+	}
+	if (hdr->version != PL_PACK_VERSION) {
+		return pack_fail("unsupported pack version");
+	}
+	if (hdr->size < sizeof(*hdr) || hdr->size > size) {
+		return pack_fail("pack truncated");
+	}
+	if (hdr->n_textures && hdr->texel_bits != PL_TEXEL_BITS) {
+		return pack_fail("texels are for another PL_COLOR_DEPTH");
+	}
+	if (!in_image(hdr, hdr->mesh_off, hdr->n_meshes,
+				  sizeof(struct PL_PACK_MESH), PL_PACK_ALIGN) ||
+		!in_image(hdr, hdr->tex_off, hdr->n_textures,
+				  sizeof(struct PL_PACK_TEX), PL_PACK_ALIGN)) {
+		return pack_fail("tables out of the image");
+	}
+	pack->hdr = hdr;
+	pack->mesh_ents = (const struct PL_PACK_MESH *)(base + hdr->mesh_off);
+	pack->tex_ents = (const struct PL_PACK_TEX *)(base + hdr->tex_off);
+
+	if (hdr->n_textures) {
+		pack->textures = EXT_calloc(hdr->n_textures,
+									sizeof(struct PL_TEX_CONST));
+		if (pack->textures == NULL) {
+			EXT_error(PL_ERR_NO_MEM, "pack", "no memory");
+			return 0;
+		}
+	}
+	for (i = 0; i < hdr->n_textures; i++) {
+		t = &pack->tex_ents[i];
+		if (!in_image(hdr, t->data_off, t->data_size, 1, sizeof(PL_TEXEL)) ||
+			(t->fmt != PL_TEX_DIRECT &&
+			 !in_image(hdr, t->pal_off, t->fmt == PL_TEX_I4 ? 16 : 4,
+					   sizeof(PL_TEXEL), sizeof(PL_TEXEL)))) {
+			PL_pack_close(pack);
+			return pack_fail("texture data out of the image");
+		}
+		if (!open_texture(base, t, &pack->textures[i])) {
+			PL_pack_close(pack);
+			return 0;
+		}
+	}
+	if (hdr->n_meshes) {
+		pack->meshes = EXT_calloc(hdr->n_meshes, sizeof(struct PL_OBJ_CONST));
+		if (pack->meshes == NULL) {
+			PL_pack_close(pack);
+			EXT_error(PL_ERR_NO_MEM, "pack", "no memory");
+			return 0;
+		}
+	}
+	for (i = 0; i < hdr->n_meshes; i++) {
+		if (!open_mesh(base, &pack->mesh_ents[i], pack->textures,
+					   &pack->meshes[i])) {
+			PL_pack_close(pack);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+extern int
+PL_pack_verify(const struct PL_PACK *pack)
+{
+	const struct PL_PACK_MESH *m;
+	const struct PL_PACK_POLY *p;
+	uint32_t i, j;
+	int k, nv;
+
+	for (i = 0; i < pack->hdr->n_meshes; i++) {
+		m = &pack->mesh_ents[i];
+		p = pack->meshes[i].pack_polys;
+		for (j = 0; j < m->n_polys; j++, p++) {
+			nv = p->n_verts & 0xf;
+			/* the first vertex is repeated after the last */
+			if (nv < 3 || nv + 1 > 6) {
+				return pack_fail("bad polygon vertex count");
+			}
+			if (p->tex != PL_PACK_NO_TEX && p->tex >= pack->hdr->n_textures) {
+				return pack_fail("polygon texture out of range");
+			}
+			for (k = 0; k <= nv; k++) {
+				if ((uint32_t)p->verts[k * PL_POLY_VLEN] >= m->n_verts) {
+					return pack_fail("polygon vertex out of range");
+				}
+			}
+		}
+	}
+	return 1;
+}
+
+extern void
+PL_pack_close(struct PL_PACK *pack)
+{
+	if (pack->meshes) {
+		EXT_free(pack->meshes);
+	}
+	if (pack->textures) {
+		EXT_free(pack->textures);
+	}
+	memset(pack, 0, sizeof(*pack));
+}
+
+extern int
+PL_pack_find_mesh(const struct PL_PACK *pack, const char *name)
+{
+	uint32_t i;
+
+	if (pack->hdr == NULL) {
+		return -1;
+	}
+	for (i = 0; i < pack->hdr->n_meshes; i++) {
+		if (strcmp(pack->mesh_ents[i].name, name) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+extern int
+PL_pack_find_texture(const struct PL_PACK *pack, const char *name)
+{
+	uint32_t i;
+
+	if (pack->hdr == NULL) {
+		return -1;
+	}
+	for (i = 0; i < pack->hdr->n_textures; i++) {
+		if (strcmp(pack->tex_ents[i].name, name) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
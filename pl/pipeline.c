@@ -0,0 +1,124 @@
+/*****************************************************************************/
+/*
+* PiSHi LE (Lite edition) - Fundamentals of the King's Crook graphics engine.
+*
+*   by EMMIR 2018-2022
+*
+*   YouTube: https://www.youtube.com/c/LMP88
+*
+* This software is released into the public domain.
+*/
+/*****************************************************************************/
+
+#include "pl.h"
+
+/*  pipeline.c
+*
+* Single-producer/single-consumer polygon queue between the calculation
+* stage (transform, cull, clip, project) and the fill stage.
+* The thread rendering objects produces projected polygons, a dedicated
+* thread consumes them into the span kernels.
+*
+*/
+
+#ifdef PL_PIPELINE
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#define PIPE_MASK (PL_PIPELINE_QUEUE_LEN - 1)
+
+#if (PL_PIPELINE_QUEUE_LEN & PIPE_MASK)
+#error "PL_PIPELINE_QUEUE_LEN must be a power of two"
+#endif
+
+static struct PL_PIPE_POLY pipe_ring[PL_PIPELINE_QUEUE_LEN];
+
+/* free running counters, only written by their owning side */
+static atomic_t pipe_head; /* next record to be produced */
+static atomic_t pipe_tail; /* next record to be consumed */
+
+/* the ring itself is lock-free, these only park a side with nothing to do */
+static K_SEM_DEFINE(pipe_work, 0, 1);  /* queue went from empty to not */
+static K_SEM_DEFINE(pipe_space, 0, 1); /* queue went from full to not */
+static K_SEM_DEFINE(pipe_idle, 0, 1);  /* queue was drained */
+
+static void
+pipe_consume(void *p1, void *p2, void *p3)
+{
+	struct PL_PIPE_POLY *rec;
+	unsigned int head, tail;
+
+	(void)p1;
+	(void)p2;
+	(void)p3;
+
+	for (;;) {
+		tail = (unsigned int)atomic_get(&pipe_tail);
+		head = (unsigned int)atomic_get(&pipe_head);
+		if (tail == head) {
+			k_sem_take(&pipe_work, K_FOREVER);
+			continue;
+		}
+		rec = &pipe_ring[tail & PIPE_MASK];
+		PL_fill_polygon(rec->rmode, rec->stream, rec->nedge, rec->color,
+						&rec->tex);
+		atomic_set(&pipe_tail, tail + 1);
+
+		/* the producer only waits after seeing the queue full/non-empty */
+		head = (unsigned int)atomic_get(&pipe_head);
+		if ((head - tail) == PL_PIPELINE_QUEUE_LEN) {
+			k_sem_give(&pipe_space);
+		}
+		if (head == (tail + 1)) {
+			k_sem_give(&pipe_idle);
+		}
+	}
+}
+
+K_THREAD_DEFINE(pl_pipe_thread, PL_PIPELINE_STACK_SIZE, pipe_consume, NULL,
+				NULL, NULL, PL_PIPELINE_PRIORITY, 0, 0);
+
+extern struct PL_PIPE_POLY *
+PL_pipe_acquire(void)
+{
+	unsigned int head;
+
+	head = (unsigned int)atomic_get(&pipe_head);
+	while ((head - (unsigned int)atomic_get(&pipe_tail)) >=
+		PL_PIPELINE_QUEUE_LEN) {
+		k_sem_take(&pipe_space, K_FOREVER);
+	}
+	return &pipe_ring[head & PIPE_MASK];
+}
+
+extern void
+PL_pipe_commit(void)
+{
+	unsigned int head;
+
+	head = (unsigned int)atomic_get(&pipe_head);
+	atomic_set(&pipe_head, head + 1);
+	/* consumer only sleeps after seeing the queue empty */
+	if ((unsigned int)atomic_get(&pipe_tail) == head) {
+		k_sem_give(&pipe_work);
+	}
+}
+
+extern void
+PL_pipe_flush(void)
+{
+	while (atomic_get(&pipe_tail) != atomic_get(&pipe_head)) {
+		k_sem_take(&pipe_idle, K_FOREVER);
+	}
+}
+
+#else
+
+extern void
+PL_pipe_flush(void)
+{
+	/* polygons are filled as soon as they are projected */
+}
+
+#endif
@@ -12,10 +12,6 @@
 
 #include "pl.h"
 
-#include <zephyr/kernel.h>
-#include <zephyr/device.h>
-#include <zephyr/timing/timing.h>
-
 /*  pl.c
 *
 * Handles objects, glues the different modules together.
@@ -65,15 +61,64 @@ load_stream(int *dst, const int *src, int dim, int len, int *minz, int *maxz)
 	*maxz = lmaxz;
 }
 
+struct PL_STATS PL_stats;
+
+extern void
+PL_stats_reset(void)
+{
+	memset(&PL_stats, 0, sizeof(PL_stats));
+}
+
+extern void
+PL_stats_get(struct PL_STATS *out)
+{
+	*out = PL_stats;
+	out->z_fails = out->pixels_tested - out->pixels_written;
+}
+
+static int resv[(PL_MAX_POLY_VERTS * PL_VDIM) * 3];
+
+extern void
+PL_fill_polygon(int rmode, int *proj, int nedge, int color,
+				const struct PL_TEX_CONST *tex)
+{
 #ifdef PERFORMANCE_MEASURE
-static uint32_t total_calculate_time_us;
-static uint32_t total_fill_time_us;
+	uint32_t start_time = EXT_cycles();
 #endif
 
-static int resv[(PL_MAX_POLY_VERTS * PL_VDIM) * 3];
+	PL_TRACE_BEGIN(PL_TRACE_FILL);
+	if (rmode == PL_TEXTURED) {
+		if (tex->fmt == PL_TEX_DIRECT) {
+			PL_lintx_poly(proj, nedge, tex);
+		} else {
+			PL_lintx_idx_poly(proj, nedge, tex);
+		}
+	} else if(rmode == PL_FLAT) {
+		PL_flat_poly(proj, nedge, color);
+	} else if (rmode == PL_FLAT_NOLIGHT) {
+		PL_flat_poly_nolight(proj, nedge, color);
+	} else if (rmode == PL_EDGE_WIREFRAME) {
+		PL_edge_wireframe_poly(proj, nedge, color);
+	} else if (rmode == PL_WIREFRAME) {
+		PL_wireframe_poly(proj, nedge, color);
+	} else if (rmode == PL_TEXTURED_NOLIGHT) {
+		if (tex->fmt == PL_TEX_DIRECT) {
+			PL_lintx_poly_nolight(proj, nedge, tex);
+		} else {
+			PL_lintx_idx_poly_nolight(proj, nedge, tex);
+		}
+	} else if (rmode == PL_NODRAW) {
+		PL_nodraw_poly(proj, nedge, color);
+	} else if (rmode == PL_OVERDRAW) {
+		PL_overdraw_poly(proj, nedge, color);
+	}
+	PL_STAT_TIME(PL_STAGE_FILL, start_time);
+	PL_TRACE_END(PL_TRACE_FILL);
+}
 
 static void
-e_render_polygon_const(const struct PL_POLY_CONST *poly)
+render_polygon_const(const struct PL_TEX_CONST *ptex, const int *verts,
+					 int n_verts, int color)
 {
 	int minz, maxz; /* z extents for frustum testing */
 	int res;        /* result of frustum test */
@@ -82,22 +127,24 @@ e_render_polygon_const(const struct PL_POLY_CONST *poly)
 	const struct PL_TEX_CONST *tex = NULL;
 	int *clipped;
 	int back_face;
+#ifdef PL_PIPELINE
+	struct PL_PIPE_POLY *rec;
+#endif
 #ifdef PERFORMANCE_MEASURE
-	timing_t start_time, end_time;
-	start_time = timing_counter_get();
+	uint32_t start_time = EXT_cycles();
 #endif
 
 	int *copy = resv + (0 * (PL_MAX_POLY_VERTS * PL_VDIM));
 	int *clip = resv + (1 * (PL_MAX_POLY_VERTS * PL_VDIM));
 	int *proj = resv + (2 * (PL_MAX_POLY_VERTS * PL_VDIM));
 
-	nedge = poly->n_verts & 0xf;
+	nedge = n_verts & 0xf;
 	rmode = PL_raster_mode;
 
 	switch (rmode) {
 	case PL_TEXTURED:
-		tex = poly->tex;
-		if (tex != NULL && tex->data) {
+		tex = ptex;
+		if (PL_TEX_VALID(tex)) {
 			stype = PL_STREAM_TEX;
 			break;
 		}
@@ -120,9 +167,12 @@ e_render_polygon_const(const struct PL_POLY_CONST *poly)
 	case PL_NODRAW:
 		stype = PL_STREAM_FLAT;
 		break;
+	case PL_OVERDRAW:
+		stype = PL_STREAM_FLAT;
+		break;
 	case PL_TEXTURED_NOLIGHT:
-		tex = poly->tex;
-		if (tex != NULL && tex->data) {
+		tex = ptex;
+		if (PL_TEX_VALID(tex)) {
 			stype = PL_STREAM_TEX;
 			break;
 		}
@@ -133,11 +183,16 @@ e_render_polygon_const(const struct PL_POLY_CONST *poly)
 	default:
 		return; /* bad raster mode */
 	}
+	PL_STAT_ADD(polys_submitted, 1);
+	PL_TRACE_BEGIN(PL_TRACE_POLY);
 
-	load_stream(copy, poly->verts, stype, nedge + 1, &minz, &maxz);
+	load_stream(copy, verts, stype, nedge + 1, &minz, &maxz);
 	res = PL_frustum_test(minz, maxz);
 
 	if (res == PL_Z_OUTC_OUTSIDE) {
+		PL_STAT_ADD(polys_near_culled, 1);
+		PL_STAT_TIME(PL_STAGE_CALC, start_time);
+		PL_TRACE_END(PL_TRACE_POLY);
 		return;
 	}
 
@@ -145,43 +200,74 @@ e_render_polygon_const(const struct PL_POLY_CONST *poly)
 	back_face = PL_winding_order(copy, copy + stype, copy + stype * 2);
 
 	if ((back_face + 1) & PL_cull_mode) {
+		PL_STAT_ADD(polys_backface_culled, 1);
+		PL_STAT_TIME(PL_STAGE_CALC, start_time);
+		PL_TRACE_END(PL_TRACE_POLY);
 		return;
 	}
 
 	if (res == PL_Z_OUTC_PART_NZ) {
+		PL_STAT_ADD(polys_clipped, 1);
 		clipped = clip;
 		nedge = PL_clip_poly_nz(clipped, copy, stype, nedge);
 	} else {
 		clipped = copy;
 	}
 
+#ifdef PL_PIPELINE
+	/* project straight into the queue record, the fill thread takes it */
+	rec = PL_pipe_acquire();
+	proj = rec->stream;
+#endif
 	PL_psp_project(clipped, proj, stype, nedge + 1, PL_fov);
 
-#ifdef PERFORMANCE_MEASURE
-	end_time = timing_counter_get();
-	total_calculate_time_us += timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time)) / 1000;
-	start_time = timing_counter_get();
-#endif
+	PL_STAT_TIME(PL_STAGE_CALC, start_time);
+	PL_TRACE_END(PL_TRACE_POLY);
 
-	if (rmode == PL_TEXTURED) {
-		PL_lintx_poly(proj, nedge, tex->data);
-	} else if(rmode == PL_FLAT) {
-		PL_flat_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_FLAT_NOLIGHT) {
-		PL_flat_poly_nolight(proj, nedge, poly->color);
-	} else if (rmode == PL_EDGE_WIREFRAME) {
-		PL_edge_wireframe_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_WIREFRAME) {
-		PL_wireframe_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_TEXTURED_NOLIGHT) {
-		PL_lintx_poly_nolight(proj, nedge, tex->data);
-	} else if (rmode == PL_NODRAW) {
-		PL_nodraw_poly(proj, nedge, poly->color);
+#ifdef PL_PIPELINE
+	rec->rmode = rmode;
+	rec->nedge = nedge;
+	rec->color = color;
+	if (stype == PL_STREAM_TEX) {
+		rec->tex = *tex;
 	}
-	#ifdef PERFORMANCE_MEASURE
-	end_time = timing_counter_get();
-	total_fill_time_us += timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time)) / 1000;
-	#endif
+	PL_pipe_commit();
+#else
+	PL_fill_polygon(rmode, proj, nedge, color, tex);
+#endif
+}
+
+static void
+e_render_polygon_const(const struct PL_POLY_CONST *poly)
+{
+	render_polygon_const(poly->tex, poly->verts, poly->n_verts, poly->color);
+}
+
+static void
+e_render_polygon_pack(const struct PL_PACK_POLY *poly,
+					  const struct PL_TEX_CONST *pack_tex)
+{
+	render_polygon_const(poly->tex == PL_PACK_NO_TEX ? NULL
+													 : &pack_tex[poly->tex],
+						 poly->verts, poly->n_verts, poly->color);
+}
+
+/* the fill stage only reads textures */
+static void
+tex_view(struct PL_TEX_CONST *dst, const struct PL_TEX *src)
+{
+	dst->data = src->data;
+	dst->fmt = src->fmt;
+	dst->idx = src->idx;
+	dst->pal = src->pal;
+	dst->layout = src->layout;
+	dst->levels = src->levels;
+	dst->lw = src->lw;
+	dst->lh = src->lh;
+	dst->ax = src->ax;
+	dst->ay = src->ay;
+	dst->alw = src->alw;
+	dst->alh = src->alh;
 }
 
 static void
@@ -194,9 +280,13 @@ e_render_polygon(const struct PL_POLY *poly)
 	const struct PL_TEX *tex = PL_cur_tex;
 	int *clipped;
 	int back_face;
+#ifdef PL_PIPELINE
+	struct PL_PIPE_POLY *rec;
+#else
+	struct PL_TEX_CONST view;
+#endif
 #ifdef PERFORMANCE_MEASURE
-	timing_t start_time, end_time;
-	start_time = timing_counter_get();
+	uint32_t start_time = EXT_cycles();
 #endif
 
 	int *copy = resv + (0 * (PL_MAX_POLY_VERTS * PL_VDIM));
@@ -211,7 +301,7 @@ e_render_polygon(const struct PL_POLY *poly)
 		if (tex == NULL) {
 			tex = poly->tex;
 		}
-		if (tex != NULL && tex->data) {
+		if (PL_TEX_VALID(tex)) {
 			stype = PL_STREAM_TEX;
 			break;
 		}
@@ -234,11 +324,14 @@ e_render_polygon(const struct PL_POLY *poly)
 	case PL_NODRAW:
 		stype = PL_STREAM_FLAT;
 		break;
+	case PL_OVERDRAW:
+		stype = PL_STREAM_FLAT;
+		break;
 	case PL_TEXTURED_NOLIGHT:
 		if (tex == NULL) {
 			tex = poly->tex;
 		}
-		if (tex != NULL && tex->data) {
+		if (PL_TEX_VALID(tex)) {
 			stype = PL_STREAM_TEX;
 			break;
 		}
@@ -249,11 +342,16 @@ e_render_polygon(const struct PL_POLY *poly)
 	default:
 		return; /* bad raster mode */
 	}
+	PL_STAT_ADD(polys_submitted, 1);
+	PL_TRACE_BEGIN(PL_TRACE_POLY);
 
 	load_stream(copy, poly->verts, stype, nedge + 1, &minz, &maxz);
 	res = PL_frustum_test(minz, maxz);
 
 	if (res == PL_Z_OUTC_OUTSIDE) {
+		PL_STAT_ADD(polys_near_culled, 1);
+		PL_STAT_TIME(PL_STAGE_CALC, start_time);
+		PL_TRACE_END(PL_TRACE_POLY);
 		return;
 	}
 
@@ -261,43 +359,44 @@ e_render_polygon(const struct PL_POLY *poly)
 	back_face = PL_winding_order(copy, copy + stype, copy + stype * 2);
 
 	if ((back_face + 1) & PL_cull_mode) {
+		PL_STAT_ADD(polys_backface_culled, 1);
+		PL_STAT_TIME(PL_STAGE_CALC, start_time);
+		PL_TRACE_END(PL_TRACE_POLY);
 		return;
 	}
 
 	if (res == PL_Z_OUTC_PART_NZ) {
+		PL_STAT_ADD(polys_clipped, 1);
 		clipped = clip;
 		nedge = PL_clip_poly_nz(clipped, copy, stype, nedge);
 	} else {
 		clipped = copy;
 	}
 
+#ifdef PL_PIPELINE
+	/* project straight into the queue record, the fill thread takes it */
+	rec = PL_pipe_acquire();
+	proj = rec->stream;
+#endif
 	PL_psp_project(clipped, proj, stype, nedge + 1, PL_fov);
 
-#ifdef PERFORMANCE_MEASURE
-	end_time = timing_counter_get();
-	total_calculate_time_us += timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time)) / 1000;
-	start_time = timing_counter_get();
-#endif
+	PL_STAT_TIME(PL_STAGE_CALC, start_time);
+	PL_TRACE_END(PL_TRACE_POLY);
 
-	if (rmode == PL_TEXTURED) {
-		PL_lintx_poly(proj, nedge, tex->data);
-	} else if(rmode == PL_FLAT) {
-		PL_flat_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_FLAT_NOLIGHT) {
-		PL_flat_poly_nolight(proj, nedge, poly->color);
-	} else if (rmode == PL_EDGE_WIREFRAME) {
-		PL_edge_wireframe_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_WIREFRAME) {
-		PL_wireframe_poly(proj, nedge, poly->color);
-	} else if (rmode == PL_TEXTURED_NOLIGHT) {
-		PL_lintx_poly_nolight(proj, nedge, tex->data);
-	} else if (rmode == PL_NODRAW) {
-		PL_nodraw_poly(proj, nedge, poly->color);
+#ifdef PL_PIPELINE
+	rec->rmode = rmode;
+	rec->nedge = nedge;
+	rec->color = poly->color;
+	if (stype == PL_STREAM_TEX) {
+		tex_view(&rec->tex, tex);
+	}
+	PL_pipe_commit();
+#else
+	if (stype == PL_STREAM_TEX) {
+		tex_view(&view, tex);
 	}
-	#ifdef PERFORMANCE_MEASURE
-	end_time = timing_counter_get();
-	total_fill_time_us += timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time)) / 1000;
-	#endif
+	PL_fill_polygon(rmode, proj, nedge, poly->color, &view);
+#endif
 }
 
 extern int
@@ -331,19 +430,27 @@ PL_render_object(const struct PL_OBJ *obj)
 		EXT_error(PL_ERR_MISC, "objmgr", "too many object vertices!");
 	}
 
-	PL_mst_xf_modelview_vec(obj->verts, tmp_vertices, obj->n_verts);
-
 #ifdef PERFORMANCE_MEASURE
-	total_calculate_time_us = 0;
-	total_fill_time_us = 0;
+	uint32_t start_time = EXT_cycles();
 #endif
+	PL_TRACE_BEGIN(PL_TRACE_OBJECT);
+	PL_TRACE_BEGIN(PL_TRACE_TRANSFORM);
+	PL_mst_xf_modelview_vec(obj->verts, tmp_vertices, obj->n_verts);
+	PL_TRACE_END(PL_TRACE_TRANSFORM);
+	PL_STAT_TIME(PL_STAGE_TRANSFORM, start_time);
+	PL_STAT_ADD(objects, 1);
+
 	for (i = 0; i < obj->n_polys; i++) {
 		e_render_polygon(&obj->polys[i]);
 	}
-#ifdef PERFORMANCE_MEASURE
-	printf("total calculation time of render us: %u fps:%u\n", total_calculate_time_us, 1000000 / (total_calculate_time_us != 0 ? total_calculate_time_us : 1));
-	printf("total fill time of render us: %u fps:%u\n", total_fill_time_us, 1000000 / (total_fill_time_us != 0 ? total_fill_time_us : 1));
-#endif
+	PL_TRACE_END(PL_TRACE_OBJECT);
+}
+
+static int
+quantized(const struct PL_QUANT *q)
+{
+	return (q->scale[0] | q->scale[1] | q->scale[2] |
+			q->off[0] | q->off[1] | q->off[2]) != 0;
 }
 
 extern void
@@ -359,19 +466,36 @@ PL_render_object_const(const struct PL_OBJ_CONST *obj)
 		EXT_error(PL_ERR_MISC, "objmgr", "too many object vertices!");
 	}
 
-	PL_mst_xf_modelview_vec(obj->verts, tmp_vertices, obj->n_verts);
-
 #ifdef PERFORMANCE_MEASURE
-	total_calculate_time_us = 0;
-	total_fill_time_us = 0;
+	uint32_t start_time = EXT_cycles();
 #endif
-	for (i = 0; i < obj->n_polys; i++) {
-		e_render_polygon_const(&obj->polys[i]);
+	PL_TRACE_BEGIN(PL_TRACE_OBJECT);
+	PL_TRACE_BEGIN(PL_TRACE_TRANSFORM);
+	if (obj->verts8) {
+		PL_mst_xf_modelview_q8(obj->verts8, tmp_vertices, obj->n_verts,
+							   &obj->quant);
+	} else if (obj->verts16 && quantized(&obj->quant)) {
+		PL_mst_xf_modelview_q16(obj->verts16, tmp_vertices, obj->n_verts,
+								&obj->quant);
+	} else if (obj->verts16) {
+		PL_mst_xf_modelview_vec16(obj->verts16, tmp_vertices, obj->n_verts);
+	} else {
+		PL_mst_xf_modelview_vec(obj->verts, tmp_vertices, obj->n_verts);
 	}
-#ifdef PERFORMANCE_MEASURE
-	printf("total calculation time of render us: %u fps:%u\n", total_calculate_time_us, 1000000 / (total_calculate_time_us != 0 ? total_calculate_time_us : 1));
-	printf("total fill time of render us: %u fps:%u\n", total_fill_time_us, 1000000 / (total_fill_time_us != 0 ? total_fill_time_us : 1));
-#endif
+	PL_TRACE_END(PL_TRACE_TRANSFORM);
+	PL_STAT_TIME(PL_STAGE_TRANSFORM, start_time);
+	PL_STAT_ADD(objects, 1);
+
+	if (obj->polys) {
+		for (i = 0; i < obj->n_polys; i++) {
+			e_render_polygon_const(&obj->polys[i]);
+		}
+	} else {
+		for (i = 0; i < obj->n_polys; i++) {
+			e_render_polygon_pack(&obj->pack_polys[i], obj->pack_tex);
+		}
+	}
+	PL_TRACE_END(PL_TRACE_OBJECT);
 }
 
 extern void
@@ -54,6 +54,10 @@ extern int PL_vp_max_y;
 extern int PL_vp_cen_x;
 extern int PL_vp_cen_y;
 
+#define PL_VP_SCALE_ONE 256
+/* projection scale in 1/256, PL_VP_SCALE_ONE draws at full resolution */
+extern int PL_vp_scale;
+
 /* define viewport
 *
 * update_center - updates what the engine considers to be the perspective
@@ -63,6 +67,16 @@ extern int PL_vp_cen_y;
 extern void PL_set_viewport(int minx, int miny, int maxx, int maxy,
 							int update_center);
 
+/* render a scale/256 sized image into the top left of the buffers
+*
+* Sets the viewport to the scaled rectangle and shrinks the projection
+* with it (PL_DYNRES builds only), so the image keeps its framing at any
+* render size.
+* scale is clamped to 1..PL_VP_SCALE_ONE.
+*
+*/
+extern void PL_set_render_scale(int scale);
+
 /* clip lines and polygons to 2D viewport */
 extern int PL_clip_line_x(int **v0, int **v1, int len, int min, int max);
 extern int PL_clip_line_y(int **v0, int **v1, int len, int min, int max);
@@ -82,7 +96,11 @@ extern int PL_clip_poly_nz(int *dst, int *src, int len, int num);
 
 /* maximum number of vertices in object */
 #define PL_MAX_OBJ_V PL_MAX_VERTICES_PER_OBJECT
+/* maximum number of polygons in an imported object */
+#define PL_MAX_OBJ_P PL_MAX_POLYS_PER_OBJECT
 
+/* count fragments per pixel, see PL_overdraw_resolve */
+#define PL_OVERDRAW             7
 /* only draw zbuff */
 #define PL_WIREFRAME            6
 #define PL_NODRAW               5
@@ -103,9 +121,29 @@ extern int PL_clip_poly_nz(int *dst, int *src, int len, int num);
 #ifdef PL_REDUCED_DEPTH_PRECISION
 #define ZBUF_TYPE int16_t
 #define ZBUF_SHIFT 16
+#define ZBUF_BITS 16
+#define ZBUF_MIN INT16_MIN
 #else
 #define ZBUF_TYPE int
 #define ZBUF_SHIFT 0
+#define ZBUF_BITS 32
+#define ZBUF_MIN INT32_MIN
+#endif
+
+/* texels are stored in the video buffer format, PL_TEXEL_GREY(g) makes
+ * one from an 8-bit grey level */
+#if defined(PL_COLOR_DEPTH_32)
+typedef int PL_TEXEL; /* X8R8G8B8 */
+#define PL_TEXEL_BITS 32
+#define PL_TEXEL_GREY(g) ((g) << 16 | (g) << 8 | (g))
+#elif defined(PL_COLOR_DEPTH_16)
+typedef uint16_t PL_TEXEL; /* R5G6B5 */
+#define PL_TEXEL_BITS 16
+#define PL_TEXEL_GREY(g) (((g) >> 3) << 11 | ((g) >> 2) << 5 | ((g) >> 3))
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
+typedef uint8_t PL_TEXEL; /* L8, PL_COLOR_DEPTH_4 keeps the top 4 bits */
+#define PL_TEXEL_BITS 8
+#define PL_TEXEL_GREY(g) (g)
 #endif
 
 extern int PL_fov; /* min valid value = 8 */
@@ -113,11 +151,6 @@ extern struct PL_TEX *PL_cur_tex;
 extern int PL_raster_mode; /* PL_FLAT or PL_TEXTURED */
 extern int PL_cull_mode;
 
-typedef struct PL_viewtransform {
-	int tx, ty, tz;
-	unsigned int rx, ry, rz;
-} PL_viewtransform;
-
 struct PL_POLY_CONST {
 	const struct PL_TEX_CONST *tex;
 
@@ -140,11 +173,29 @@ struct PL_POLY {
 	int n_verts;
 };
 
+struct PL_PACK_POLY;
+
+/* Quantized vertices stand for off + v * scale per axis, scale in PL_P
+ * fixed point. Both are folded into the transform matrix, the vertices
+ * are never expanded. A zero scale is PL_P_ONE, all zero is unquantized. */
+struct PL_QUANT {
+	int scale[3];
+	int off[3];
+};
+
+#define PL_QUANT_SCALE(q, i) ((q)->scale[i] ? (q)->scale[i] : PL_P_ONE)
+
 struct PL_OBJ_CONST {
 	const struct PL_POLY_CONST *polys; /* list of polygons in the object */
 	const int *verts;            /* array of [x, y, z, 0] values */
+	const int16_t *verts16;      /* or [x, y, z, 0] int16 values if not NULL */
+	const int8_t *verts8;        /* or [x, y, z] int8 values if not NULL */
+	struct PL_QUANT quant;       /* of verts16 / verts8 */
 	int n_polys;
 	int n_verts;
+	/* asset pack polygons if polys is NULL, their tex indexes pack_tex */
+	const struct PL_PACK_POLY *pack_polys;
+	const struct PL_TEX_CONST *pack_tex;
 };
 
 struct PL_OBJ {
@@ -162,6 +213,10 @@ extern void PL_render_object_const(const struct PL_OBJ_CONST *obj);
 extern void PL_delete_object(struct PL_OBJ *obj);
 extern void PL_copy_object(struct PL_OBJ *dst, const struct PL_OBJ *src);
 
+/* fill an already projected polygon with the kernel matching rmode */
+extern void PL_fill_polygon(int rmode, int *proj, int nedge, int color,
+							const struct PL_TEX_CONST *tex);
+
 /*****************************************************************************/
 /*********************************** IMODE ***********************************/
 /*****************************************************************************/
@@ -199,7 +254,7 @@ extern struct PL_OBJ *PL_get_working_copy(void);
 /********************************* GRAPHICS **********************************/
 /*****************************************************************************/
 
-/* textures must be square with a dimension of (1 << PL_REQ_TEX_LOG_DIM) */
+/* size of textures that leave their lw/lh at 0 */
 #define PL_REQ_TEX_LOG_DIM PL_TEXTURE_SIZE_SHIFT
 #define PL_REQ_TEX_DIM     (1 << PL_REQ_TEX_LOG_DIM)
 
@@ -223,6 +278,10 @@ extern int *PL_video_buffer;
 extern uint16_t *PL_video_buffer;
 #elif defined(PL_COLOR_DEPTH_8)
 extern uint8_t *PL_video_buffer;
+#elif defined(PL_COLOR_DEPTH_4)
+/* hres * vres / 2 bytes, two pixels per byte, the left one in the high
+ * nibble. Colors and textures are 8-bit grey, written as their top bits. */
+extern uint8_t *PL_video_buffer;
 #endif
 
 #ifdef PL_REDUCED_DEPTH_PRECISION
@@ -233,7 +292,7 @@ PL_init(int *video, int16_t *depth, int hres, int vres);
 #elif defined(PL_COLOR_DEPTH_16)
 extern void
 PL_init(uint16_t *video, int16_t *depth, int hres, int vres);
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 extern void
 PL_init(uint8_t *video, int16_t *depth, int hres, int vres);
 #endif
@@ -245,30 +304,104 @@ PL_init(int *video, int *depth, int hres, int vres);
 #elif defined(PL_COLOR_DEPTH_16)
 extern void
 PL_init(uint16_t *video, int *depth, int hres, int vres);
-#elif defined(PL_COLOR_DEPTH_8)
+#elif defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
 extern void
 PL_init(uint8_t *video, int *depth, int hres, int vres);
 #endif
 #endif
 
-/* only square textures with dimensions of PL_REQ_TEX_DIM */
+/* texture formats */
+#define PL_TEX_DIRECT 0 /* data holds a PL_TEXEL per pixel */
+#define PL_TEX_I4     1 /* idx holds 4-bit palette indices, 2 per byte */
+#define PL_TEX_I2     2 /* idx holds 2-bit palette indices, 4 per byte */
+
+/* texel orders */
+#define PL_TEX_LINEAR 0 /* row by row */
+#define PL_TEX_MORTON 1 /* Z-order, u in the even index bits, v in the odd */
+
+/* (1 << lw) x (1 << lh) textures, 0 takes PL_REQ_TEX_LOG_DIM, up to 256.
+ * Indices are packed in texel order, the first pixel in the low bits.
+ * Mip levels follow level 0 in data/idx, each half the size of the one
+ * before, and the kernels pick one per span.
+ * A texture in an atlas shares data/idx (and pal) with others: it is the
+ * rectangle at (ax, ay) of a (1 << alw) x (1 << alh) texel array, whose
+ * mip levels hold the texture's at (ax >> l, ay >> l). ax and ay are
+ * multiples of the texture's size. Coordinates wrap within the rectangle.
+ * Every level of an indexed texture starts on a byte.
+ * PL_TEX_MORTON textures and atlases are square. */
 struct PL_TEX {
-	int *data; /* 4 byte-per-pixel true color X8R8G8B8 color data */
+	PL_TEXEL *data;
+	int fmt;
+	uint8_t *idx;
+	PL_TEXEL *pal; /* 16 entries for PL_TEX_I4, 4 for PL_TEX_I2 */
+	int layout;
+	int levels; /* mip levels stored, 0 or 1 without mipmaps */
+	int lw, lh; /* log2 width and height */
+	int ax, ay; /* position in the atlas */
+	int alw, alh; /* log2 atlas size, 0 if data/idx only hold this texture */
 };
 
 struct PL_TEX_CONST {
-	const int *data; /* 4 byte-per-pixel true color X8R8G8B8 color data */
+	const PL_TEXEL *data;
+	int fmt;
+	const uint8_t *idx;
+	const PL_TEXEL *pal;
+	int layout;
+	int levels;
+	int lw, lh;
+	int ax, ay;
+	int alw, alh;
 };
 
+/* sizes of either texture struct with the defaults applied */
+#define PL_TEX_LW(t)  ((t)->lw ? (t)->lw : PL_REQ_TEX_LOG_DIM)
+#define PL_TEX_LH(t)  ((t)->lh ? (t)->lh : PL_REQ_TEX_LOG_DIM)
+#define PL_TEX_ALW(t) ((t)->alw ? (t)->alw : PL_TEX_LW(t))
+#define PL_TEX_ALH(t) ((t)->alh ? (t)->alh : PL_TEX_LH(t))
+
+/* position of texel (u, v) of a mip level of tex in data, or in idx
+ * counting indices. The level starts at PL_tex_mip_offset(tex, level). */
+extern int PL_tex_index(const struct PL_TEX *tex, int level, int u, int v);
+extern int PL_tex_mip_offset(const struct PL_TEX *tex, int level);
+
+/* texture has something to sample */
+#define PL_TEX_VALID(t) \
+	((t) != NULL && ((t)->fmt ? (t)->idx != NULL : (t)->data != NULL))
+
 
 /* clear viewport color and depth */
 extern void PL_clear_vp(int r, int g, int b);
 #if defined(PL_COLOR_DEPTH_32)
 extern void PL_clear_color_vp(int r, int g, int b); /* clear viewport color */
-#elif defined(PL_COLOR_DEPTH_16)
+#else
 extern void PL_clear_color_vp(uint8_t r, uint8_t g, uint8_t b);
 #endif
 extern void PL_clear_depth_vp(void);                /* clear viewport depth */
+/* Starts a frame's depth, PL_clear_vp without the color clear for scenes
+ * that cover the whole viewport. Clears the viewport's depth, with
+ * PL_ZBANDS it moves on to the next band and clears the whole buffer only
+ * once they are used up. */
+extern void PL_depth_frame(void);
+/* depth at a pixel as PL_depth_buffer holds it without PL_ZBANDS,
+ * 0 for anything not drawn this frame */
+extern int PL_depth_at(int x, int y);
+
+/* pixel rectangle, inclusive, empty when x1 < x0 */
+struct PL_RECT {
+	int x0, y0, x1, y1;
+};
+#define PL_RECT_EMPTY(r) ((r)->x1 < (r)->x0)
+
+extern void PL_rect_union(struct PL_RECT *dst, const struct PL_RECT *src);
+/* clear color and depth inside rc, clipped to the viewport. With
+ * PL_ZBANDS it starts the next band of the whole viewport instead. */
+extern void PL_clear_rect(const struct PL_RECT *rc, int r, int g, int b);
+
+/* With PL_DAMAGE the kernels keep the bounds of what they rasterize,
+ * PL_damage_get returns them since the last reset (the whole viewport
+ * without PL_DAMAGE). */
+extern void PL_damage_reset(void);
+extern void PL_damage_get(struct PL_RECT *r);
 
 /* Solid color polygon fill.
 * Expecting input stream of 3 values [X,Y,Z] */
@@ -290,24 +423,138 @@ extern void PL_edge_wireframe_poly(int *stream, int len, int rgb);
  * Expecting input stream of 3 values [X,Y,Z] */
 extern void PL_wireframe_poly(int *stream, int len, int rgb);
 
+/* Per pixel fragment counter, increments the video buffer instead of
+ * writing color. Expecting input stream of 3 values [X,Y,Z] */
+extern void PL_overdraw_poly(int *stream, int len, int rgb);
+
 /* Affine (linear) texture mapped polygon fill.
 * Expecting input stream of 5 values [X,Y,Z,U,V] */
-extern void PL_lintx_poly(int *stream, int len, const int *texel);
+extern void PL_lintx_poly(int *stream, int len,
+						  const struct PL_TEX_CONST *tex);
 
 /* Affine (linear) texture mapped polygon fill. No depth light
  * Expecting input stream of 5 values [X,Y,Z,U,V] */
-extern void PL_lintx_poly_nolight(int *stream, int len, const int *texel);
+extern void PL_lintx_poly_nolight(int *stream, int len,
+								  const struct PL_TEX_CONST *tex);
+
+/* Same for PL_TEX_I4 / PL_TEX_I2 textures, indices are decoded per texel */
+extern void PL_lintx_idx_poly(int *stream, int len,
+							  const struct PL_TEX_CONST *tex);
+extern void PL_lintx_idx_poly_nolight(int *stream, int len,
+									  const struct PL_TEX_CONST *tex);
+
+/* depth complexity of a frame rendered in PL_OVERDRAW mode */
+struct PL_OVERDRAW_SUMMARY {
+	uint32_t pixels;    /* pixels in the viewport */
+	uint32_t covered;   /* pixels touched at least once */
+	uint32_t overdrawn; /* pixels touched more than once */
+	uint32_t fragments; /* sum of all counters */
+	uint32_t max;       /* highest counter */
+	uint32_t mean_q8;   /* fragments per viewport pixel, 8 bit fraction */
+};
+
+/* Clear the viewport to black before rendering in PL_OVERDRAW mode.
+ * Turns the counters into a grey scale heat map of PL_OVERDRAW_SCALE
+ * levels per layer and fills in the summary if out is not NULL. */
+extern void PL_overdraw_resolve(struct PL_OVERDRAW_SUMMARY *out);
 
 /*****************************************************************************/
-/*********************************** MATH ************************************/
+/*********************************** STATS ***********************************/
+/*****************************************************************************/
+
+/* stages timed in PL_STATS.cycles */
+#define PL_STAGE_CLEAR     0 /* PL_clear_vp and friends */
+#define PL_STAGE_TRANSFORM 1 /* object vertices by the modelview */
+#define PL_STAGE_CALC      2 /* per polygon cull, clip and project */
+#define PL_STAGE_FILL      3 /* scan conversion and span kernels */
+#define PL_STAGE_COUNT     4
+
+/* per frame render counters, only updated with PERFORMANCE_MEASURE */
+struct PL_STATS {
+	uint32_t objects;               /* objects rendered */
+	uint32_t polys_submitted;       /* polygons handed to the engine */
+	uint32_t polys_near_culled;     /* completely behind the near plane */
+	uint32_t polys_backface_culled; /* rejected by PL_cull_mode */
+	uint32_t polys_clipped;         /* clipped against the near plane */
+	uint32_t polys_rasterized;      /* reached a fill kernel */
+	uint32_t spans;                 /* scanlines filled */
+	uint32_t pixels_tested;         /* depth tests performed */
+	uint32_t pixels_written;        /* depth tests passed */
+	uint32_t z_fails;               /* filled in by PL_stats_get */
+	uint32_t world_skipped;         /* past PL_WORLD_RANGE, not drawn */
+	uint32_t cycles[PL_STAGE_COUNT]; /* EXT_cycles spent per stage */
+};
+
+extern struct PL_STATS PL_stats;
+
+/* zero the counters, call once per frame (after PL_pipe_flush) */
+extern void PL_stats_reset(void);
+/* copy the counters accumulated since the last reset */
+extern void PL_stats_get(struct PL_STATS *out);
+
+#ifdef PERFORMANCE_MEASURE
+#define PL_STAT_ADD(field, n) (PL_stats.field += (n))
+#define PL_STAT_TIME(stage, start)                                             \
+	(PL_stats.cycles[(stage)] += EXT_cycles() - (start))
+#else
+#define PL_STAT_ADD(field, n)      ((void)0)
+#define PL_STAT_TIME(stage, start) ((void)0)
+#endif
+
 /*****************************************************************************/
+/*********************************** TRACE ***********************************/
+/*****************************************************************************/
+
+/* begin/end events for a timeline viewer, only emitted with PL_TRACING */
+#define PL_TRACE_FRAME     0 /* application frame */
+#define PL_TRACE_OBJECT    1 /* PL_render_object(_const) */
+#define PL_TRACE_TRANSFORM 2 /* object vertices by the modelview */
+#define PL_TRACE_POLY      3 /* cull, clip and project of one polygon */
+#define PL_TRACE_FILL      4 /* span kernels of one polygon */
+#define PL_TRACE_POST      5 /* framebuffer effects */
+#define PL_TRACE_DISPLAY   6 /* sending the frame to the display */
+#define PL_TRACE_COUNT     7
+
+#ifdef PL_TRACING
+#define PL_TRACE_BEGIN(ev) EXT_trace((ev), 1)
+#define PL_TRACE_END(ev)   EXT_trace((ev), 0)
+#else
+#define PL_TRACE_BEGIN(ev) ((void)0)
+#define PL_TRACE_END(ev)   ((void)0)
+#endif
+
+/*****************************************************************************/
+/********************************* PIPELINE **********************************/
+/*****************************************************************************/
+
+/* a projected and clipped polygon waiting to be filled */
+struct PL_PIPE_POLY {
+	int rmode;
+	int nedge;
+	int color;
+	struct PL_TEX_CONST tex; /* texture if the stream is textured */
+	int stream[PL_MAX_POLY_VERTS * PL_VDIM];
+};
 
-/* maximum matrix stack depth */
-#define PL_MAX_MST_DEPTH 64
+/* with PL_PIPELINE, polygons are queued here and filled by another thread */
+extern struct PL_PIPE_POLY *PL_pipe_acquire(void); /* get next free record */
+extern void PL_pipe_commit(void); /* hand acquired record to fill thread */
+/* wait until every queued polygon is filled, call before using the buffers */
+extern void PL_pipe_flush(void);
 
-/* number of elements in PL_sin and PL_cos */
-#define PL_TRIGMAX 256
+/*****************************************************************************/
+/*********************************** MATH ************************************/
+/*****************************************************************************/
+
+/* angle units in a full turn */
+#define PL_TRIGMAX (1 << PL_TRIG_BITS)
 #define PL_TRIGMSK (PL_TRIGMAX - 1)
+/* angle given in 256ths of a turn, independent of PL_TRIG_BITS */
+#define PL_A256(a) ((a) * (PL_TRIGMAX / 256))
+
+#if (PL_TRIG_TABLE_BITS > PL_TRIG_BITS) || (PL_TRIG_BITS < 8)
+#error "need 8 <= PL_TRIG_TABLE_BITS <= PL_TRIG_BITS"
+#endif
 
 /* number of elements in a vector */
 #define PL_VLEN 4
@@ -327,8 +574,47 @@ extern void PL_lintx_poly_nolight(int *stream, int len, const int *texel);
 #define PL_VEC3_ELEMS(x) x[0], x[1], x[2]
 #define PL_VEC4_ELEMS(x) x[0], x[1], x[2], x[3]
 
-extern int PL_sin[PL_TRIGMAX];
-extern int PL_cos[PL_TRIGMAX];
+/* first quarter of a sine wave, 0..32768 over 0..PL_TRIGMAX / 4 */
+extern const uint16_t PL_sin_q[];
+
+#define PL_TRIG_QUARTER (1 << (PL_TRIG_TABLE_BITS - 2))
+#define PL_TRIG_FRAC    (PL_TRIG_BITS - PL_TRIG_TABLE_BITS)
+
+/* sin(a * 2pi / PL_TRIGMAX) in PL_P fixed point, any int angle */
+static inline int
+PL_sin(int a)
+{
+	int i, q, v;
+
+	i = (a & PL_TRIGMSK) >> PL_TRIG_FRAC;
+	q = i >> (PL_TRIG_TABLE_BITS - 2);
+	i &= PL_TRIG_QUARTER - 1;
+#if defined(PL_TRIG_LERP) && (PL_TRIG_FRAC > 0)
+	{
+		int f, n;
+
+		f = a & ((1 << PL_TRIG_FRAC) - 1);
+		if (q & 1) {
+			/* falling quarter, step from entry Q - i toward Q - i - 1 */
+			v = PL_sin_q[PL_TRIG_QUARTER - i];
+			n = PL_sin_q[PL_TRIG_QUARTER - i - 1];
+		} else {
+			v = PL_sin_q[i];
+			n = PL_sin_q[i + 1];
+		}
+		v += ((n - v) * f) >> PL_TRIG_FRAC;
+	}
+#else
+	v = PL_sin_q[(q & 1) ? (PL_TRIG_QUARTER - i) : i];
+#endif
+	return (q & 2) ? -v : v;
+}
+
+static inline int
+PL_cos(int a)
+{
+	return PL_sin(a + (PL_TRIGMAX >> 2));
+}
 
 /* vectors are assumed to be integer arrays of length PL_VLEN */
 /* matrices are assumed to be integer arrays of length 16 */
@@ -336,6 +622,13 @@ extern int PL_cos[PL_TRIGMAX];
 extern int PL_winding_order(int *a, int *b, int *c);
 extern void PL_vec_shorten(int *v); /* shorten vector to fit in 15 bits */
 extern void PL_psp_project(int *src, int *dst, int len, int num, int fov);
+#ifdef PL_RECIP_PROJECT
+/* (1 << lg) / z for z > 0 without dividing, accuracy set by
+ * PL_RECIP_LUT_BITS and PL_RECIP_NEWTON, result is never above the
+ * exact quotient and saturates at INT32_MAX */
+extern int PL_recip(int lg, int z);
+extern void PL_recip_init(void); /* called by PL_init */
+#endif
 
 /* matrix stack (mst) */
 extern void PL_mst_get(int *m);    /* get current top of mst */
@@ -349,10 +642,51 @@ extern void PL_mst_translate(int x, int y, int z);
 extern void PL_mst_rotatex(int rx);
 extern void PL_mst_rotatey(int ry);
 extern void PL_mst_rotatez(int rz);
+
+/* camera, the view matrix maps world space to camera space where +x is
+ * right, +y is up and +z looks into the screen */
+extern void PL_set_view(int *m); /* load a world to camera matrix */
+extern void PL_get_view(int *m);
+/* Place the camera with a camera to world matrix, rotation must be
+ * orthonormal (e.g. built with the mst functions and PL_mst_get).
+ * The camera looks down its +z with +y up. The world is right handed,
+ * so the camera's +x shows up on the left of the screen. */
+extern void PL_set_camera_matrix(int *m);
+/* camera at eye looking at 'at', up does not need to be perpendicular */
+extern void PL_look_at(int *eye, int *at, int *up);
+/* Euler angle camera, yaw then pitch then roll.
+ * rz = 0 maps world x to camera y, rotate the model by 64 to undo that */
 extern void PL_set_camera(int x, int y, int z, int rx, int ry, int rz);
 
-/* transform a stream of vertices by the current model+view */
+/* world space for large streamed worlds, positions are 64-bit.
+ * Each frame the camera position becomes the origin and objects are placed
+ * relative to it, so the 32-bit transforms only see nearby offsets. */
+extern void PL_world_origin(const int64_t *o); /* set the rebasing origin */
+extern void PL_world_get_origin(int64_t *o);
+/* pos - origin clamped to +-PL_WORLD_RANGE, returns 0 if it was clamped */
+extern int PL_world_rel(const int64_t *pos, int *out);
+/* PL_mst_translate to a world position, returns 0 and leaves the mst
+ * untouched if it is out of range (too far from the camera to draw).
+ * The range assumes an unscaled mst, skipped objects are counted. */
+extern int PL_mst_translate_world(const int64_t *pos);
+/* PL_set_camera / PL_look_at at a world position, this also rebases */
+extern void PL_world_camera(const int64_t *pos, int rx, int ry, int rz);
+extern void PL_world_look_at(const int64_t *eye, const int64_t *at, int *up);
+
+/* transform a stream of vertices by the current model+view,
+ * both are fused into one 3x4 matrix per call */
 extern void PL_mst_xf_modelview_vec(const int *v, int *out, int len);
+/* same for [x, y, z, 0] int16 vertices, batched and using SIMD with PL_SIMD.
+ * The whole int16 range is accepted: the 16-bit kernel is only used while
+ * the Q14 coefficients (scale below 2) can't overflow its int32 sums and
+ * the result plus translation fits an int, else a 64-bit path runs */
+extern void PL_mst_xf_modelview_vec16(const int16_t *v, int *out, int len);
+/* quantized int16 [x, y, z, 0] / int8 [x, y, z] vertices, the scale and
+ * offset of q are folded into the fused matrix */
+extern void PL_mst_xf_modelview_q16(const int16_t *v, int *out, int len,
+									const struct PL_QUANT *q);
+extern void PL_mst_xf_modelview_q8(const int8_t *v, int *out, int len,
+								   const struct PL_QUANT *q);
 
 /* result is stored in 'a' */
 extern void PL_mat_mul(int *a, int *b);
@@ -383,7 +717,90 @@ extern struct PL_OBJ *PL_gen_box(int w, int h, int d, int side_flags, int r,
 /********************************* IMPORTER **********************************/
 /*****************************************************************************/
 
-extern int import_dmdl(char *name, struct PL_OBJ **o); /* import DMDL object */
+/* Both return 1 and the object in *o, or 0 with *o NULL after EXT_error
+ * if the file is missing or malformed. Free with PL_delete_object and
+ * EXT_free. */
+extern int import_dmdl(char *name, struct PL_OBJ **o); /* import name.dmdl */
+/* import name.bdmdl, the binary form written by tools/dmdl2bin.py */
+extern int import_dmdl_bin(char *name, struct PL_OBJ **o);
+
+/*****************************************************************************/
+/******************************** ASSET PACK *********************************/
+/*****************************************************************************/
+
+/* A pack is one little-endian image of meshes and textures in the layouts
+ * the renderer reads, rendered in place from wherever it is mapped (a host
+ * file, flash). Offsets count from the start of the image, which is
+ * PL_PACK_ALIGN aligned, as is every table and array in it.
+ * tools/obj2ctexture.py --pack writes them, tools/h2pack.py from its headers. */
+
+#define PL_PACK_VERSION 2 /* 2: quantized vertices, PL_PACK_MESH.quant */
+#define PL_PACK_ALIGN   8
+#define PL_PACK_NO_TEX  0xffff
+#define PL_PACK_VERTS16 1 /* mesh flag, vertices are int16 [x, y, z, 0] */
+#define PL_PACK_VERTS8  2 /* mesh flag, vertices are int8 [x, y, z] */
+
+struct PL_PACK_HEADER {
+	char magic[4]; /* "PLPK" */
+	uint16_t version;
+	uint16_t texel_bits; /* PL_TEXEL_BITS of the texels and palettes */
+	uint32_t size;       /* of the whole image */
+	uint32_t n_meshes;
+	uint32_t mesh_off;   /* struct PL_PACK_MESH[n_meshes] */
+	uint32_t n_textures;
+	uint32_t tex_off;    /* struct PL_PACK_TEX[n_textures] */
+	uint32_t reserved;
+};
+
+struct PL_PACK_MESH {
+	char name[16];
+	uint32_t flags;
+	uint32_t n_verts;
+	uint32_t verts_off; /* int, int16_t or int8_t vertices, see flags */
+	uint32_t n_polys;
+	uint32_t polys_off; /* struct PL_PACK_POLY[n_polys] */
+	int bounds[6];      /* model space min x, y, z and max x, y, z */
+	struct PL_QUANT quant; /* of int16_t / int8_t vertices */
+	uint32_t reserved;
+};
+
+/* PL_POLY_CONST with the texture as an index, int is 32 bits everywhere */
+struct PL_PACK_POLY {
+	int verts[6 * PL_POLY_VLEN];
+	int color;
+	uint16_t n_verts;
+	uint16_t tex; /* PL_PACK_NO_TEX if untextured */
+};
+
+struct PL_PACK_TEX {
+	char name[16];
+	uint8_t fmt, layout, levels, reserved;
+	uint8_t lw, lh, alw, alh; /* as in PL_TEX, never 0 */
+	uint16_t ax, ay;
+	uint32_t data_off; /* texels, or indices for PL_TEX_I4 / PL_TEX_I2 */
+	uint32_t data_size;
+	uint32_t pal_off;  /* palette of indexed textures */
+};
+
+struct PL_PACK {
+	const struct PL_PACK_HEADER *hdr;
+	const struct PL_PACK_MESH *mesh_ents;
+	const struct PL_PACK_TEX *tex_ents;
+	struct PL_OBJ_CONST *meshes;  /* render descriptors, EXT_calloc'd */
+	struct PL_TEX_CONST *textures;
+};
+
+/* Checks the header and the tables against size and sets up the mesh and
+ * texture descriptors, nothing in the image is copied. Returns 0 and calls
+ * EXT_error if the image is not a pack this build can render. */
+extern int PL_pack_open(struct PL_PACK *pack, const void *image, uint32_t size);
+/* every polygon's vertex and texture indices, for packs from untrusted
+ * storage. Returns 0 and calls EXT_error if one is out of range. */
+extern int PL_pack_verify(const struct PL_PACK *pack);
+extern void PL_pack_close(struct PL_PACK *pack);
+/* index of the named mesh or texture, -1 if there is none */
+extern int PL_pack_find_mesh(const struct PL_PACK *pack, const char *name);
+extern int PL_pack_find_texture(const struct PL_PACK *pack, const char *name);
 
 /*****************************************************************************/
 /******************************* USER DEFINED ********************************/
@@ -399,6 +816,13 @@ extern void *EXT_calloc(unsigned, unsigned);
 /* memory freeing function */
 extern void EXT_free(void *);
 
+/* free running cycle counter, differences are taken modulo 2^32 */
+extern uint32_t EXT_cycles(void);
+/* convert a cycle count difference to nanoseconds */
+extern uint64_t EXT_cycles_to_ns(uint32_t cycles);
+/* timeline event, begin is 1 when event starts and 0 when it ends */
+extern void EXT_trace(int event, int begin);
+
 KC_END_C_HEADER
 
 #endif
@@ -0,0 +1,47 @@
+/*  assets.c
+*
+* Finds the app's asset pack (tools/obj2ctexture.py --pack) and opens it
+* where it is, meshes and texels are never copied to RAM.
+* On native_sim the file given as APP_PACK is mapped read only through
+* assets_bottom.c. On hardware the pack is written to the pack_partition
+* fixed partition and read from memory mapped (XIP) flash.
+*
+*/
+
+#include "assets.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/storage/flash_map.h>
+
+#ifdef CONFIG_ARCH_POSIX
+/* assets_bottom.c, built with the host's libc */
+extern int assets_map_bottom(const char *path, const void **image,
+							 uint32_t *size);
+#endif
+
+extern int
+assets_open(struct PL_PACK *pack)
+{
+	const void *image;
+	uint32_t size;
+
+#if defined(CONFIG_ARCH_POSIX)
+	if (!assets_map_bottom(APP_PACK_PATH, &image, &size)) {
+		EXT_error(PL_ERR_MISC, "assets", "cannot map " APP_PACK_PATH);
+		return 0;
+	}
+	/* a file from the host may be anything, check every index too */
+	return PL_pack_open(pack, image, size) && PL_pack_verify(pack);
+#elif defined(CONFIG_XIP) && FIXED_PARTITION_EXISTS(pack_partition)
+	image = (const void *)(DT_REG_ADDR(DT_CHOSEN(zephyr_flash)) +
+						   FIXED_PARTITION_OFFSET(pack_partition));
+	size = FIXED_PARTITION_SIZE(pack_partition);
+	return PL_pack_open(pack, image, size);
+#else
+	ARG_UNUSED(image);
+	ARG_UNUSED(size);
+	ARG_UNUSED(pack);
+	return 0;
+#endif
+}
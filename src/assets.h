@@ -0,0 +1,9 @@
+#pragma once
+
+/* Asset pack of the app, see assets.c */
+
+#include "pl.h"
+
+/* opens the app's asset pack in place, returns 1 on success, 0 if there is
+ * none or it does not check out */
+extern int assets_open(struct PL_PACK *pack);
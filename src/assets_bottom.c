@@ -0,0 +1,38 @@
+/*  assets_bottom.c
+*
+* native_sim side of assets.c, maps the pack file with the host's libc.
+* The mapping stays for the life of the process.
+*
+*/
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int
+assets_map_bottom(const char *path, const void **image, uint32_t *size)
+{
+	struct stat st;
+	void *p;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return 0;
+	}
+	if (fstat(fd, &st) != 0 || st.st_size == 0 || st.st_size > UINT32_MAX) {
+		close(fd);
+		return 0;
+	}
+	/* page aligned, which covers PL_PACK_ALIGN */
+	p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		return 0;
+	}
+	*image = p;
+	*size = (uint32_t)st.st_size;
+	return 1;
+}
@@ -0,0 +1,132 @@
+/*  damage.c
+*
+* Damage tracking for partial display updates.
+* A pixel can only change where this frame drew or where the previous
+* frame drew (and damage_clear erased it), so the union of the two
+* rasterized bounds is all that needs clearing and sending. With
+* DAMAGE_ROW_HASH, rows at the top and bottom of that area whose
+* contents hash the same as last frame are dropped as well.
+*
+*/
+
+#include "damage.h"
+
+#include <string.h>
+
+#if defined(PL_COLOR_DEPTH_32)
+#define ROW_BYTES (PL_SIZE_W * 4)
+#elif defined(PL_COLOR_DEPTH_16)
+#define ROW_BYTES (PL_SIZE_W * 2)
+#elif defined(PL_COLOR_DEPTH_8)
+#define ROW_BYTES PL_SIZE_W
+#elif defined(PL_COLOR_DEPTH_4)
+#define ROW_BYTES (PL_SIZE_W / 2)
+#endif
+
+/* what the previous frame drew, the whole screen until the first frame */
+static struct PL_RECT drawn = { 0, 0, PL_SIZE_W - 1, PL_SIZE_H - 1 };
+
+#if DAMAGE_ROW_HASH
+static uint32_t row_hash[PL_SIZE_H];
+
+/* FNV-1a */
+static uint32_t
+hash_row(int y)
+{
+	const uint8_t *p = (const uint8_t *)PL_video_buffer + y * ROW_BYTES;
+	uint32_t h = 2166136261u;
+	int i;
+
+	for (i = 0; i < ROW_BYTES; i++) {
+		h = (h ^ p[i]) * 16777619u;
+	}
+	return h;
+}
+#endif
+
+extern void
+damage_clear(int r, int g, int b)
+{
+	PL_clear_rect(&drawn, r, g, b);
+	PL_damage_reset();
+}
+
+extern int
+damage_collect(struct PL_RECT *dirty)
+{
+	struct PL_RECT cur;
+
+	PL_damage_get(&cur);
+	*dirty = cur;
+	PL_rect_union(dirty, &drawn);
+	drawn = cur;
+	if (PL_RECT_EMPTY(dirty)) {
+		return 0;
+	}
+	if (dirty->x0 < 0) {
+		dirty->x0 = 0;
+	}
+	if (dirty->y0 < 0) {
+		dirty->y0 = 0;
+	}
+	if (dirty->x1 >= PL_SIZE_W) {
+		dirty->x1 = PL_SIZE_W - 1;
+	}
+	if (dirty->y1 >= PL_SIZE_H) {
+		dirty->y1 = PL_SIZE_H - 1;
+	}
+#if DAMAGE_ROW_HASH
+	{
+		uint32_t h;
+		int y, top = -1, bottom = -1;
+
+		/* rows outside the area kept their pixels and their hash */
+		for (y = dirty->y0; y <= dirty->y1; y++) {
+			h = hash_row(y);
+			if (h != row_hash[y]) {
+				row_hash[y] = h;
+				if (top < 0) {
+					top = y;
+				}
+				bottom = y;
+			}
+		}
+		if (top < 0) {
+			return 0;
+		}
+		dirty->y0 = top;
+		dirty->y1 = bottom;
+	}
+#endif
+#if defined(PL_COLOR_DEPTH_4)
+	/* whole bytes, two pixels each */
+	dirty->x0 &= ~1;
+	dirty->x1 |= 1;
+#endif
+	return 1;
+}
+
+extern int
+damage_offset(const struct PL_RECT *r)
+{
+	return r->y0 * ROW_BYTES + r->x0 * ROW_BYTES / PL_SIZE_W;
+}
+
+extern int
+damage_bytes(const struct PL_RECT *r)
+{
+	return (r->y1 - r->y0) * ROW_BYTES +
+		   (r->x1 - r->x0 + 1) * ROW_BYTES / PL_SIZE_W;
+}
+
+extern void
+damage_invalidate(void)
+{
+	drawn.x0 = 0;
+	drawn.y0 = 0;
+	drawn.x1 = PL_SIZE_W - 1;
+	drawn.y1 = PL_SIZE_H - 1;
+#if DAMAGE_ROW_HASH
+	memset(row_hash, 0, sizeof(row_hash));
+#endif
+}
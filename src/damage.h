@@ -0,0 +1,21 @@
+#pragma once
+
+/* Partial display updates from the engine's damage bounds, see damage.c */
+
+#include "pl.h"
+
+#ifndef DAMAGE_ROW_HASH
+#define DAMAGE_ROW_HASH 1 /* trim rows whose pixels did not change */
+#endif
+
+/* instead of PL_clear_vp, clears what the previous frame drew */
+extern void damage_clear(int r, int g, int b);
+/* after rendering, the area to send to the display. Returns 0 if
+ * nothing changed. x0/x1 are byte aligned for PL_COLOR_DEPTH_4. */
+extern int damage_collect(struct PL_RECT *dirty);
+/* offset in bytes of the rectangle's first pixel and the bytes it spans
+ * in a PL_SIZE_W wide buffer */
+extern int damage_offset(const struct PL_RECT *r);
+extern int damage_bytes(const struct PL_RECT *r);
+/* next frame clears and sends the whole viewport */
+extern void damage_invalidate(void);
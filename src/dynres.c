@@ -0,0 +1,222 @@
+/*  dynres.c
+*
+* Dynamic render resolution.
+* Each frame is rendered into a scaled rectangle at the top left of the
+* buffers (PL_set_render_scale) and scaled up to the panel on output.
+* Fill time goes with the pixel count, so the controller predicts the
+* render time of a scale from the measured one by the ratio of the
+* squares: it steps down while over budget and back up once the larger
+* size is predicted to fit with DYNRES_HEADROOM to spare.
+*
+*/
+
+#include "dynres.h"
+
+#include <string.h>
+
+#if defined(PL_COLOR_DEPTH_32)
+typedef uint32_t px_t;
+#elif defined(PL_COLOR_DEPTH_16)
+typedef uint16_t px_t;
+#elif defined(PL_COLOR_DEPTH_8)
+typedef uint8_t px_t;
+#endif
+
+static uint32_t budget_us = DYNRES_BUDGET_US;
+static uint32_t avg_us; /* smoothed render time, 0 until the first frame */
+static int scale = PL_VP_SCALE_ONE;
+static int hold;
+
+/* the rectangle the last dynres_begin rendered into */
+static int rw = PL_SIZE_W;
+static int rh = PL_SIZE_H;
+
+/* source column of every output column */
+static uint16_t xmap[DYNRES_OUT_MAX_W];
+static int xmap_ow;
+static int xmap_rw;
+
+extern void
+dynres_set_budget(uint32_t render_us)
+{
+	budget_us = render_us;
+	hold = 0;
+}
+
+extern void
+dynres_begin(void)
+{
+	PL_set_render_scale(scale);
+	rw = PL_vp_max_x + 1;
+	rh = PL_vp_max_y + 1;
+}
+
+/* time t measured at scale from predicted at scale to */
+static uint32_t
+predict(uint32_t t, int from, int to)
+{
+	return (uint32_t)((uint64_t)t * (to * to) / (from * from));
+}
+
+extern void
+dynres_end(uint32_t render_us)
+{
+	int next = scale;
+
+	if (!avg_us) {
+		avg_us = render_us;
+	} else {
+		avg_us += ((int32_t)render_us - (int32_t)avg_us) / 4;
+	}
+	if (hold) {
+		hold--;
+		return;
+	}
+	if (avg_us > budget_us) {
+		next = scale - DYNRES_STEP;
+		if (next < DYNRES_MIN_SCALE) {
+			next = DYNRES_MIN_SCALE;
+		}
+	} else if (scale < PL_VP_SCALE_ONE) {
+		next = scale + DYNRES_STEP;
+		if (next > PL_VP_SCALE_ONE) {
+			next = PL_VP_SCALE_ONE;
+		}
+		if ((uint64_t)predict(avg_us, scale, next) * 100 >
+			(uint64_t)budget_us * DYNRES_HEADROOM) {
+			next = scale;
+		}
+	}
+	if (next != scale) {
+		/* restart the average from what the new size should take */
+		avg_us = predict(avg_us, scale, next);
+		scale = next;
+		hold = DYNRES_HOLD;
+	}
+}
+
+extern int
+dynres_scale(void)
+{
+	return scale;
+}
+
+extern void
+dynres_set_scale(int s)
+{
+	if (s < 1) {
+		s = 1;
+	}
+	if (s > PL_VP_SCALE_ONE) {
+		s = PL_VP_SCALE_ONE;
+	}
+	if (avg_us) {
+		avg_us = predict(avg_us, scale, s);
+	}
+	scale = s;
+	hold = DYNRES_HOLD;
+}
+
+extern void
+dynres_fit(int dw, int dh, struct PL_RECT *out)
+{
+	int w, h;
+
+	if (dw * PL_SIZE_H <= dh * PL_SIZE_W) {
+		w = dw;
+		h = dw * PL_SIZE_H / PL_SIZE_W;
+	} else {
+		h = dh;
+		w = dh * PL_SIZE_W / PL_SIZE_H;
+	}
+	if (w > DYNRES_OUT_MAX_W) {
+		w = DYNRES_OUT_MAX_W;
+		h = w * PL_SIZE_H / PL_SIZE_W;
+	}
+	out->x0 = (dw - w) >> 1;
+	out->y0 = (dh - h) >> 1;
+#if defined(PL_COLOR_DEPTH_4)
+	out->x0 &= ~1;
+	w &= ~1;
+#endif
+	out->x1 = out->x0 + w - 1;
+	out->y1 = out->y0 + h - 1;
+}
+
+extern int
+dynres_row_bytes(int ow)
+{
+#if defined(PL_COLOR_DEPTH_4)
+	return ow >> 1;
+#else
+	return ow * (int)sizeof(px_t);
+#endif
+}
+
+static void
+build_xmap(int ow)
+{
+	int x;
+	uint32_t sx, step;
+
+	if (ow == xmap_ow && rw == xmap_rw) {
+		return;
+	}
+	/* sample the centre of every output pixel, 16.16 */
+	step = ((uint32_t)rw << 16) / ow;
+	sx = step >> 1;
+	for (x = 0; x < ow; x++) {
+		xmap[x] = sx >> 16;
+		sx += step;
+	}
+	xmap_ow = ow;
+	xmap_rw = rw;
+}
+
+extern void
+dynres_upscale(void *dst, int ow, int oh, int row0, int rows)
+{
+	uint8_t *d = dst;
+	int x, y, sy;
+	int prev = -1;
+	int rb;
+#if defined(PL_COLOR_DEPTH_4)
+	const uint8_t *s;
+	int a, b;
+#else
+	const px_t *s;
+	px_t *dp;
+#endif
+
+	if (ow > DYNRES_OUT_MAX_W) {
+		ow = DYNRES_OUT_MAX_W;
+	}
+	/* rows are as wide as what is written to them */
+	rb = dynres_row_bytes(ow);
+	build_xmap(ow);
+	for (y = row0; y < row0 + rows; y++, d += rb) {
+		sy = ((2 * y + 1) * rh) / (2 * oh);
+		if (sy == prev) {
+			/* vertical repeat, the row is already scaled */
+			memcpy(d, d - rb, rb);
+			continue;
+		}
+		prev = sy;
+#if defined(PL_COLOR_DEPTH_4)
+		/* left pixel in the high nibble */
+		s = (const uint8_t *)PL_video_buffer + ((sy * PL_hres) >> 1);
+		for (x = 0; x < ow; x += 2) {
+			a = xmap[x];
+			b = xmap[x + 1];
+			d[x >> 1] = (((s[a >> 1] >> ((~a & 1) << 2)) & 0xf) << 4) |
+						((s[b >> 1] >> ((~b & 1) << 2)) & 0xf);
+		}
+#else
+		s = (const px_t *)PL_video_buffer + sy * PL_hres;
+		dp = (px_t *)d;
+		for (x = 0; x < ow; x++) {
+			dp[x] = s[xmap[x]];
+		}
+#endif
+	}
+}
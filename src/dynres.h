@@ -0,0 +1,48 @@
+#pragma once
+
+/* Dynamic render resolution against a frame time budget, see dynres.c */
+
+#include "pl.h"
+
+#include <stdint.h>
+
+#ifndef DYNRES_BUDGET_US
+#define DYNRES_BUDGET_US 25000 /* render time to hold, 30 fps with display */
+#endif
+#ifndef DYNRES_MIN_SCALE
+#define DYNRES_MIN_SCALE 128 /* lowest render scale in 1/256, half size */
+#endif
+#ifndef DYNRES_STEP
+#define DYNRES_STEP 16 /* scale change per adjustment */
+#endif
+#ifndef DYNRES_HEADROOM
+#define DYNRES_HEADROOM 85 /* % of the budget a step up may be predicted at */
+#endif
+#ifndef DYNRES_HOLD
+#define DYNRES_HOLD 4 /* frames to settle after a change */
+#endif
+#ifndef DYNRES_OUT_MAX_W
+#define DYNRES_OUT_MAX_W 256 /* widest upscaled output */
+#endif
+#ifndef DYNRES_STRIP_BYTES
+#define DYNRES_STRIP_BYTES 4096 /* upscaled rows sent per display_write */
+#endif
+
+extern void dynres_set_budget(uint32_t render_us);
+/* sets the render size of the next frame, call before rendering it */
+extern void dynres_begin(void);
+/* adjusts the render size from the render time of the frame */
+extern void dynres_end(uint32_t render_us);
+/* current render scale in 1/256 */
+extern int dynres_scale(void);
+/* pins the render scale, the controller resumes from it */
+extern void dynres_set_scale(int scale);
+
+/* largest w x h with the buffers' aspect ratio that fits a dw x dh panel,
+ * centred. x0/x1 are byte aligned for PL_COLOR_DEPTH_4. */
+extern void dynres_fit(int dw, int dh, struct PL_RECT *out);
+/* nearest neighbour scales the rendered rectangle to ow x oh and writes
+ * rows row0..row0 + rows - 1 of it to dst, ow pixels per row */
+extern void dynres_upscale(void *dst, int ow, int oh, int row0, int rows);
+/* bytes of one upscaled row */
+extern int dynres_row_bytes(int ow);
@@ -0,0 +1,257 @@
+/*  frametime.c
+*
+* Frame time recorder.
+* Keeps the last FRAMETIME_WINDOW total, render and display times in a
+* ring and counts frames over the deadline. Recording is a few stores
+* per frame; sorting for the percentiles only happens when a report is
+* asked for, normally through the "frametime" shell command.
+* The PL_stats counters of the last frame are kept next to the times.
+*
+*/
+
+#include "frametime.h"
+#include "pl.h"
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+#include <stdlib.h>
+#endif
+
+static uint32_t ring[FRAMETIME_COUNT][FRAMETIME_WINDOW];
+static uint32_t ring_pos;
+static uint32_t ring_len;
+static uint32_t deadline_us = FRAMETIME_DEADLINE_US;
+static uint32_t misses;
+static uint32_t recorded;
+static struct PL_STATS last_stats;
+
+/* the render loop and the shell run on different threads */
+static struct k_spinlock lock;
+
+extern void
+frametime_record(uint32_t total_us, uint32_t render_us, uint32_t display_us)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ring[FRAMETIME_TOTAL][ring_pos] = total_us;
+	ring[FRAMETIME_RENDER][ring_pos] = render_us;
+	ring[FRAMETIME_DISPLAY][ring_pos] = display_us;
+	ring_pos = (ring_pos + 1) % FRAMETIME_WINDOW;
+	if (ring_len < FRAMETIME_WINDOW) {
+		ring_len++;
+	}
+	if (total_us > deadline_us) {
+		misses++;
+	}
+	recorded++;
+	k_spin_unlock(&lock, key);
+}
+
+extern void
+frametime_record_stats(const struct PL_STATS *s)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	last_stats = *s;
+	k_spin_unlock(&lock, key);
+}
+
+extern void
+frametime_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ring_pos = 0;
+	ring_len = 0;
+	misses = 0;
+	recorded = 0;
+	k_spin_unlock(&lock, key);
+}
+
+extern void
+frametime_set_deadline(uint32_t us)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	deadline_us = us;
+	k_spin_unlock(&lock, key);
+}
+
+static void
+sort(uint32_t *v, uint32_t n)
+{
+	uint32_t i, j, x;
+
+	/* window is small, insertion sort keeps the stack use flat */
+	for (i = 1; i < n; i++) {
+		x = v[i];
+		for (j = i; j > 0 && v[j - 1] > x; j--) {
+			v[j] = v[j - 1];
+		}
+		v[j] = x;
+	}
+}
+
+/* nearest rank percentile of a sorted array */
+static uint32_t
+rank(const uint32_t *v, uint32_t n, uint32_t pct)
+{
+	uint32_t i = (pct * n + 99) / 100;
+
+	return v[i ? i - 1 : 0];
+}
+
+static void
+summarize(struct frametime_summary *s, uint32_t *v, uint32_t n)
+{
+	uint64_t sum = 0;
+	uint32_t i;
+
+	memset(s, 0, sizeof(*s));
+	if (n == 0) {
+		return;
+	}
+	sort(v, n);
+	for (i = 0; i < n; i++) {
+		sum += v[i];
+	}
+	s->min = v[0];
+	s->max = v[n - 1];
+	s->mean = (uint32_t)(sum / n);
+	s->p50 = rank(v, n, 50);
+	s->p95 = rank(v, n, 95);
+	s->p99 = rank(v, n, 99);
+}
+
+extern void
+frametime_report(struct frametime_report *r)
+{
+	static uint32_t copy[FRAMETIME_COUNT][FRAMETIME_WINDOW];
+	k_spinlock_key_t key;
+	uint32_t i, n;
+
+	key = k_spin_lock(&lock);
+	n = ring_len;
+	memcpy(copy, ring, sizeof(copy));
+	r->frames = n;
+	r->deadline_us = deadline_us;
+	r->misses = misses;
+	r->recorded = recorded;
+	k_spin_unlock(&lock, key);
+
+	/* order does not matter for the statistics, only the first n are used */
+	r->window_misses = 0;
+	for (i = 0; i < n; i++) {
+		if (copy[FRAMETIME_TOTAL][i] > r->deadline_us) {
+			r->window_misses++;
+		}
+	}
+	for (i = 0; i < FRAMETIME_COUNT; i++) {
+		summarize(&r->t[i], copy[i], n);
+	}
+}
+
+#ifdef CONFIG_SHELL
+static const char *const names[FRAMETIME_COUNT] = {
+	"total", "render", "display"
+};
+
+static int
+cmd_show(const struct shell *sh, size_t argc, char **argv)
+{
+	static struct frametime_report r;
+	const struct frametime_summary *s;
+	int i;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	frametime_report(&r);
+	shell_print(sh, "%u frames in window, deadline %u us", r.frames,
+				r.deadline_us);
+	shell_print(sh, "misses: %u in window, %u of %u since reset",
+				r.window_misses, r.misses, r.recorded);
+	shell_print(sh, "%-8s %8s %8s %8s %8s %8s %8s", "us", "min", "mean",
+				"p50", "p95", "p99", "max");
+	for (i = 0; i < FRAMETIME_COUNT; i++) {
+		s = &r.t[i];
+		shell_print(sh, "%-8s %8u %8u %8u %8u %8u %8u", names[i], s->min,
+					s->mean, s->p50, s->p95, s->p99, s->max);
+	}
+	return 0;
+}
+
+static int
+cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	static const char *const stages[PL_STAGE_COUNT] = {
+		"clear", "transform", "calc", "fill"
+	};
+	struct PL_STATS st;
+	k_spinlock_key_t key;
+	int i;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	key = k_spin_lock(&lock);
+	st = last_stats;
+	k_spin_unlock(&lock, key);
+#ifndef PERFORMANCE_MEASURE
+	shell_print(sh, "counters need PERFORMANCE_MEASURE in config.h");
+#endif
+	shell_print(sh, "objects %u, polygons %u submitted, %u rasterized",
+				st.objects, st.polys_submitted, st.polys_rasterized);
+	shell_print(sh, "culled %u near, %u backface, %u clipped",
+				st.polys_near_culled, st.polys_backface_culled,
+				st.polys_clipped);
+	shell_print(sh, "spans %u, pixels %u tested, %u written, %u z fails",
+				st.spans, st.pixels_tested, st.pixels_written, st.z_fails);
+	shell_print(sh, "objects past PL_WORLD_RANGE %u", st.world_skipped);
+	for (i = 0; i < PL_STAGE_COUNT; i++) {
+		shell_print(sh, "%-9s %10u cycles", stages[i], st.cycles[i]);
+	}
+	return 0;
+}
+
+static int
+cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	frametime_reset();
+	shell_print(sh, "frame times cleared");
+	return 0;
+}
+
+static int
+cmd_deadline(const struct shell *sh, size_t argc, char **argv)
+{
+	long us;
+
+	ARG_UNUSED(argc);
+
+	us = strtol(argv[1], NULL, 10);
+	if (us <= 0) {
+		shell_error(sh, "deadline must be a positive number of us");
+		return -EINVAL;
+	}
+	frametime_set_deadline((uint32_t)us);
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(frametime_cmds,
+	SHELL_CMD(show, NULL, "min/mean/p50/p95/p99/max and misses", cmd_show),
+	SHELL_CMD(stats, NULL, "engine counters of the last frame", cmd_stats),
+	SHELL_CMD(reset, NULL, "clear the window and miss counts", cmd_reset),
+	SHELL_CMD_ARG(deadline, NULL, "<us> frame budget for miss counting",
+				  cmd_deadline, 2, 0),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(frametime, &frametime_cmds, "Frame time statistics",
+				   NULL);
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+
+/* Rolling window frame time recorder, see frametime.c */
+
+#include <stdint.h>
+
+struct PL_STATS;
+
+#ifndef FRAMETIME_WINDOW
+#define FRAMETIME_WINDOW 128 /* frames kept for percentiles */
+#endif
+#ifndef FRAMETIME_DEADLINE_US
+#define FRAMETIME_DEADLINE_US 33333 /* default frame budget, 30 fps */
+#endif
+
+#define FRAMETIME_TOTAL   0 /* whole frame */
+#define FRAMETIME_RENDER  1 /* engine, up to PL_pipe_flush */
+#define FRAMETIME_DISPLAY 2 /* display_write */
+#define FRAMETIME_COUNT   3
+
+struct frametime_summary {
+	uint32_t min, mean, p50, p95, p99, max; /* microseconds */
+};
+
+struct frametime_report {
+	uint32_t frames;        /* frames in the window */
+	uint32_t deadline_us;
+	uint32_t window_misses; /* total time over the deadline in the window */
+	uint32_t misses;        /* since the last reset */
+	uint32_t recorded;      /* frames since the last reset */
+	struct frametime_summary t[FRAMETIME_COUNT];
+};
+
+/* O(1), call once per frame with the frame's times in microseconds */
+extern void frametime_record(uint32_t total_us, uint32_t render_us,
+							 uint32_t display_us);
+/* keeps the engine counters of the last frame for "frametime stats" */
+extern void frametime_record_stats(const struct PL_STATS *s);
+/* sorts a copy of the window, meant for the shell thread */
+extern void frametime_report(struct frametime_report *r);
+extern void frametime_reset(void);
+extern void frametime_set_deadline(uint32_t us);
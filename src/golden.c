@@ -0,0 +1,1163 @@
+/*  golden.c
+*
+* Golden image regression harness.
+* Renders a fixed catalogue of scenes (each raster mode, near plane
+* clipping, viewport edges, textured building_01), dumps PL_video_buffer
+* and PL_depth_buffer as PGM/PPM files and compares them against checked-in
+* references. A diff image is written next to every render that does not
+* match. damage_motion has no reference, it checks the partial updates of
+* damage.c against full clears over a moving camera. importer_errors feeds
+* the DMDL importers malformed files, each must be rejected.
+*
+* Built into the app with -DAPP_GOLDEN=ON (native_sim, with golden.conf for
+* host file access) and into the host build as pl_golden.
+*
+*/
+
+#include "pl.h"
+#include "golden.h"
+#include "dynres.h"
+#include "damage.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define NPIX (PL_SIZE_W * PL_SIZE_H)
+
+#if defined(PL_COLOR_DEPTH_8) || defined(PL_COLOR_DEPTH_4)
+#define VIDEO_CHANNELS 1
+#else
+#define VIDEO_CHANNELS 3
+#endif
+
+/* depth is dumped as 16-bit, keep the top bits of full precision depth */
+#define DEPTH_DUMP_SHIFT (16 - ZBUF_SHIFT)
+
+struct golden_scene {
+	const char *name;
+	void (*draw)(void);
+	int (*ready)(void); /* 0 if a file the scene renders did not load */
+};
+
+static struct PL_OBJ *cube;
+static struct PL_OBJ *cube_textured;
+#ifdef PL_HOST
+/* golden/house.dmdl through both importers, only the host build has them */
+static struct PL_OBJ *house_text;
+static struct PL_OBJ *house_bin;
+#endif
+/* replaces the checker on the textured cubes of draw_cubes when set */
+static struct PL_TEX *cube_tex;
+
+static struct PL_TEX checktex;
+static PL_TEXEL checker[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
+/* the same checker as palette indices, it only uses four grey levels */
+static struct PL_TEX checktex_i4;
+static struct PL_TEX checktex_i2;
+static struct PL_TEX checktex_morton;
+static struct PL_TEX checktex_i4_morton;
+static struct PL_TEX checktex_mip;
+static uint8_t checker_i4[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM / 2];
+static uint8_t checker_i2[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM / 4];
+static PL_TEXEL checker_morton[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
+static uint8_t checker_i4_morton[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM / 2];
+static PL_TEXEL checker_mip[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM * 4 / 3 + 1];
+static uint8_t checker_grey[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM * 4 / 3 + 1];
+static PL_TEXEL checker_pal[16];
+/* 2:1 atlas: the checker, and a half size and a half height texture
+ * next to it */
+static struct PL_TEX atlas_checker;
+static struct PL_TEX atlas_small;
+static struct PL_TEX atlas_wide;
+static PL_TEXEL atlas[2 * PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
+
+static uint8_t img_cur[NPIX * 3];
+static uint8_t img_ref[NPIX * 3];
+static uint8_t img_diff[NPIX];
+static uint32_t upscaled[NPIX]; /* big enough at any color depth */
+/* damage_motion: what the panel shows */
+static uint32_t damage_panel[NPIX];
+
+#include "building_01.h"
+
+/* building_01 as the tools write it in a pack, rendered from it */
+#define PACK_BYTES (256 * 1024)
+static uint64_t pack_buf[PACK_BYTES / 8];
+static struct PL_PACK pack;
+
+/* building_01 with quantized vertices */
+static int16_t building_q16_verts[PL_MAX_OBJ_V * PL_VLEN];
+static int8_t building_q8_verts[PL_MAX_OBJ_V * 3];
+static struct PL_OBJ_CONST building_q16;
+static struct PL_OBJ_CONST building_q8;
+
+static void
+atlas_add(struct PL_TEX *t, int lw, int lh, int ax, int ay)
+{
+	t->data = atlas;
+	t->lw = lw;
+	t->lh = lh;
+	t->ax = ax;
+	t->ay = ay;
+	t->alw = PL_REQ_TEX_LOG_DIM + 1;
+	t->alh = PL_REQ_TEX_LOG_DIM;
+}
+
+static void
+makeatlas(void)
+{
+	const int d = PL_REQ_TEX_DIM;
+	const int l = PL_REQ_TEX_LOG_DIM;
+	int i, j;
+
+	atlas_add(&atlas_checker, l, l, 0, 0);
+	atlas_add(&atlas_small, l - 1, l - 1, d, 0);
+	atlas_add(&atlas_wide, l, l - 1, d, d / 2);
+	for (j = 0; j < d; j++) {
+		for (i = 0; i < d; i++) {
+			atlas[PL_tex_index(&atlas_checker, 0, i, j)] = checker[i + j * d];
+		}
+	}
+	for (j = 0; j < d / 2; j++) {
+		for (i = 0; i < d / 2; i++) {
+			atlas[PL_tex_index(&atlas_small, 0, i, j)] =
+				PL_TEXEL_GREY((i ^ j) & 4 ? 0xE0 : 0x30);
+		}
+		for (i = 0; i < d; i++) {
+			atlas[PL_tex_index(&atlas_wide, 0, i, j)] =
+				PL_TEXEL_GREY(((i + j) & 7) * 0x20 + 0x10);
+		}
+	}
+}
+
+/* golden/building_01.plpk, written by tools/h2pack.py from building_01.h */
+static void
+loadpack(const char *dir)
+{
+	char path[256];
+	FILE *f;
+	size_t n;
+
+	snprintf(path, sizeof(path), "%s/building_01.plpk", dir);
+	if (!(f = fopen(path, "rb"))) {
+		printf("golden: cannot open %s\n", path);
+		return;
+	}
+	n = fread(pack_buf, 1, sizeof(pack_buf), f);
+	fclose(f);
+	if (!PL_pack_open(&pack, pack_buf, n) || !PL_pack_verify(&pack)) {
+		printf("golden: %s did not open\n", path);
+	}
+}
+
+/* centred on the bounds, int8 spread over +-127 */
+static void
+makequant(void)
+{
+	const int16_t *v = building_01.verts16;
+	int lo[3], hi[3];
+	int i, k, half, q;
+
+	for (k = 0; k < 3; k++) {
+		lo[k] = hi[k] = v[k];
+	}
+	for (i = 0; i < building_01.n_verts; i++) {
+		for (k = 0; k < 3; k++) {
+			if (v[i * PL_VLEN + k] < lo[k]) {
+				lo[k] = v[i * PL_VLEN + k];
+			}
+			if (v[i * PL_VLEN + k] > hi[k]) {
+				hi[k] = v[i * PL_VLEN + k];
+			}
+		}
+	}
+	building_q16 = building_01;
+	building_q16.verts16 = building_q16_verts;
+	building_q8 = building_01;
+	building_q8.verts16 = NULL;
+	building_q8.verts8 = building_q8_verts;
+	for (k = 0; k < 3; k++) {
+		building_q16.quant.off[k] = (lo[k] + hi[k]) / 2;
+		building_q16.quant.scale[k] = PL_P_ONE;
+		building_q8.quant.off[k] = building_q16.quant.off[k];
+		half = hi[k] - building_q8.quant.off[k];
+		building_q8.quant.scale[k] = (half * PL_P_ONE + 126) / 127 + 1;
+	}
+	for (i = 0; i < building_01.n_verts; i++) {
+		for (k = 0; k < 3; k++) {
+			q = v[i * PL_VLEN + k] - building_q16.quant.off[k];
+			building_q16_verts[i * PL_VLEN + k] = q;
+			q = (q * PL_P_ONE + (q < 0 ? -1 : 1) *
+				 (building_q8.quant.scale[k] >> 1)) / building_q8.quant.scale[k];
+			building_q8_verts[i * 3 + k] = q < -127 ? -127 : (q > 127 ? 127 : q);
+		}
+	}
+}
+
+/* box filtered mip chain of the checker, down to 1x1 */
+static void
+makemips(void)
+{
+	const struct PL_TEX *t = &checktex_mip;
+	int l, i, j, dim;
+	int g;
+
+	for (i = 0; i < PL_REQ_TEX_DIM * PL_REQ_TEX_DIM; i++) {
+		checker_mip[i] = checker[i];
+	}
+	for (l = 1; (PL_REQ_TEX_DIM >> l) > 0; l++) {
+		dim = PL_REQ_TEX_DIM >> l;
+		for (j = 0; j < dim; j++) {
+			for (i = 0; i < dim; i++) {
+				g = checker_grey[PL_tex_index(t, l - 1, 2 * i, 2 * j)] +
+					checker_grey[PL_tex_index(t, l - 1, 2 * i + 1, 2 * j)] +
+					checker_grey[PL_tex_index(t, l - 1, 2 * i, 2 * j + 1)] +
+					checker_grey[PL_tex_index(t, l - 1, 2 * i + 1, 2 * j + 1)];
+				checker_grey[PL_tex_index(t, l, i, j)] = (g + 2) >> 2;
+				checker_mip[PL_tex_index(t, l, i, j)] =
+					PL_TEXEL_GREY((g + 2) >> 2);
+			}
+		}
+	}
+	checktex_mip.data = checker_mip;
+	checktex_mip.levels = l;
+}
+
+static void
+maketex(void)
+{
+	static const int grey[4] = { 0xC0, 0x10, 0x60, 0xFF };
+	int i, j, k, n, m;
+
+	for (i = 0; i < 4; i++) {
+		checker_pal[i] = PL_TEXEL_GREY(grey[i]);
+	}
+	checktex_morton.layout = PL_TEX_MORTON;
+	for (i = 0; i < PL_REQ_TEX_DIM; i++) {
+		for (j = 0; j < PL_REQ_TEX_DIM; j++) {
+			if (i < 2 || j < 2 || i > PL_REQ_TEX_DIM - 3 ||
+				j > PL_REQ_TEX_DIM - 3) {
+				k = 0;
+			} else if ((i & 0x2) ^ (j & 0x2)) {
+				k = 1;
+			} else {
+				k = 2;
+			}
+			if (i == j) {
+				k = 3;
+			}
+			n = i + j * PL_REQ_TEX_DIM;
+			checker[n] = checker_pal[k];
+			checker_grey[n] = grey[k];
+			checker_i4[n >> 1] |= k << ((n & 1) << 2);
+			checker_i2[n >> 2] |= k << ((n & 3) << 1);
+			m = PL_tex_index(&checktex_morton, 0, i, j);
+			checker_morton[m] = checker_pal[k];
+			checker_i4_morton[m >> 1] |= k << ((m & 1) << 2);
+		}
+	}
+	checktex.data = checker;
+	checktex_i4.fmt = PL_TEX_I4;
+	checktex_i4.idx = checker_i4;
+	checktex_i4.pal = checker_pal;
+	checktex_i2.fmt = PL_TEX_I2;
+	checktex_i2.idx = checker_i2;
+	checktex_i2.pal = checker_pal;
+	checktex_morton.data = checker_morton;
+	checktex_i4_morton.fmt = PL_TEX_I4;
+	checktex_i4_morton.idx = checker_i4_morton;
+	checktex_i4_morton.pal = checker_pal;
+	checktex_i4_morton.layout = PL_TEX_MORTON;
+	makemips();
+	makeatlas();
+}
+
+/* three cubes at different depths and orientations */
+static void
+draw_cubes(int rmode)
+{
+	PL_raster_mode = rmode;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+
+	PL_cur_tex = cube_tex;
+	PL_mst_push();
+	PL_mst_translate(-40, -10, 300);
+	PL_mst_rotatex(PL_A256(20));
+	PL_mst_rotatey(PL_A256(30));
+	PL_render_object(cube_textured);
+	PL_mst_pop();
+
+	PL_mst_push();
+	PL_mst_translate(30, 20, 420);
+	PL_mst_rotatex(PL_A256(-40));
+	PL_mst_rotatez(PL_A256(10));
+	PL_render_object(cube_textured);
+	PL_mst_pop();
+
+	PL_cur_tex = NULL;
+
+	/* intersects the second one */
+	PL_mst_push();
+	PL_mst_translate(50, 0, 440);
+	PL_mst_rotatey(PL_A256(50));
+	PL_mst_scale(PL_P_ONE * 3 / 2, PL_P_ONE, PL_P_ONE);
+	PL_render_object(cube);
+	PL_mst_pop();
+}
+
+static void
+draw_textured(void)
+{
+	draw_cubes(PL_TEXTURED);
+}
+
+static void
+draw_textured_nolight(void)
+{
+	draw_cubes(PL_TEXTURED_NOLIGHT);
+}
+
+/* indexed textures replace the cube's, these must match mode_textured */
+static void
+draw_textured_i4(void)
+{
+	cube_tex = &checktex_i4;
+	draw_cubes(PL_TEXTURED);
+	cube_tex = NULL;
+}
+
+static void
+draw_textured_i2_nolight(void)
+{
+	cube_tex = &checktex_i2;
+	draw_cubes(PL_TEXTURED_NOLIGHT);
+	cube_tex = NULL;
+}
+
+/* Z-order copies of the checker, these must match mode_textured too */
+static void
+draw_textured_morton(void)
+{
+	cube_tex = &checktex_morton;
+	draw_cubes(PL_TEXTURED);
+	cube_tex = NULL;
+}
+
+static void
+draw_textured_i4_morton_nolight(void)
+{
+	cube_tex = &checktex_i4_morton;
+	draw_cubes(PL_TEXTURED_NOLIGHT);
+	cube_tex = NULL;
+}
+
+/* the checker at the corner of an atlas, must match mode_textured */
+static void
+draw_textured_atlas(void)
+{
+	cube_tex = &atlas_checker;
+	draw_cubes(PL_TEXTURED);
+	cube_tex = NULL;
+}
+
+/* the other atlas textures wrap within their rectangles */
+static void
+draw_atlas_cubes(void)
+{
+	static struct PL_TEX *const tex[3] = { &atlas_small, &atlas_wide,
+										   &atlas_checker };
+	int i;
+
+	PL_raster_mode = PL_TEXTURED;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	for (i = 0; i < 3; i++) {
+		PL_cur_tex = tex[i];
+		PL_mst_push();
+		PL_mst_translate(i * 45 - 50, (i & 1) * 20 - 10, 320 + i * 40);
+		PL_mst_rotatex(PL_A256(20 + i * 15));
+		PL_mst_rotatey(PL_A256(30 - i * 20));
+		PL_render_object(cube_textured);
+		PL_mst_pop();
+	}
+	PL_cur_tex = NULL;
+}
+
+/* rows of cubes into the distance, with and without mipmaps */
+static void
+draw_far_cubes(void)
+{
+	int i, j;
+
+	PL_raster_mode = PL_TEXTURED;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	for (j = 0; j < 2; j++) {
+		PL_cur_tex = j ? &checktex_mip : &checktex;
+		for (i = 0; i < 6; i++) {
+			PL_mst_push();
+			PL_mst_translate(i * 40 - 80, j ? 70 : -70, 250 + i * 220);
+			PL_mst_rotatex(PL_A256(20));
+			PL_mst_rotatey(PL_A256(30 + i * 10));
+			PL_render_object(cube_textured);
+			PL_mst_pop();
+		}
+	}
+	PL_cur_tex = NULL;
+}
+
+static void
+draw_flat(void)
+{
+	draw_cubes(PL_FLAT);
+}
+
+static void
+draw_flat_nolight(void)
+{
+	draw_cubes(PL_FLAT_NOLIGHT);
+}
+
+static void
+draw_edge_wireframe(void)
+{
+	draw_cubes(PL_EDGE_WIREFRAME);
+}
+
+static void
+draw_wireframe(void)
+{
+	draw_cubes(PL_WIREFRAME);
+}
+
+static void
+draw_nodraw(void)
+{
+	draw_cubes(PL_NODRAW);
+}
+
+static void
+draw_overdraw(void)
+{
+	draw_cubes(PL_OVERDRAW);
+	PL_overdraw_resolve(NULL);
+}
+
+/* cube straddling the near plane */
+static void
+draw_near_clip(void)
+{
+	PL_raster_mode = PL_TEXTURED;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+
+	PL_mst_push();
+	PL_mst_translate(8, 4, PL_Z_NEAR_PLANE + 6);
+	PL_mst_rotatey(PL_A256(24));
+	PL_mst_rotatex(PL_A256(12));
+	PL_render_object(cube_textured);
+	PL_mst_pop();
+}
+
+/* objects crossing a viewport smaller than the buffer and the buffer edges */
+static void
+draw_viewport_edges(void)
+{
+	PL_raster_mode = PL_TEXTURED;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	PL_set_viewport(16, 8, PL_SIZE_W - 17, PL_SIZE_H - 9, 0);
+
+	PL_mst_push();
+	PL_mst_translate(-30, -48, 200);
+	PL_mst_rotatey(PL_A256(40));
+	PL_render_object(cube_textured);
+	PL_mst_pop();
+
+	PL_mst_push();
+	PL_mst_translate(34, 40, 220);
+	PL_mst_rotatex(PL_A256(70));
+	PL_render_object(cube_textured);
+	PL_mst_pop();
+
+	PL_set_viewport(0, 0, PL_SIZE_W - 1, PL_SIZE_H - 1, 0);
+
+	PL_mst_push();
+	PL_mst_translate(44, -58, 250);
+	PL_mst_rotatez(PL_A256(16));
+	PL_render_object(cube);
+	PL_mst_pop();
+}
+
+/* angles between the 256ths of a turn, need PL_TRIG_BITS above 8 */
+static void
+draw_fine_angles(void)
+{
+	int i;
+
+	PL_raster_mode = PL_TEXTURED;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+
+	for (i = 0; i < 3; i++) {
+		PL_mst_push();
+		PL_mst_translate(0, -70 + i * 70, 420);
+		/* 7, 24.5 and 42 degrees */
+		PL_mst_rotatey(PL_TRIGMAX * (14 + i * 35) / 720);
+		PL_mst_rotatex(PL_TRIGMAX * (14 + i * 35) / 720);
+		PL_render_object(cube_textured);
+		PL_mst_pop();
+	}
+}
+
+/* same placement as the demo in main.c */
+static void
+draw_building_obj(int rmode, const struct PL_OBJ_CONST *obj)
+{
+	PL_raster_mode = rmode;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+
+	PL_mst_push();
+	PL_mst_translate(-10, -100, 1500);
+	PL_mst_rotatex(PL_A256(10));
+	PL_mst_rotatey(PL_A256(128));
+	PL_mst_rotatez(PL_A256(64));
+	PL_render_object_const(obj);
+	PL_mst_pop();
+}
+
+static void
+draw_building(int rmode)
+{
+	draw_building_obj(rmode, &building_01);
+}
+
+static int
+pack_ready(void)
+{
+	return PL_pack_find_mesh(&pack, "building_01") >= 0;
+}
+
+/* from the asset pack, must match building_textured */
+static void
+draw_building_pack(void)
+{
+	int m = PL_pack_find_mesh(&pack, "building_01");
+
+	if (m >= 0) {
+		draw_building_obj(PL_TEXTURED, &pack.meshes[m]);
+	}
+}
+
+/* quantized relative to the centre, near building_textured */
+static void
+draw_building_q16(void)
+{
+	draw_building_obj(PL_TEXTURED, &building_q16);
+}
+
+/* 8-bit, a step is about 1/254 of the building */
+static void
+draw_building_q8(void)
+{
+	draw_building_obj(PL_TEXTURED, &building_q8);
+}
+
+static void
+draw_building_textured(void)
+{
+	draw_building(PL_TEXTURED);
+}
+
+static void
+draw_building_textured_nolight(void)
+{
+	draw_building(PL_TEXTURED_NOLIGHT);
+}
+
+/* look-at camera above and to the side of the building */
+static void
+draw_building_look_at(void)
+{
+	int eye[3] = { 500, 300, 200 }, at[3] = { -10, -100, 1500 };
+	int up[3] = { 0, 1, 0 };
+
+	PL_raster_mode = PL_TEXTURED;
+	PL_look_at(eye, at, up);
+
+	PL_mst_push();
+	/* no rotatez(64), look-at has no x/y swap to undo */
+	PL_mst_translate(-10, -100, 1500);
+	PL_mst_rotatey(PL_A256(128));
+	PL_render_object_const(&building_01);
+	PL_mst_pop();
+}
+
+/* building_look_at kilometres away from the world origin, rebased */
+static void
+draw_building_far_world(void)
+{
+	int64_t base[3] = { (int64_t)3 << 32, 700000000, -((int64_t)1 << 36) };
+	int64_t eye[3], at[3], pos[3];
+	int up[3] = { 0, 1, 0 };
+
+	eye[0] = base[0] + 500;
+	eye[1] = base[1] + 300;
+	eye[2] = base[2] + 200;
+	at[0] = pos[0] = base[0] - 10;
+	at[1] = pos[1] = base[1] - 100;
+	at[2] = pos[2] = base[2] + 1500;
+
+	PL_raster_mode = PL_TEXTURED;
+	PL_world_look_at(eye, at, up);
+
+	PL_mst_push();
+	if (PL_mst_translate_world(pos)) {
+		PL_mst_rotatey(PL_A256(128));
+		PL_render_object_const(&building_01);
+	}
+	PL_mst_pop();
+}
+
+#ifdef PL_DYNRES
+/* half size render scaled up to the full buffer by the output path */
+static void
+draw_building_half_res(void)
+{
+	dynres_set_scale(PL_VP_SCALE_ONE / 2);
+	dynres_begin();
+	PL_clear_vp(0, 0, 0);
+	draw_building(PL_TEXTURED);
+	PL_pipe_flush();
+	dynres_upscale(upscaled, PL_SIZE_W, PL_SIZE_H, 0, PL_SIZE_H);
+	memcpy(PL_video_buffer, upscaled, dynres_row_bytes(PL_SIZE_W) * PL_SIZE_H);
+	dynres_set_scale(PL_VP_SCALE_ONE);
+	PL_set_render_scale(PL_VP_SCALE_ONE);
+}
+#endif
+
+static void
+draw_building_overdraw(void)
+{
+	draw_building(PL_OVERDRAW);
+	PL_overdraw_resolve(NULL);
+}
+
+#ifdef PL_HOST
+static void
+draw_house(const struct PL_OBJ *house)
+{
+	PL_raster_mode = PL_FLAT;
+	PL_set_camera(0, 0, 0, 0, 0, 0);
+	PL_mst_push();
+	PL_mst_translate(0, 10, 260);
+	PL_mst_rotatez(PL_A256(128));
+	PL_mst_rotatey(PL_A256(40));
+	PL_mst_rotatex(PL_A256(20));
+	PL_render_object(house);
+	PL_mst_pop();
+}
+
+static int
+house_text_ready(void)
+{
+	return house_text != NULL;
+}
+
+static int
+house_bin_ready(void)
+{
+	return house_bin != NULL;
+}
+
+static void
+draw_dmdl_text(void)
+{
+	draw_house(house_text);
+}
+
+/* must match dmdl_text */
+static void
+draw_dmdl_bin(void)
+{
+	draw_house(house_bin);
+}
+#endif
+
+static const struct golden_scene scenes[] = {
+	{ "mode_textured", draw_textured, NULL },
+	{ "mode_textured_nolight", draw_textured_nolight, NULL },
+	{ "mode_textured_i4", draw_textured_i4, NULL },
+	{ "mode_textured_i2_nolight", draw_textured_i2_nolight, NULL },
+	{ "mode_textured_morton", draw_textured_morton, NULL },
+	{ "mode_textured_i4_morton_nolight", draw_textured_i4_morton_nolight, NULL },
+	{ "textured_mip_far", draw_far_cubes, NULL },
+	{ "mode_textured_atlas", draw_textured_atlas, NULL },
+	{ "textured_atlas", draw_atlas_cubes, NULL },
+	{ "mode_flat", draw_flat, NULL },
+	{ "mode_flat_nolight", draw_flat_nolight, NULL },
+	{ "mode_edge_wireframe", draw_edge_wireframe, NULL },
+	{ "mode_wireframe", draw_wireframe, NULL },
+	{ "mode_nodraw", draw_nodraw, NULL },
+	{ "mode_overdraw", draw_overdraw, NULL },
+	{ "near_clip", draw_near_clip, NULL },
+	{ "viewport_edges", draw_viewport_edges, NULL },
+	{ "fine_angles", draw_fine_angles, NULL },
+	{ "building_textured", draw_building_textured, NULL },
+	{ "building_textured_nolight", draw_building_textured_nolight, NULL },
+	{ "building_overdraw", draw_building_overdraw, NULL },
+	{ "building_look_at", draw_building_look_at, NULL },
+	{ "building_far_world", draw_building_far_world, NULL },
+#ifdef PL_DYNRES
+	{ "building_half_res", draw_building_half_res, NULL },
+#endif
+	{ "building_pack", draw_building_pack, pack_ready },
+	{ "building_q16", draw_building_q16, NULL },
+	{ "building_q8", draw_building_q8, NULL },
+#ifdef PL_HOST
+	{ "dmdl_text", draw_dmdl_text, house_text_ready },
+	{ "dmdl_bin", draw_dmdl_bin, house_bin_ready },
+#endif
+};
+
+static void
+dump_video(uint8_t *dst)
+{
+	int i, c;
+
+	for (i = 0; i < NPIX; i++) {
+#if defined(PL_COLOR_DEPTH_4)
+		c = PL_video_buffer[i >> 1];
+		*dst++ = ((c >> ((~i & 1) << 2)) & 0xf) * 0x11;
+#else
+		c = PL_video_buffer[i];
+#if defined(PL_COLOR_DEPTH_8)
+		*dst++ = c;
+#elif defined(PL_COLOR_DEPTH_16)
+		*dst++ = (c >> 8) & 0xf8;
+		*dst++ = (c >> 3) & 0xfc;
+		*dst++ = (c << 3) & 0xf8;
+#else
+		*dst++ = (c >> 16) & 0xff;
+		*dst++ = (c >> 8) & 0xff;
+		*dst++ = c & 0xff;
+#endif
+#endif
+	}
+}
+
+static void
+dump_depth(uint8_t *dst)
+{
+	int i, z;
+
+	for (i = 0; i < NPIX; i++) {
+		z = (PL_depth_at(i % PL_SIZE_W, i / PL_SIZE_W) >> DEPTH_DUMP_SHIFT) +
+			32768;
+		*dst++ = z >> 8;
+		*dst++ = z & 0xff;
+	}
+}
+
+static int
+write_pnm(const char *path, int channels, int maxval, const uint8_t *data,
+		int len)
+{
+	FILE *f;
+	int ok;
+
+	if (!(f = fopen(path, "wb"))) {
+		printf("golden: cannot write %s\n", path);
+		return 0;
+	}
+	fprintf(f, "P%c\n%d %d\n%d\n", channels == 3 ? '6' : '5', PL_SIZE_W,
+			PL_SIZE_H, maxval);
+	ok = fwrite(data, 1, len, f) == (size_t)len;
+	fclose(f);
+	return ok;
+}
+
+static int
+read_pnm(const char *path, int channels, int maxval, uint8_t *data, int len)
+{
+	FILE *f;
+	char magic;
+	int w, h, mv;
+	int ok;
+
+	if (!(f = fopen(path, "rb"))) {
+		return 0;
+	}
+	ok = fscanf(f, "P%c %d %d %d", &magic, &w, &h, &mv) == 4 &&
+		magic == (channels == 3 ? '6' : '5') && w == PL_SIZE_W &&
+		h == PL_SIZE_H && mv == maxval && fgetc(f) != EOF &&
+		fread(data, 1, len, f) == (size_t)len;
+	fclose(f);
+	return ok;
+}
+
+/* returns non-zero if the images match within tolerance */
+static int
+compare(const char *name, const char *suffix, const struct golden_opts *o,
+		int bps, int channels, int tol)
+{
+	char path[256];
+	int i, c, a, b, d, dmax, pmax;
+	int nbad = 0;
+	int maxval = bps == 2 ? 65535 : 255;
+	int len = NPIX * channels * bps;
+	const uint8_t *pa = img_cur;
+	const uint8_t *pb = img_ref;
+
+	snprintf(path, sizeof(path), "%s/%s%s.%s", o->ref_dir, name, suffix,
+			channels == 3 ? "ppm" : "pgm");
+	if (o->update) {
+		return write_pnm(path, channels, maxval, img_cur, len);
+	}
+	if (!read_pnm(path, channels, maxval, img_ref, len)) {
+		printf("golden: %-28s missing or bad reference %s\n", name, path);
+		return 0;
+	}
+
+	dmax = 0;
+	for (i = 0; i < NPIX; i++) {
+		pmax = 0;
+		for (c = 0; c < channels; c++) {
+			a = *pa++;
+			b = *pb++;
+			if (bps == 2) {
+				a = (a << 8) | *pa++;
+				b = (b << 8) | *pb++;
+			}
+			d = abs(a - b);
+			if (d > tol) {
+				nbad++;
+			}
+			if (d > pmax) {
+				pmax = d;
+			}
+		}
+		if (pmax > dmax) {
+			dmax = pmax;
+		}
+		img_diff[i] = pmax == 0 ? 0 : (pmax <= tol ? 96 : 255);
+	}
+
+	if (nbad > o->max_bad) {
+		printf("golden: %-28s %-6s FAIL max diff %d, %d samples over %d\n",
+			name, suffix[0] ? suffix + 1 : "color", dmax, nbad, tol);
+		snprintf(path, sizeof(path), "%s/%s%s_diff.pgm", o->out_dir, name,
+				suffix);
+		write_pnm(path, 1, 255, img_diff, NPIX);
+		return 0;
+	}
+	return 1;
+}
+
+static int
+check_scene(const struct golden_scene *sc, const struct golden_opts *o)
+{
+	char path[256];
+	int ok;
+
+	/* nothing is written, an update must not replace the reference */
+	if (sc->ready && !sc->ready()) {
+		printf("golden: %-28s FAIL input did not load\n", sc->name);
+		return 0;
+	}
+	PL_set_viewport(0, 0, PL_SIZE_W - 1, PL_SIZE_H - 1, 1);
+	PL_clear_vp(0, 0, 0);
+	PL_cur_tex = NULL;
+	PL_cull_mode = PL_CULL_BACK;
+	sc->draw();
+	PL_pipe_flush();
+	PL_set_viewport(0, 0, PL_SIZE_W - 1, PL_SIZE_H - 1, 1);
+
+	dump_video(img_cur);
+	snprintf(path, sizeof(path), "%s/%s.%s", o->out_dir, sc->name,
+			VIDEO_CHANNELS == 3 ? "ppm" : "pgm");
+	write_pnm(path, VIDEO_CHANNELS, 255, img_cur, NPIX * VIDEO_CHANNELS);
+	ok = compare(sc->name, "", o, 1, VIDEO_CHANNELS, o->tolerance);
+
+	dump_depth(img_cur);
+	snprintf(path, sizeof(path), "%s/%s_depth.pgm", o->out_dir, sc->name);
+	write_pnm(path, 1, 65535, img_cur, NPIX * 2);
+	ok &= compare(sc->name, "_depth", o, 2, 1, o->depth_tolerance);
+
+	return ok;
+}
+
+#define DAMAGE_FRAMES 32
+
+/* cubes sliding across and off the screen, the last frames are empty */
+static void
+draw_damage_frame(int f)
+{
+	int i;
+
+	PL_raster_mode = PL_TEXTURED;
+	/* camera y is screen x at rz = 0 */
+	PL_set_camera(0, (f < 26) ? (f - 13) * 12 : 2000, f * 4, 0, 0, 0);
+
+	for (i = 0; i < 3; i++) {
+		PL_mst_push();
+		PL_mst_translate(-30 + i * 30, -70 + i * 70, 300 + i * 40);
+		PL_mst_rotatey(PL_A256(f * 6 + i * 40));
+		PL_mst_rotatex(PL_A256(20));
+		PL_render_object(cube_textured);
+		PL_mst_pop();
+	}
+}
+
+/* FNV-1a, 64-bit */
+static uint64_t
+hash_bytes(const void *p, int n)
+{
+	const uint8_t *b = p;
+	uint64_t h = 14695981039346656037ull;
+
+	while (n--) {
+		h = (h ^ *b++) * 1099511628211ull;
+	}
+	return h;
+}
+
+/* Renders a moving camera the way the demo does with PL_DAMAGE, clearing
+ * and sending only the damaged area, then again with full clears. Every
+ * frame and the emulated panel must match the full clear frame. The runs
+ * are kept apart so PL_ZBANDS sees the same band sequence as the demo. */
+static int
+check_damage(void)
+{
+	static uint64_t fb_hash[DAMAGE_FRAMES], panel_hash[DAMAGE_FRAMES];
+	struct PL_RECT dirty, row;
+	int bytes = dynres_row_bytes(PL_SIZE_W) * PL_SIZE_H;
+	uint64_t h;
+	int f, y;
+
+	PL_set_viewport(0, 0, PL_SIZE_W - 1, PL_SIZE_H - 1, 1);
+	PL_cur_tex = NULL;
+	PL_cull_mode = PL_CULL_BACK;
+	PL_clear_vp(0, 0, 0);
+	memset(damage_panel, 0, sizeof(damage_panel));
+	damage_invalidate();
+	for (f = 0; f < DAMAGE_FRAMES; f++) {
+		damage_clear(0, 0, 0);
+		draw_damage_frame(f);
+		PL_pipe_flush();
+		if (damage_collect(&dirty)) {
+			row.x0 = dirty.x0;
+			row.x1 = dirty.x1;
+			for (y = dirty.y0; y <= dirty.y1; y++) {
+				row.y0 = row.y1 = y;
+				memcpy((uint8_t *)damage_panel + damage_offset(&row),
+					   (uint8_t *)PL_video_buffer + damage_offset(&row),
+					   damage_bytes(&row));
+			}
+		}
+		fb_hash[f] = hash_bytes(PL_video_buffer, bytes);
+		panel_hash[f] = hash_bytes(damage_panel, bytes);
+	}
+
+	for (f = 0; f < DAMAGE_FRAMES; f++) {
+		PL_clear_vp(0, 0, 0);
+		draw_damage_frame(f);
+		PL_pipe_flush();
+		h = hash_bytes(PL_video_buffer, bytes);
+		if (h != fb_hash[f]) {
+			printf("golden: %-28s FAIL frame %d differs from a full clear\n",
+				   "damage_motion", f);
+			return 0;
+		}
+		if (h != panel_hash[f]) {
+			printf("golden: %-28s FAIL frame %d panel is missing updates\n",
+				   "damage_motion", f);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+#ifdef PL_HOST
+#define LE32(v) (v) & 0xff, ((v) >> 8) & 0xff, ((v) >> 16) & 0xff, \
+	((uint32_t)(v) >> 24) & 0xff
+#define DMDB(ver, nv, np) 'D', 'M', 'D', 'B', (ver), 0, 0, 0, LE32(nv), LE32(np)
+
+static const uint8_t bin_magic[] = { 'D', 'M', 'D', 'X', 1, 0, 0, 0,
+	LE32(0), LE32(0) };
+static const uint8_t bin_version[] = { DMDB(9, 0, 0) };
+/* counts past the end of the file */
+static const uint8_t bin_truncated[] = { DMDB(1, 3, 1), LE32(0), LE32(0) };
+static const uint8_t bin_verts[] = { DMDB(1, 0x7fffffff, 0) };
+static const uint8_t bin_polys[] = { DMDB(1, 0, 0xffffffff) };
+/* a triangle on vertex 7 of 1 */
+static const uint8_t bin_index[] = { DMDB(1, 1, 1),
+	LE32(0), LE32(0), LE32(0), LE32(0),
+	LE32(0), LE32(255), LE32(3),
+	LE32(7), LE32(0), LE32(0), LE32(0), LE32(0), LE32(0),
+	LE32(0), LE32(0), LE32(0), LE32(7), LE32(0), LE32(0),
+	LE32(0), LE32(0), LE32(0), LE32(0), LE32(0), LE32(0) };
+
+/* last EXT_error message, host/hal.c */
+extern const char *host_last_error;
+
+/* malformed models, written to the output directory */
+static const struct {
+	const char *name;
+	const char *err;     /* the EXT_error it must be rejected with */
+	const char *text;    /* name.dmdl, or */
+	const uint8_t *bin;  /* name.bdmdl */
+	int size;
+} bad_models[] = {
+	{ "bad_missing", "cannot open dmdl file", NULL, NULL, 0 },
+	{ "bad_tokens", "invalid dmdl vertex count", "x1\n2\n", NULL, 0 },
+	{ "bad_text_truncated", "invalid dmdl vertex",
+	  "3\n0 0 0 0\n1 1 1 0\n", NULL, 0 },
+	{ "bad_text_verts", "invalid dmdl vertex count", "100000000\n", NULL, 0 },
+	{ "bad_text_polys", "invalid dmdl polygon count",
+	  "1\n0 0 0 0\n1000000\n", NULL, 0 },
+	{ "bad_text_index", "invalid dmdl polygon", "1\n0 0 0 0\n1\n0\n255\n\n3\n"
+	  "7\n0\n0\n0\n0\n0\n0\n0\n0\n0\n0\n0\n7\n0\n0\n0\n", NULL, 0 },
+	{ "bad_text_nverts", "invalid dmdl polygon",
+	  "1\n0 0 0 0\n1\n0\n255\n\n9\n", NULL, 0 },
+	{ "bad_magic", "not a binary dmdl file", NULL, bin_magic,
+	  sizeof(bin_magic) },
+	{ "bad_version", "unsupported binary dmdl version", NULL, bin_version,
+	  sizeof(bin_version) },
+	{ "bad_bin_truncated", "binary dmdl size mismatch", NULL, bin_truncated,
+	  sizeof(bin_truncated) },
+	{ "bad_bin_verts", "too many dmdl vertices", NULL, bin_verts,
+	  sizeof(bin_verts) },
+	{ "bad_bin_polys", "too many dmdl polygons", NULL, bin_polys,
+	  sizeof(bin_polys) },
+	{ "bad_bin_index", "invalid dmdl polygon", NULL, bin_index,
+	  sizeof(bin_index) },
+};
+
+/* Every file must be rejected for the expected reason with no object left
+ * behind. */
+static int
+check_importers(const struct golden_opts *o)
+{
+	struct PL_OBJ *obj;
+	char base[192], path[256];
+	unsigned int i;
+	int ok;
+	FILE *f;
+
+	for (i = 0; i < sizeof(bad_models) / sizeof(bad_models[0]); i++) {
+		snprintf(base, sizeof(base), "%s/%s", o->out_dir, bad_models[i].name);
+		snprintf(path, sizeof(path), "%s.%s", base,
+				 bad_models[i].bin ? "bdmdl" : "dmdl");
+		remove(path);
+		if (bad_models[i].text || bad_models[i].bin) {
+			if (!(f = fopen(path, "wb"))) {
+				printf("golden: cannot write %s\n", path);
+				return 0;
+			}
+			if (bad_models[i].bin) {
+				fwrite(bad_models[i].bin, 1, bad_models[i].size, f);
+			} else {
+				fputs(bad_models[i].text, f);
+			}
+			fclose(f);
+		}
+		obj = (struct PL_OBJ *)1;
+		host_last_error = NULL;
+		if (bad_models[i].bin) {
+			ok = import_dmdl_bin(base, &obj);
+		} else {
+			ok = import_dmdl(base, &obj);
+		}
+		if (ok || obj != NULL) {
+			if (ok) {
+				PL_delete_object(obj);
+				EXT_free(obj);
+			}
+			printf("golden: %-28s FAIL %s was accepted\n", "importer_errors",
+				   bad_models[i].name);
+			return 0;
+		}
+		if (!host_last_error || strcmp(host_last_error, bad_models[i].err)) {
+			printf("golden: %-28s FAIL %s: %s, expected %s\n",
+				   "importer_errors", bad_models[i].name,
+				   host_last_error ? host_last_error : "no error",
+				   bad_models[i].err);
+			return 0;
+		}
+	}
+	return 1;
+}
+#endif
+
+extern int
+golden_run(const struct golden_opts *o)
+{
+#ifdef PL_HOST
+	char path[256];
+#endif
+	unsigned int i;
+	int failed = 0;
+	int ran = 0;
+
+	if (mkdir(o->out_dir, 0755) && errno != EEXIST) {
+		printf("golden: cannot create %s\n", o->out_dir);
+		return 1;
+	}
+
+	maketex();
+	loadpack(o->ref_dir);
+	makequant();
+	PL_fov = 8;
+	PL_texture(NULL);
+	cube = PL_gen_box(32, 32, 32, PL_ALL, 200, 160, 120);
+	PL_texture(&checktex);
+	cube_textured = PL_gen_box(32, 32, 32, PL_ALL, 255, 255, 255);
+	PL_texture(NULL);
+#ifdef PL_HOST
+	snprintf(path, sizeof(path), "%s/house", o->ref_dir);
+	if (!import_dmdl(path, &house_text)) {
+		printf("golden: %s.dmdl did not import\n", path);
+	}
+	if (!import_dmdl_bin(path, &house_bin)) {
+		printf("golden: %s.bdmdl did not import\n", path);
+	}
+#endif
+
+	for (i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+		if (o->only && strcmp(o->only, scenes[i].name)) {
+			continue;
+		}
+		ran++;
+		if (!check_scene(&scenes[i], o)) {
+			failed++;
+		}
+	}
+	/* compares against itself, there is no reference to update */
+	if (!o->only || !strcmp(o->only, "damage_motion")) {
+		ran++;
+		if (!check_damage()) {
+			failed++;
+		}
+	}
+#ifdef PL_HOST
+	if (!o->only || !strcmp(o->only, "importer_errors")) {
+		ran++;
+		if (!check_importers(o)) {
+			failed++;
+		}
+	}
+#endif
+	printf("golden: %d of %d scenes %s\n", ran - failed, ran,
+		o->update ? "written" : "passed");
+
+	PL_delete_object(cube);
+	EXT_free(cube);
+	PL_delete_object(cube_textured);
+	EXT_free(cube_textured);
+#ifdef PL_HOST
+	PL_delete_object(house_text);
+	EXT_free(house_text);
+	PL_delete_object(house_bin);
+	EXT_free(house_bin);
+#endif
+	return failed;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+/* Golden image regression harness, see golden.c */
+
+struct golden_opts {
+	const char *ref_dir; /* checked-in reference images */
+	const char *out_dir; /* renders and diff images are written here */
+	const char *only;    /* run only the scene with this name, or NULL */
+	int update;          /* write references instead of comparing */
+	int tolerance;       /* max difference of a color sample */
+	int depth_tolerance; /* max difference of a depth sample */
+	int max_bad;         /* samples allowed past tolerance per image */
+};
+
+/* PL_init() must have been called with PL_SIZE_W x PL_SIZE_H buffers.
+ * Returns the number of images that did not match their reference. */
+extern int golden_run(const struct golden_opts *o);
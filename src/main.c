@@ -1,6 +1,9 @@
 #include "config.h"
 #include "pl.h"
 #include "framebuffer_effects.h"
+#include "frametime.h"
+#include "damage.h"
+#include "dynres.h"
 
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -12,19 +15,39 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(main);
 
+#ifdef APP_PACK
+#include "assets.h"
+#endif
+
+#ifdef APP_GOLDEN
+#include "golden.h"
+#ifdef CONFIG_ARCH_POSIX
+#include <posix_board_if.h>
+#endif
+#endif
+
 // intended for 48k dtcm
+#if defined(PL_COLOR_DEPTH_4)
+#define VIDEO_BYTES (PL_SIZE_W * PL_SIZE_H / 2)
+#else
+#define VIDEO_BYTES (PL_SIZE_W * PL_SIZE_H)
+#endif
 #if DT_HAS_CHOSEN(zephyr_dtcm)
-static __attribute__((section("DTCM"))) uint8_t video_buffer[SIZE_W * PL_SIZE_H];
+static __attribute__((section("DTCM"))) uint8_t video_buffer[VIDEO_BYTES];
 #else
-static uint8_t video_buffer[PL_SIZE_W * PL_SIZE_H];
+static uint8_t video_buffer[VIDEO_BYTES];
 #endif
 static int16_t depth_buffer[PL_SIZE_W * PL_SIZE_H];
+#ifdef PL_DYNRES
+/* upscaled rows on their way to the display */
+static uint8_t out_strip[DYNRES_STRIP_BYTES];
+#endif
 
 static struct PL_OBJ *cube;
 static struct PL_OBJ *cube_textured;
 
 static struct PL_TEX checktex;
-static int checker[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
+static PL_TEXEL checker[PL_REQ_TEX_DIM * PL_REQ_TEX_DIM];
 
 static void
 maketex(void)
@@ -48,9 +71,9 @@ maketex(void)
             }
             if (i == j || abs(i - j) < 3) {
                 /* thick red line along diagonal */
-                checker[i + j * PL_REQ_TEX_DIM] = 0xFF;
+                checker[i + j * PL_REQ_TEX_DIM] = PL_TEXEL_GREY(0xFF);
             } else {
-                checker[i + j * PL_REQ_TEX_DIM] = c;
+                checker[i + j * PL_REQ_TEX_DIM] = PL_TEXEL_GREY(c);
             }
         }
     }
@@ -59,11 +82,99 @@ maketex(void)
 
 #include "building_01.h"
 
+/* replaced by the pack's mesh of the same name when there is one */
+static const struct PL_OBJ_CONST *building = &building_01;
+#ifdef APP_PACK
+static struct PL_PACK pack;
+#endif
+
+#ifdef APP_GOLDEN
+static int
+env_int(const char *name, int def)
+{
+	const char *v = getenv(name);
+
+	return v ? atoi(v) : def;
+}
+
+/* golden image regression run, configured through the environment */
+static int
+golden_main(void)
+{
+	struct golden_opts o = {
+		.ref_dir = getenv("PL_GOLDEN_REF"),
+		.out_dir = getenv("PL_GOLDEN_OUT"),
+		.only = getenv("PL_GOLDEN_SCENE"),
+		.update = env_int("PL_GOLDEN_UPDATE", 0),
+		.tolerance = env_int("PL_GOLDEN_TOL", 0),
+		.depth_tolerance = env_int("PL_GOLDEN_DEPTH_TOL", 0),
+		.max_bad = env_int("PL_GOLDEN_MAX_BAD", 0),
+	};
+	int failed;
+
+	if (!o.ref_dir) {
+		o.ref_dir = "golden";
+	}
+	if (!o.out_dir) {
+		o.out_dir = "golden_out";
+	}
+	failed = golden_run(&o);
+#ifdef CONFIG_ARCH_POSIX
+	posix_exit(failed != 0);
+#endif
+	return failed;
+}
+#endif
+
 static const struct device *display_device = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
 
+#if defined(PL_COLOR_DEPTH_4)
+/* Zephyr has no 4-bit grey pixel format, the panel stays in L8 and packed
+ * rows are widened to it a strip at a time */
+#define L8_STRIP_BYTES 4096
+static uint8_t l8_strip[L8_STRIP_BYTES];
+
+/* w x h pixels of packed rows pitch bytes apart, w even */
+static void
+write_l4(int x, int y, int w, int h, const uint8_t *src, int pitch)
+{
+	struct display_buffer_descriptor desc;
+	int rows = L8_STRIP_BYTES / w;
+	int i, j, n;
+	uint8_t *d;
+
+	desc.width = w;
+	desc.pitch = w;
+	for (; h > 0; h -= n, y += n) {
+		n = MIN(rows, h);
+		d = l8_strip;
+		for (j = 0; j < n; j++, src += pitch) {
+			/* left pixel in the high nibble, v * 17 spans 0..255 */
+			for (i = 0; i < w >> 1; i++) {
+				*d++ = (src[i] & 0xf0) | (src[i] >> 4);
+				*d++ = (uint8_t)(src[i] << 4) | (src[i] & 0x0f);
+			}
+		}
+		desc.height = n;
+		desc.buf_size = n * w;
+		display_write(display_device, x, y, &desc, l8_strip);
+	}
+}
+#endif
+
 int main()
 {
+#if !defined(PL_COLOR_DEPTH_4)
 	struct display_buffer_descriptor buf_desc;
+#endif
+#ifdef PL_DYNRES
+	struct display_capabilities caps;
+	struct PL_RECT out;
+	int out_w, out_h, strip_rows, rows, y;
+#elif defined(PL_DAMAGE)
+	struct PL_RECT dirty;
+#endif
+	struct PL_STATS stats;
 	int sinvar = 0;
 	timing_t start_time, end_time, dstart_time, rend_time, rstart_time;
 	uint32_t total_time_us, render_time_us, draw_time_us;
@@ -88,6 +199,20 @@ int main()
 
 	PL_init(video_buffer, depth_buffer, PL_SIZE_W, PL_SIZE_H);
 
+#ifdef APP_GOLDEN
+	return golden_main();
+#endif
+
+#ifdef APP_PACK
+	if (assets_open(&pack)) {
+		int m = PL_pack_find_mesh(&pack, "building_01");
+
+		if (m >= 0) {
+			building = &pack.meshes[m];
+		}
+	}
+#endif
+
 	//PL_set_viewport(64, 32, 192 - 1, 96 - 1, 1);
 
 	PL_texture(NULL);
@@ -104,15 +229,39 @@ int main()
 	PL_cull_mode = PL_CULL_BACK;
 	PL_raster_mode = PL_WIREFRAME;
 
-	buf_desc.buf_size = PL_SIZE_W * PL_SIZE_H;
+#if !defined(PL_COLOR_DEPTH_4)
+	buf_desc.buf_size = VIDEO_BYTES;
 	buf_desc.width = PL_SIZE_W;
 	buf_desc.height = PL_SIZE_H;
 	buf_desc.pitch = PL_SIZE_W;
+#endif
+#ifdef PL_DYNRES
+	display_get_capabilities(display_device, &caps);
+	dynres_fit(caps.x_resolution, caps.y_resolution, &out);
+	out_w = out.x1 - out.x0 + 1;
+	out_h = out.y1 - out.y0 + 1;
+	strip_rows = DYNRES_STRIP_BYTES / dynres_row_bytes(out_w);
+#if !defined(PL_COLOR_DEPTH_4)
+	buf_desc.width = out_w;
+	buf_desc.pitch = out_w;
+#endif
+#endif
 
 	while (1) {
 		start_time = timing_counter_get();
+		PL_TRACE_BEGIN(PL_TRACE_FRAME);
+		PL_stats_reset();
+#ifdef PL_DYNRES
+		/* viewport becomes this frame's render rectangle */
+		dynres_begin();
+#endif
+#if defined(PL_DAMAGE) && !defined(PL_DYNRES)
+		/* only what the last frame drew needs clearing */
+		damage_clear(0, 0, 0);
+#else
 		/* clear viewport to black */
 		PL_clear_vp(0, 0, 0);
+#endif
 		PL_polygon_count = 0;
 
 		rstart_time = timing_counter_get();
@@ -182,23 +331,66 @@ int main()
 			PL_mst_push();
 			PL_mst_translate(-10, -100, 1200 + close);
 			//PL_mst_rotatex(sinvar >> 2);
-			PL_mst_rotatex(sinvar << 1);
-			PL_mst_rotatey(128);
-			PL_mst_rotatez(64);
+			/* 1.5 degrees a frame, between the 256ths of a turn */
+			PL_mst_rotatex((sinvar % 240) * PL_TRIGMAX / 240);
+			PL_mst_rotatey(PL_A256(128));
+			PL_mst_rotatez(PL_A256(64));
 			//PL_mst_scale(PL_P_ONE * ((sinvar & 0xff) + 128) >> 8, PL_P_ONE, PL_P_ONE);
-			PL_render_object_const(&building_01);
+			PL_render_object_const(building);
 			PL_mst_pop();
 		}
+		/* queued polygons must be in the buffer before it is sent */
+		PL_pipe_flush();
+		/* see "frametime stats" */
+		PL_stats_get(&stats);
+		frametime_record_stats(&stats);
 		rend_time = timing_counter_get();
 		dstart_time = timing_counter_get();
+		PL_TRACE_BEGIN(PL_TRACE_DISPLAY);
+#ifdef PL_DYNRES
+		for (y = 0; y < out_h; y += strip_rows) {
+			rows = MIN(strip_rows, out_h - y);
+			dynres_upscale(out_strip, out_w, out_h, y, rows);
+#if defined(PL_COLOR_DEPTH_4)
+			write_l4(out.x0, out.y0 + y, out_w, rows, out_strip,
+					 dynres_row_bytes(out_w));
+#else
+			buf_desc.height = rows;
+			buf_desc.buf_size = rows * dynres_row_bytes(out_w);
+			display_write(display_device, out.x0, out.y0 + y, &buf_desc,
+						  out_strip);
+#endif
+		}
+#elif defined(PL_DAMAGE)
+		if (damage_collect(&dirty)) {
+#if defined(PL_COLOR_DEPTH_4)
+			write_l4(dirty.x0, dirty.y0, dirty.x1 - dirty.x0 + 1,
+					 dirty.y1 - dirty.y0 + 1, video_buffer + damage_offset(&dirty),
+					 PL_SIZE_W / 2);
+#else
+			buf_desc.width = dirty.x1 - dirty.x0 + 1;
+			buf_desc.height = dirty.y1 - dirty.y0 + 1;
+			buf_desc.buf_size = damage_bytes(&dirty);
+			display_write(display_device, dirty.x0, dirty.y0, &buf_desc,
+						  video_buffer + damage_offset(&dirty));
+#endif
+		}
+#elif defined(PL_COLOR_DEPTH_4)
+		write_l4(0, 0, PL_SIZE_W, PL_SIZE_H, video_buffer, PL_SIZE_W / 2);
+#else
 		display_write(display_device, 0, 0, &buf_desc, video_buffer);
+#endif
+		PL_TRACE_END(PL_TRACE_DISPLAY);
+		PL_TRACE_END(PL_TRACE_FRAME);
 		end_time = timing_counter_get();
 		total_time_us = timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time)) / 1000;
 		render_time_us = timing_cycles_to_ns(timing_cycles_get(&rstart_time, &rend_time)) / 1000;
 		draw_time_us = timing_cycles_to_ns(timing_cycles_get(&dstart_time, &end_time)) / 1000;
-		printf("total us: %u ms:%u fps:%u\n", total_time_us, (total_time_us) / 1000, 1000000 / (total_time_us != 0 ? total_time_us : 1));
-		printf("display us:%u render us:%u render fps: %u\n", draw_time_us, render_time_us, 1000000 / (render_time_us != 0 ? render_time_us : 1));
-		printf("rendered %u Polygons, %u polygons per second\n", PL_polygon_count, PL_polygon_count * 1000000 / (render_time_us != 0 ? render_time_us : 1));
+		/* see the "frametime" shell command */
+		frametime_record(total_time_us, render_time_us, draw_time_us);
+#ifdef PL_DYNRES
+		dynres_end(render_time_us);
+#endif
 		sinvar+=1;
 		close+=close_add*5;
 		if (close > 1000)
@@ -0,0 +1,73 @@
+import argparse
+import struct
+from pathlib import Path
+
+# Converts a text DMDL model to the binary form import_dmdl_bin() loads in
+# bulk, see pl/importer.c for the layout.
+
+parser = argparse.ArgumentParser(
+                    prog='dmdl2bin',
+                    description='convert a DMDL file to binary DMDL (.bdmdl)')
+
+parser.add_argument('filename_in')
+parser.add_argument('filename_out', nargs='?',
+                    help='defaults to filename_in with the .bdmdl suffix')
+
+args = parser.parse_args()
+
+DMDB_VERSION = 1
+POLY_VLEN = 3
+MAX_POLY_VERTS = 6 # including the repeated first vertex
+
+lines = Path(args.filename_in).read_text().splitlines()
+pos = 0
+
+def line():
+	global pos
+	if pos >= len(lines):
+		raise SystemExit(args.filename_in + ": unexpected end of file")
+	pos += 1
+	return lines[pos - 1].split()
+
+def field():
+	return int(line()[0])
+
+n_verts = field()
+vertices = []
+for i in range(n_verts):
+	x, y, z = (int(c) for c in line()[:3])
+	vertices.append((x, y, z))
+
+n_polys = field()
+polys = []
+for i in range(n_polys):
+	tex = field()
+	color = field()
+	line()
+	nv = field() & 0xf
+	if not 3 <= nv < MAX_POLY_VERTS:
+		raise SystemExit(args.filename_in + ": polygon " + str(i) + " has " +
+						 str(nv) + " vertices")
+	verts = []
+	# [index, unused, U, V] per vertex, the first one repeated
+	for k in range((nv + 1) * 4):
+		if k % 4 == 1:
+			line()
+		else:
+			verts.append(field())
+	for k in range(0, len(verts), POLY_VLEN):
+		if not 0 <= verts[k] < n_verts:
+			raise SystemExit(args.filename_in + ": polygon " + str(i) +
+							 " uses vertex " + str(verts[k]))
+	verts += [0] * (MAX_POLY_VERTS * POLY_VLEN - len(verts))
+	polys.append((tex, color, nv, verts))
+
+out = bytearray(struct.pack("<4s2H2I", b"DMDB", DMDB_VERSION, 0, n_verts, n_polys))
+for x, y, z in vertices:
+	out += struct.pack("<4i", x, y, z, 0)
+for tex, color, nv, verts in polys:
+	out += struct.pack("<" + str(3 + len(verts)) + "i", tex, color, nv, *verts)
+
+filename_out = args.filename_out or str(Path(args.filename_in).with_suffix(".bdmdl"))
+with open(filename_out, "xb") as file_out:
+	file_out.write(out)
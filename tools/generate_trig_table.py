@@ -0,0 +1,21 @@
+import math
+
+# quarter-wave sine tables for PL_sin/PL_cos, one per PL_TRIG_TABLE_BITS
+# entry i = sin(i / steps_per_quarter * pi / 2) * 32768, truncated like
+# the original 256 entry table
+
+file_out = open("trig_table.h", "wt")
+
+file_out.write("#pragma once\n/* generated by tools/generate_trig_table.py */\n")
+
+for bits in range(8, 13):
+	quarter = 1 << (bits - 2)
+	file_out.write("#" + ("if" if bits == 8 else "elif") + " PL_TRIG_TABLE_BITS == " + str(bits) + "\n")
+	file_out.write("const uint16_t PL_sin_q[" + str(quarter + 1) + "] = {\n")
+	for i in range(0, quarter + 1):
+		v = int(math.floor(math.sin(i * math.pi / 2 / quarter) * 32768 + 1e-9))
+		file_out.write(str(v) + ",")
+		if i % 12 == 11:
+			file_out.write("\n")
+	file_out.write("\n};\n")
+file_out.write("#else\n#error \"no trig table for PL_TRIG_TABLE_BITS, extend tools/generate_trig_table.py\"\n#endif\n")
@@ -0,0 +1,114 @@
+import argparse
+import re
+from pathlib import Path
+import plpack
+
+# Converts a C header written by obj2ctexture.py to the asset pack
+# obj2ctexture.py --pack writes for the same model, for models whose
+# source OBJ and images are not at hand (include/building_01.h).
+
+parser = argparse.ArgumentParser(
+                    prog='h2pack',
+                    description='convert an obj2ctexture.py header to a binary asset pack')
+
+parser.add_argument('filename_in')
+parser.add_argument('filename_out', nargs='?',
+                    help='defaults to filename_in with the .plpk suffix')
+parser.add_argument('--size', type=int, default=5,
+                    help='log2 texture side of textures without .lw / .lh, '
+                    'PL_TEXTURE_SIZE_SHIFT of the build the header was for')
+
+args = parser.parse_args()
+
+P_ONE = 1 << 15 # PL_P_ONE
+
+src = Path(args.filename_in).read_text()
+
+def fail(msg):
+	raise SystemExit(args.filename_in + ": " + msg)
+
+def values(body):
+	# G_(g) grey texels keep g, they are 8-bit in a pack
+	return [int(v) for v in re.findall(r"-?\d+", re.sub(r"G_\((\d+)\)", r"\1", body))]
+
+def fields(body):
+	return dict(re.findall(r"\.(\w+) = ([^,\n]+?)\s*,", body))
+
+m = re.search(r"#if PL_TEXEL_BITS != (\d+)", src)
+texel_bits = int(m.group(1)) if m else 8
+
+arrays = {}
+for m in re.finditer(r"static const (\w+) (\w+)\[\d*\] = \{(.*?)\};", src, re.S):
+	arrays[m.group(2)] = (m.group(1), m.group(3))
+
+m = re.search(r"static const struct PL_OBJ_CONST (\w+) = \{(.*?)\n\};", src, re.S)
+if not m:
+	fail("no PL_OBJ_CONST")
+data_name, obj = m.group(1), m.group(2)
+of = fields(obj)
+vname = of.get("verts16") or of.get("verts8") or of.get("verts")
+if vname not in arrays:
+	fail("no vertex array")
+vertex_type = arrays[vname][0]
+vlen = 3 if vertex_type == "int8_t" else 4
+vs = values(arrays[vname][1])
+vertex_rows = [tuple(vs[i:i + vlen]) for i in range(0, len(vs), vlen)]
+if len(vertex_rows) != int(of["n_verts"]):
+	fail("vertex count does not match .n_verts")
+
+quant = None
+m = re.search(r"\.quant = \{ \.scale = \{(.*?)\}, \.off = \{(.*?)\} \}", obj)
+if m:
+	quant = (values(m.group(1)), values(m.group(2)))
+	# model space bounds, as the transform rebuilds them
+	model = [tuple(v[i] * quant[0][i] // P_ONE + quant[1][i] for i in range(3))
+			 for v in vertex_rows]
+else:
+	model = vertex_rows
+bounds = [min(v[i] for v in model) for i in range(3)] + \
+		 [max(v[i] for v in model) for i in range(3)]
+
+# textures grouped by the array they sample, in header order
+FMTS = {"PL_TEX_I4": 1, "PL_TEX_I2": 2}
+stores = {}
+tex_index = {}
+for m in re.finditer(r"static const struct PL_TEX_CONST (\w+)texture = \{(.*?)\};", src, re.S):
+	name, f = m.group(1), fields(m.group(2))
+	fmt = FMTS.get(f.get("fmt"), 0)
+	arr = f.get("idx" if fmt else "data")
+	if arr not in arrays:
+		fail(name + ": texel array missing")
+	if arr not in stores:
+		data = values(arrays[arr][1])
+		data = bytes(data) if fmt else plpack.texels(data, texel_bits)
+		pal = plpack.texels(values(arrays[f["pal"]][1]), texel_bits) if fmt else None
+		stores[arr] = (data, pal, [])
+	lw = int(f.get("lw", args.size))
+	lh = int(f.get("lh", args.size))
+	tex_index[name] = sum(len(st[2]) for st in stores.values())
+	stores[arr][2].append((name[len(data_name):], fmt,
+						   int(f.get("layout") == "PL_TEX_MORTON"),
+						   int(f.get("levels", 1)), 0, lw, lh,
+						   int(f.get("alw", lw)), int(f.get("alh", lh)),
+						   int(f.get("ax", 0)), int(f.get("ay", 0))))
+if list(tex_index.values()) != list(range(len(tex_index))):
+	fail("textures sharing an array are not adjacent")
+
+polys = []
+m = re.search(r"static const struct PL_POLY_CONST \w+\[\] = \{(.*?)\n\};", src, re.S)
+if not m:
+	fail("no PL_POLY_CONST array")
+for p in re.finditer(r"\{ \.tex = (?:&(\w+)texture|NULL), \.n_verts = (\d+), "
+					 r"\.verts = \{(.*?)\},\s*\.color = (\d+)\}", m.group(1)):
+	v = values(p.group(3))
+	fv = [tuple(v[i:i + plpack.POLY_VLEN]) for i in range(0, len(v), plpack.POLY_VLEN)]
+	if len(fv) != int(p.group(2)) + 1:
+		fail("polygon with " + p.group(2) + " vertices lists " + str(len(fv)))
+	tex = tex_index[p.group(1)] if p.group(1) else plpack.PACK_NO_TEX
+	polys.append((tex, int(p.group(4)), fv))
+if len(polys) != int(of["n_polys"]):
+	fail("polygon count does not match .n_polys")
+
+out = args.filename_out or str(Path(args.filename_in).with_suffix(".plpk"))
+Path(out).write_bytes(plpack.pack_image(data_name, texel_bits, vertex_type, vertex_rows,
+										bounds, quant, list(stores.values()), polys))
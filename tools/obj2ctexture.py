@@ -1,5 +1,6 @@
 import pywavefront
 import argparse
+import plpack
 from pathlib import Path
 from PIL import Image
 
@@ -9,42 +10,335 @@ parser = argparse.ArgumentParser(
 
 parser.add_argument('filename_in')
 parser.add_argument('filename_out')
+parser.add_argument('--depth', type=int, choices=[0, 16, 32], default=0,
+                    help='store color texels as R5G6B5 (16) or X8R8G8B8 (32) for that '
+                    'PL_COLOR_DEPTH, the default 0 stores grey that builds at any depth')
+parser.add_argument('--index', type=int, choices=[0, 2, 4], default=0,
+                    help='store 4 or 2-bit palette indices (PL_TEX_I4/PL_TEX_I2) '
+                    'with a 16 or 4 entry palette instead of a texel per pixel')
+parser.add_argument('--morton', action='store_true',
+                    help='store texels in Z-order (PL_TEX_MORTON), neighbours in v '
+                    'stay close in memory at any orientation')
+parser.add_argument('--mips', action='store_true',
+                    help='append box filtered mip levels down to 1x1, the kernels '
+                    'sample minified spans from the smaller levels')
+parser.add_argument('--size', type=int, default=5,
+                    help='log2 of the largest texture side, each texture keeps the '
+                    'power of two size at or under its image up to this')
+parser.add_argument('--atlas', type=int, default=0,
+                    help='pack textures smaller than 1 << ATLAS square into shared '
+                    'atlases of that size, 0 stores every texture on its own')
+parser.add_argument('--quant', type=int, choices=[0, 16, 8], default=0,
+                    help='store vertices as int16 [x, y, z, 0] or packed int8 [x, y, z] '
+                    'quantized to the mesh bounds, with a per axis scale and offset '
+                    '(PL_QUANT) the transform folds into its matrix')
+parser.add_argument('--pack', action='store_true',
+                    help='write a binary asset pack (see ASSET PACK in pl.h) the '
+                    'app maps at run time instead of a C header, grey texels are 8-bit')
 
 args = parser.parse_args()
 
 object_in = pywavefront.Wavefront(args.filename_in, collect_faces=True)
-file_out = open(args.filename_out, "xt")
+file_out = open(args.filename_out, "xb" if args.pack else "xt")
 
 data_name = Path(args.filename_in).stem
 data_vertices_name = data_name + "_vertices"
 data_polys_name = data_name + "_polys"
 
 MUL_FLOAT = 100
-TEXSQUARE_SIZE = 32
 
-file_out.write("#pragma once\nstatic const int " +  data_vertices_name + "[] = {\n")
+P_ONE = 1 << 15 # PL_P_ONE
 
-for count, vertex in enumerate(object_in.vertices):
-	x = -int(vertex[0] * MUL_FLOAT)
-	y = -int(vertex[1] * MUL_FLOAT)
-	z = -int(vertex[2] * MUL_FLOAT)
-	w = 0
-	file_out.write(str(x) + "," + str(y) + "," + str(z) + "," + str(w) + ",\n")
+fvertices = [tuple(-c * MUL_FLOAT for c in vertex[:3]) for vertex in object_in.vertices]
+vertices = [tuple(int(c) for c in v) for v in fvertices]
 
-file_out.write("};\n")
+# 16-bit vertices take the batched transform (PL_mst_xf_modelview_vec16)
+verts16 = all(-32768 <= c <= 32767 for v in vertices for c in v)
+quant = None
+if args.quant:
+	# centre on the bounds, the extremes land on +-qmax
+	qmax = (1 << (args.quant - 1)) - 1
+	lo = [min(v[i] for v in fvertices) for i in range(3)]
+	hi = [max(v[i] for v in fvertices) for i in range(3)]
+	off = [int(round((lo[i] + hi[i]) / 2)) for i in range(3)]
+	scale = [max(1, -(-int(max(hi[i] - off[i], off[i] - lo[i]) * P_ONE) // qmax))
+			 for i in range(3)]
+	quant = (scale, off)
+	qverts = [tuple(max(-qmax, min(qmax, int(round((v[i] - off[i]) * P_ONE / scale[i]))))
+					for i in range(3)) for v in fvertices]
+	verts16 = args.quant == 16
+	vertex_rows = [v + (0,) for v in qverts] if verts16 else qverts
+	vertex_type = "int16_t" if verts16 else "int8_t"
+else:
+	vertex_rows = [v + (0,) for v in vertices]
+	vertex_type = "int16_t" if verts16 else "int"
+
+if not args.pack:
+	file_out.write("#pragma once\nstatic const " + vertex_type + " " +  data_vertices_name + "[] = {\n")
+	for row in vertex_rows:
+		file_out.write(",".join(str(c) for c in row) + ",\n")
+	file_out.write("};\n")
+
+# texels are stored in the video buffer format (PL_TEXEL), grey levels go
+# through PL_TEXEL_GREY so the header builds at every color depth
+def texel_value(p):
+	if args.depth == 16:
+		return (p[0] >> 3) << 11 | (p[1] >> 2) << 5 | p[2] >> 3
+	if args.depth == 32:
+		return p[0] << 16 | p[1] << 8 | p[2]
+	return p
+
+def texel(p):
+	if args.depth:
+		return str(texel_value(p))
+	return "G_(" + str(p) + ")"
+
+if args.pack:
+	pass
+elif args.depth:
+	file_out.write("#if PL_TEXEL_BITS != " + str(args.depth) + "\n")
+	file_out.write("#error \"" + args.filename_out + " has " + str(args.depth) + "-bit texels, rerun obj2ctexture.py\"\n")
+	file_out.write("#endif\n")
+else:
+	file_out.write("/* grey texels, stored in the video buffer format */\n")
+	file_out.write("#define G_(g) PL_TEXEL_GREY(g)\n")
+
+# texel (u, v) of a level goes to PL_tex_index(tex, level, u, v)
+def dilate(x):
+	return sum(((x >> i) & 1) << (2 * i) for i in range(8))
+
+def texel_order(pixels, width):
+	if not args.morton:
+		return pixels
+	out = [None] * len(pixels)
+	for i, p in enumerate(pixels):
+		u, v = i % width, i // width
+		out[dilate(u) | dilate(v) << 1] = p
+	return out
+
+def log2(n):
+	return n.bit_length() - 1
+
+# power of two sides at or under the image's, square for PL_TEX_MORTON
+def texture_size(img):
+	lw = min(log2(img.width), args.size)
+	lh = min(log2(img.height), args.size)
+	if args.morton:
+		lw = lh = max(lw, lh)
+	return lw, lh
+
+# level 0 and with --mips the smaller levels after it, see PL_tex_mip_offset
+def mip_chain(img):
+	levels = [img]
+	while args.mips and min(levels[-1].size) > 1:
+		w, h = levels[-1].size
+		levels.append(img.resize((w // 2, h // 2), Image.BOX))
+	return levels
+
+def chain_pixels(levels):
+	out = []
+	for lvl in levels:
+		out += texel_order(list(lvl.getdata()), lvl.width)
+	return out
+
+# A texel array holds one texture or an atlas of them. Atlas textures sit
+# at multiples of their size, so their mip levels stay aligned too.
+class Store:
+	def __init__(self, name, lw, lh):
+		self.name = name
+		self.lw, self.lh = lw, lh
+		self.textures = []
+
+	def fits(self, x, y, lw, lh):
+		if x + (1 << lw) > (1 << self.lw) or y + (1 << lh) > (1 << self.lh):
+			return False
+		for t in self.textures:
+			if (x < t.ax + (1 << t.lw) and t.ax < x + (1 << lw) and
+				y < t.ay + (1 << t.lh) and t.ay < y + (1 << lh)):
+				return False
+		return True
+
+	def place(self, t):
+		for y in range(0, 1 << self.lh, 1 << t.lh):
+			for x in range(0, 1 << self.lw, 1 << t.lw):
+				if self.fits(x, y, t.lw, t.lh):
+					t.ax, t.ay = x, y
+					self.textures.append(t)
+					return True
+		return False
+
+class Texture:
+	def __init__(self, name, img):
+		self.name = name
+		self.lw, self.lh = texture_size(img)
+		self.img = img.resize((1 << self.lw, 1 << self.lh))
+		self.ax = self.ay = 0
 
+textures = {}
 for name, value in object_in.materials.items():
 	if value.texture:
-		tex = Image.open(value.texture.find())
-		tex = tex.resize((TEXSQUARE_SIZE, TEXSQUARE_SIZE))
-		tex = tex.convert("L")
-		file_out.write("static const int " +  data_name + name + "texturedata[" + str(TEXSQUARE_SIZE * TEXSQUARE_SIZE) + "] = {\n")
-		for p in list(tex.getdata()):
-			file_out.write(str(p) + ",")
-		file_out.write("};\n")
-		file_out.write("static const struct PL_TEX_CONST " +  data_name + name + "texture = {\n")
-		file_out.write(".data = " + data_name + name + "texturedata ,\n")
-		file_out.write("};\n")
+		img = Image.open(value.texture.find())
+		img = img.convert("RGB" if args.depth else "L")
+		textures[name] = Texture(data_name + name, img)
+
+stores = []
+atlases = []
+# largest first keeps the first fit packing tight
+for t in sorted(textures.values(), key=lambda t: (-(t.lw + t.lh), t.name)):
+	if args.atlas and t.lw <= args.atlas and t.lh <= args.atlas and \
+		t.lw + t.lh < 2 * args.atlas:
+		for a in atlases:
+			if a.place(t):
+				break
+		else:
+			a = Store(data_name + "atlas" + str(len(atlases)), args.atlas, args.atlas)
+			atlases.append(a)
+			stores.append(a)
+			a.place(t)
+		t.store = a
+	else:
+		t.store = Store(t.name, t.lw, t.lh)
+		t.store.textures.append(t)
+		stores.append(t.store)
+
+def store_image(st):
+	img = Image.new("RGB" if args.depth else "L", (1 << st.lw, 1 << st.lh))
+	for t in st.textures:
+		img.paste(t.img, (t.ax, t.ay))
+	return img
+
+# position of a texel in the store like PL_tex_index, for byte alignment
+def store_index(st, level, x, y):
+	n = sum((1 << (st.lw - i)) * (1 << (st.lh - i)) for i in range(level))
+	if args.morton:
+		return n + (dilate(x) | dilate(y) << 1)
+	return n + (x | y << (st.lw - level))
+
+def texture_levels(t, nlevels):
+	n = min(nlevels, min(t.lw, t.lh) + 1)
+	if args.index:
+		# the kernels step idx by whole bytes to a level's first texel
+		while n > 1 and store_index(t.store, n - 1, t.ax >> (n - 1),
+									t.ay >> (n - 1)) % (8 // args.index):
+			n -= 1
+	return n
+
+# indices are packed in texel order, the first pixel in the low bits
+def indexed_data(levels):
+	n = 1 << args.index
+	# one palette for all levels and every texture of an atlas
+	q = levels[0].quantize(colors=n)
+	levels = [q] + [l.convert("RGB").quantize(palette=q) for l in levels[1:]]
+	pal = q.getpalette()[:3 * n]
+	pal += [0] * (3 * n - len(pal))
+	pal = [tuple(pal[3 * i:3 * i + 3]) if args.depth else pal[3 * i] for i in range(n)]
+	per_byte = 8 // args.index
+	idx = chain_pixels(levels)
+	idx += [0] * (-len(idx) % per_byte)
+	data = []
+	for i in range(0, len(idx), per_byte):
+		b = 0
+		for k in range(per_byte):
+			b |= idx[i + k] << (k * args.index)
+		data.append(b)
+	return pal, data
+
+def write_indexed(st, levels):
+	pal, data = indexed_data(levels)
+	file_out.write("static const PL_TEXEL " + st.name + "texturepal[" + str(len(pal)) + "] = {\n")
+	for p in pal:
+		file_out.write(texel(p) + ",")
+	file_out.write("};\n")
+	file_out.write("static const uint8_t " + st.name + "textureidx[" + str(len(data)) + "] = {\n")
+	for b in data:
+		file_out.write(str(b) + ",")
+	file_out.write("};\n")
+
+def write_direct(st, levels):
+	pixels = chain_pixels(levels)
+	file_out.write("static const PL_TEXEL " + st.name + "texturedata[" + str(len(pixels)) + "] = {\n")
+	for p in pixels:
+		file_out.write(texel(p) + ",")
+	file_out.write("};\n")
+
+def write_texture(t, nlevels):
+	st = t.store
+	file_out.write("static const struct PL_TEX_CONST " + t.name + "texture = {\n")
+	if args.index:
+		file_out.write(".fmt = " + ("PL_TEX_I4" if args.index == 4 else "PL_TEX_I2") + ",\n")
+		file_out.write(".idx = " + st.name + "textureidx,\n")
+		file_out.write(".pal = " + st.name + "texturepal,\n")
+	else:
+		file_out.write(".data = " + st.name + "texturedata ,\n")
+	if args.morton:
+		file_out.write(".layout = PL_TEX_MORTON,\n")
+	levels = texture_levels(t, nlevels)
+	if levels > 1:
+		file_out.write(".levels = " + str(levels) + ",\n")
+	file_out.write(".lw = " + str(t.lw) + ", .lh = " + str(t.lh) + ",\n")
+	if st.name != t.name:
+		file_out.write(".ax = " + str(t.ax) + ", .ay = " + str(t.ay) + ",\n")
+		file_out.write(".alw = " + str(st.lw) + ", .alh = " + str(st.lh) + ",\n")
+	file_out.write("};\n")
+
+# [(vertex, u, v)] of a face, the first repeated after the last, texture
+# coordinates in texels of the material's texture
+def face_verts(mesh, faceid, face):
+	t = textures.get(mesh.materials[0].name)
+	tex_w = 1 << t.lw if t else 1 << args.size
+	tex_h = 1 << t.lh if t else 1 << args.size
+	mv = mesh.materials[0].vertices
+	out = []
+	for k in (0, 1, 2, 0):
+		u, v = mv[faceid * 5 * 3 + k * 5], mv[faceid * 5 * 3 + k * 5 + 1]
+		out.append((face[k], int(u * tex_w), int(v * tex_h)))
+	return out
+
+# Binary asset pack, see tools/plpack.py
+def write_pack():
+	texel_bits = args.depth if args.depth else 8
+	stores_out = []
+	for st in stores:
+		levels = mip_chain(store_image(st))
+		pal = None
+		if args.index:
+			pal, data = indexed_data(levels)
+			pal = plpack.texels([texel_value(p) for p in pal], texel_bits)
+			data = bytes(data)
+		else:
+			data = plpack.texels([texel_value(p) for p in chain_pixels(levels)],
+								 texel_bits)
+		fmt = {0: 0, 4: 1, 2: 2}[args.index]
+		stores_out.append((data, pal, [(t.name[len(data_name):], fmt, int(args.morton),
+										texture_levels(t, len(levels)), 0,
+										t.lw, t.lh, st.lw, st.lh, t.ax, t.ay)
+									   for t in st.textures]))
+
+	tex_list = [t for st in stores for t in st.textures]
+	tex_index = {t.name: i for i, t in enumerate(tex_list)}
+	polys = []
+	for mesh in object_in.mesh_list:
+		tex = tex_index.get(data_name + mesh.materials[0].name, plpack.PACK_NO_TEX)
+		for faceid, face in enumerate(mesh.faces):
+			polys.append((tex, 0xFF, face_verts(mesh, faceid, face)))
+
+	bounds = [min(v[i] for v in vertices) for i in range(3)] + \
+			 [max(v[i] for v in vertices) for i in range(3)]
+	file_out.write(plpack.pack_image(data_name, texel_bits, vertex_type, vertex_rows,
+									 bounds, quant, stores_out, polys))
+
+if args.pack:
+	write_pack()
+	raise SystemExit
+
+for st in stores:
+	levels = mip_chain(store_image(st))
+	if args.index:
+		write_indexed(st, levels)
+	else:
+		write_direct(st, levels)
+	for t in st.textures:
+		write_texture(t, len(levels))
 
 
 file_out.write("static const struct PL_POLY_CONST " +  data_polys_name + "[] = {\n")
@@ -71,14 +365,8 @@ for mesh in object_in.mesh_list:
 		#face0uv = get_uv(face[0], mesh.materials[0])
 		#face1uv = get_uv(face[1], mesh.materials[0])
 		#face2uv = get_uv(face[2], mesh.materials[0])
-		face0uv = (mesh.materials[0].vertices[faceid * 5 * 3], mesh.materials[0].vertices[faceid * 5 * 3+ 1])
-		face1uv = (mesh.materials[0].vertices[faceid * 5 * 3 + 5], mesh.materials[0].vertices[faceid * 5 * 3 + 6])
-		face2uv = (mesh.materials[0].vertices[faceid * 5 * 3 + 10], mesh.materials[0].vertices[faceid * 5 * 3 + 11])
-
-		file_out.write("{ " + str(face[0]) + ", " + str(int(face0uv[0] * TEXSQUARE_SIZE)) + ", " + str(int(face0uv[1] * TEXSQUARE_SIZE)))
-		file_out.write(", " + str(face[1]) + ", " + str(int(face1uv[0] * TEXSQUARE_SIZE)) + ", " + str(int(face1uv[1] * TEXSQUARE_SIZE)))
-		file_out.write(", " + str(face[2]) + ", " + str(int(face2uv[0] * TEXSQUARE_SIZE)) + ", " + str(int(face2uv[1] * TEXSQUARE_SIZE)))
-		file_out.write(", " + str(face[0]) + ", " + str(int(face0uv[0] * TEXSQUARE_SIZE)) + ", " + str(int(face0uv[1] * TEXSQUARE_SIZE)))
+		fv = face_verts(mesh, faceid, face)
+		file_out.write("{ " + ", ".join(str(i) + ", " + str(u) + ", " + str(v) for i, u, v in fv))
 		file_out.write("},\n")
 		file_out.write(".color = " + str(int(0xFF)) + "},\n")
 		#for key, value in object_in.materials.items():
@@ -89,9 +377,16 @@ for mesh in object_in.mesh_list:
 file_out.write("};\n")
 
 file_out.write("static const struct PL_OBJ_CONST " +  data_name + " = {\n")
-file_out.write(".verts = " + data_vertices_name + ",\n")
+file_out.write({"int16_t": ".verts16 = ", "int8_t": ".verts8 = ",
+				"int": ".verts = "}[vertex_type] + data_vertices_name + ",\n")
+if quant:
+	file_out.write(".quant = { .scale = { " + ", ".join(str(c) for c in quant[0]) +
+				   " }, .off = { " + ", ".join(str(c) for c in quant[1]) + " } },\n")
 
 file_out.write(".n_polys = " + str(int(total_polys)) + ",\n")
 file_out.write(".n_verts = " + str(len(object_in.vertices)) + ",\n")
 file_out.write(".polys = " + data_polys_name + ",\n")
 file_out.write("};\n")
+
+if not args.depth:
+	file_out.write("#undef G_\n")
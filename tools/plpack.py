@@ -0,0 +1,77 @@
+import struct
+
+# Binary asset pack writer shared by obj2ctexture.py --pack and h2pack.py,
+# struct layouts of the ASSET PACK section of pl.h.
+# Every table and array starts PACK_ALIGN aligned.
+
+PACK_VERSION = 2 # PL_PACK_VERSION
+PACK_ALIGN = 8
+PACK_NO_TEX = 0xffff
+PACK_VERTS16 = 1
+PACK_VERTS8 = 2
+MESH_SIZE = 88
+TEX_SIZE = 40
+POLY_VLEN = 3
+MAX_POLY_VERTS = 6 # including the repeated first vertex
+
+TEXEL_FMT = {8: "<B", 16: "<H", 32: "<I"}
+VERTEX_FMT = {"int16_t": "<4h", "int8_t": "<3b", "int": "<4i"}
+VERTEX_FLAGS = {"int16_t": PACK_VERTS16, "int8_t": PACK_VERTS8, "int": 0}
+
+def name16(name):
+	return name.encode()[:15].ljust(16, b"\0")
+
+def texels(values, texel_bits):
+	return b"".join(struct.pack(TEXEL_FMT[texel_bits], v) for v in values)
+
+# A store is one texel (or index) array and the textures that sample it:
+#   data      bytes of the texels or packed indices
+#   pal       bytes of the palette of indexed textures, None otherwise
+#   textures  (name, fmt, layout, levels, lw, lh, alw, alh, ax, ay) each
+# A polygon is (tex, color, [(vertex, u, v)] with the first repeated),
+# tex an index into the textures of all stores in order or PACK_NO_TEX.
+def pack_image(name, texel_bits, vertex_type, vertex_rows, bounds, quant,
+			   stores, polys):
+	blob = bytearray()
+
+	def put(data):
+		blob.extend(b"\0" * (-len(blob) % PACK_ALIGN))
+		off = len(blob)
+		blob.extend(data)
+		return off
+
+	blob.extend(b"\0" * 32) # header, written last
+	n_tex = sum(len(st[2]) for st in stores)
+	mesh_off = put(b"\0" * MESH_SIZE)
+	tex_off = put(b"\0" * TEX_SIZE * n_tex)
+
+	tex_ents = []
+	for data, pal, textures in stores:
+		pal_off = put(pal) if pal is not None else 0
+		data_off = put(data)
+		for t in textures:
+			tex_ents.append(struct.pack("<16s8B2H3I", name16(t[0]), *t[1:],
+										data_off, len(data), pal_off))
+
+	verts_off = put(b"".join(struct.pack(VERTEX_FMT[vertex_type], *row)
+							 for row in vertex_rows))
+	recs = bytearray()
+	for tex, color, fv in polys:
+		vs = [c for v in fv for c in v]
+		vs += [0] * (MAX_POLY_VERTS * POLY_VLEN - len(vs))
+		recs += struct.pack("<" + str(MAX_POLY_VERTS * POLY_VLEN) + "iiHH",
+							*vs, color, len(fv) - 1, tex)
+	polys_off = put(recs)
+	blob.extend(b"\0" * (-len(blob) % PACK_ALIGN))
+
+	scale, off = quant if quant else ([0] * 3, [0] * 3)
+	blob[mesh_off:mesh_off + MESH_SIZE] = struct.pack("<16s5I6i6iI", name16(name),
+													  VERTEX_FLAGS[vertex_type],
+													  len(vertex_rows), verts_off,
+													  len(polys), polys_off, *bounds,
+													  *scale, *off, 0)
+	for i, e in enumerate(tex_ents):
+		blob[tex_off + TEX_SIZE * i:tex_off + TEX_SIZE * (i + 1)] = e
+	blob[0:32] = struct.pack("<4s2H6I", b"PLPK", PACK_VERSION, texel_bits, len(blob),
+							 1, mesh_off, len(tex_ents), tex_off, 0)
+	return bytes(blob)